@@ -0,0 +1,148 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+///
+///@file benchmark.hpp
+///@brief Minimal benchmark harness used by \b cpp-terminal-bench (no external dependency so it builds offline).
+///
+
+namespace Bench
+{
+
+///
+///@brief Keep \b value alive so the compiler can't drop the computation producing it.
+///
+template<typename T> inline void do_not_optimize(const T& value)
+{
+  static volatile std::size_t sink{0};
+  sink = sink + static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(&value) & 1U);
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+class Result
+{
+public:
+  std::string   name;
+  std::uint64_t iterations{0};  ///< Operations per sample.
+  double        ns_per_op_min{0};
+  double        ns_per_op_median{0};
+  double        bytes_per_op{0};  ///< 0 when the benchmark doesn't process bytes.
+  double        mb_per_s() const { return ns_per_op_median == 0 ? 0 : bytes_per_op * 1000.0 / ns_per_op_median; }
+};
+
+///
+///@brief A benchmark runs \b operation(iterations) and reports the time per operation. \b bytes_per_op is used to compute a throughput.
+///
+class Runner
+{
+public:
+  using Operation = std::function<void(const std::uint64_t& iterations)>;
+
+  Runner(const std::chrono::milliseconds& min_time, const std::size_t& samples, const std::string& filter) : m_min_time(min_time), m_samples(std::max<std::size_t>(samples, 1)), m_filter(filter) {}
+
+  void run(const std::string& name, const Operation& operation, const double& bytes_per_op = 0)
+  {
+    if(!m_filter.empty() && name.find(m_filter) == std::string::npos) { return; }
+    // Grow the batch until one sample lasts min_time / samples
+    const std::chrono::nanoseconds target{std::chrono::duration_cast<std::chrono::nanoseconds>(m_min_time) / static_cast<long>(m_samples)};
+    std::uint64_t                  iterations{1};
+    while(true)
+    {
+      const std::chrono::nanoseconds elapsed{time(operation, iterations)};
+      if(elapsed >= target || iterations >= (std::uint64_t(1) << 40)) { break; }
+      const double ratio{elapsed.count() <= 0 ? 100.0 : static_cast<double>(target.count()) / static_cast<double>(elapsed.count())};
+      iterations = static_cast<std::uint64_t>(static_cast<double>(iterations) * std::min(100.0, std::max(2.0, ratio * 1.2)));
+    }
+    std::vector<double> ns_per_op;
+    for(std::size_t sample = 0; sample != m_samples; ++sample) { ns_per_op.push_back(static_cast<double>(time(operation, iterations).count()) / static_cast<double>(iterations)); }
+    std::sort(ns_per_op.begin(), ns_per_op.end());
+    Result result;
+    result.name             = name;
+    result.iterations       = iterations;
+    result.ns_per_op_min    = ns_per_op.front();
+    result.ns_per_op_median = ns_per_op[ns_per_op.size() / 2];
+    result.bytes_per_op     = bytes_per_op;
+    m_results.push_back(result);
+  }
+
+  const std::vector<Result>& results() const { return m_results; }
+
+  void write_table(std::ostream& out) const
+  {
+    out << std::left << std::setw(48) << "benchmark" << std::right << std::setw(16) << "ns/op (median)" << std::setw(14) << "ns/op (min)" << std::setw(12) << "MB/s" << '\n';
+    for(std::size_t i = 0; i != m_results.size(); ++i)
+    {
+      out << std::left << std::setw(48) << m_results[i].name << std::right << std::fixed << std::setprecision(1) << std::setw(16) << m_results[i].ns_per_op_median << std::setw(14) << m_results[i].ns_per_op_min << std::setw(12);
+      if(m_results[i].bytes_per_op != 0) { out << m_results[i].mb_per_s(); }
+      else { out << '-'; }
+      out << '\n';
+    }
+  }
+
+  ///
+  ///@brief Write the results as JSON. \b context entries are written as strings in a "context" object.
+  ///
+  void write_json(std::ostream& out, const std::vector<std::pair<std::string, std::string>>& context) const
+  {
+    out << "{\n  \"context\": {";
+    for(std::size_t i = 0; i != context.size(); ++i) { out << (i == 0 ? "\n" : ",\n") << "    \"" << escape(context[i].first) << "\": \"" << escape(context[i].second) << '"'; }
+    out << "\n  },\n  \"benchmarks\": [";
+    for(std::size_t i = 0; i != m_results.size(); ++i)
+    {
+      const Result& result{m_results[i]};
+      out << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << escape(result.name) << "\", \"iterations\": " << result.iterations << std::fixed << std::setprecision(3) << ", \"ns_per_op_median\": " << result.ns_per_op_median << ", \"ns_per_op_min\": " << result.ns_per_op_min;
+      if(result.bytes_per_op != 0) { out << ", \"bytes_per_op\": " << result.bytes_per_op << ", \"mb_per_s\": " << result.mb_per_s(); }
+      out << '}';
+    }
+    out << "\n  ]\n}\n";
+  }
+
+private:
+  static std::chrono::nanoseconds time(const Operation& operation, const std::uint64_t& iterations)
+  {
+    const std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+    operation(iterations);
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  }
+
+  static std::string escape(const std::string& str)
+  {
+    std::ostringstream ret;
+    for(std::size_t i = 0; i != str.size(); ++i)
+    {
+      const unsigned char character{static_cast<unsigned char>(str[i])};
+      if(character == '"' || character == '\\') { ret << '\\' << str[i]; }
+      else if(character < 0x20) { ret << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character) << std::dec << std::setfill(' '); }
+      else { ret << str[i]; }
+    }
+    return ret.str();
+  }
+
+  std::chrono::milliseconds m_min_time;
+  std::size_t               m_samples;
+  std::string               m_filter;
+  std::vector<Result>       m_results;
+};
+
+}  // namespace Bench
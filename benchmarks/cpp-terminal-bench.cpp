@@ -0,0 +1,1093 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "benchmark.hpp"
+#include "cpp-terminal/canvas.hpp"
+#include "cpp-terminal/color.hpp"
+#include "cpp-terminal/completion.hpp"
+#include "cpp-terminal/emulator.hpp"
+#include "cpp-terminal/event.hpp"
+#include "cpp-terminal/graphics.hpp"
+#include "cpp-terminal/highlight.hpp"
+#include "cpp-terminal/history.hpp"
+#include "cpp-terminal/image.hpp"
+#include "cpp-terminal/model.hpp"
+#include "cpp-terminal/pager.hpp"
+#include "cpp-terminal/prompt.hpp"
+#include "cpp-terminal/private/blocking_queue.hpp"
+#include "cpp-terminal/private/shared_file.hpp"
+#include "cpp-terminal/private/unicode.hpp"
+#include "cpp-terminal/search.hpp"
+#include "cpp-terminal/table.hpp"
+#include "cpp-terminal/terminfo.hpp"
+#include "cpp-terminal/textbuffer.hpp"
+#include "cpp-terminal/version.hpp"
+#include "cpp-terminal/window.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <utility>
+
+namespace
+{
+
+// Deterministic pseudo random numbers so every run renders the same frames
+class Lcg
+{
+public:
+  std::uint32_t next()
+  {
+    m_state = m_state * 1664525U + 1013904223U;
+    return m_state >> 8;
+  }
+
+private:
+  std::uint32_t m_state{12345};
+};
+
+enum class Density
+{
+  Plain,   // text only
+  Sparse,  // a color change every ~16 cells
+  Dense    // a different 24bit fg/bg on every cell
+};
+
+Term::Window make_window(const std::size_t& columns, const std::size_t& rows, const Density& density)
+{
+  static const std::u32string text{U"Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ünïcödé 你好 ∮ E⋅da = Q "};
+  Term::Window                window(columns, rows);
+  Lcg                         random;
+  for(std::size_t row = 1; row <= rows; ++row)
+  {
+    for(std::size_t column = 1; column <= columns; ++column)
+    {
+      window.set_char(column, row, text[(row * columns + column) % text.size()]);
+      if(density == Density::Dense)
+      {
+        const std::uint32_t value{random.next()};
+        window.set_fg(column, row, Term::Color(static_cast<std::uint8_t>(value), static_cast<std::uint8_t>(value >> 8), static_cast<std::uint8_t>(value >> 16)));
+        window.set_bg(column, row, Term::Color(static_cast<std::uint8_t>(value >> 16), static_cast<std::uint8_t>(value), static_cast<std::uint8_t>(value >> 8)));
+      }
+      else if(density == Density::Sparse && random.next() % 16 == 0)
+      {
+        window.set_fg(column, row, static_cast<Term::Color::Name>(random.next() % 8));
+        if(random.next() % 2 == 0) { window.set_style(column, row, Term::Style::Bold); }
+      }
+    }
+  }
+  return window;
+}
+
+std::string ascii_text(const std::size_t& size)
+{
+  std::string ret;
+  while(ret.size() < size) { ret.append("The quick brown fox jumps over the lazy dog. 0123456789 "); }
+  ret.resize(size);
+  return ret;
+}
+
+std::string mixed_text(const std::size_t& size)
+{
+  std::string ret;
+  while(ret.size() < size) { ret.append("Hello World; 你好; おはようございます; בוקר טוב; γνωρίζω ἀπὸ τὴν ὄψη; ∮ E⋅da = Q; 😀 "); }
+  return ret;
+}
+
+// What the input thread typically reads: keys, escape sequences, mouse reports, cursor position replies, focus and pasted text
+std::vector<std::string> input_corpus()
+{
+  std::vector<std::string> ret;
+  const char* const        keys[]{"a", "Z", "\u007f", "\r", "\t", "\u0003", "\u001bx", "\u001b[A", "\u001b[B", "\u001bOC", "\u001b[D", "\u001b[H", "\u001b[F", "\u001b[3~", "\u001b[5~", "\u001b[6~", "\u001bOP", "\u001b[15~", "\u001b[24~", "é", "你", "😀", "\u001b[I", "\u001b[O", "\u001b[12;40R", "\u001b[<0;10;20M", "\u001b[<0;10;20m", "\u001b[<35;11;21M", "\u001b[<64;5;5M", "Pasted text that is longer than ten bytes"};
+  for(std::size_t repeat = 0; repeat != 4; ++repeat)
+  {
+    for(std::size_t i = 0; i != sizeof(keys) / sizeof(keys[0]); ++i) { ret.push_back(keys[i]); }
+  }
+  return ret;
+}
+
+std::string color_mode()
+{
+  switch(Term::Terminfo::getColorMode())
+  {
+    case Term::Terminfo::ColorMode::NoColor: return "NoColor";
+    case Term::Terminfo::ColorMode::Bit3: return "Bit3";
+    case Term::Terminfo::ColorMode::Bit4: return "Bit4";
+    case Term::Terminfo::ColorMode::Bit8: return "Bit8";
+    case Term::Terminfo::ColorMode::Bit24: return "Bit24";
+    default: return "Unset";
+  }
+}
+
+void usage(const char* name)
+{
+  std::cout << "Usage: " << name << " [--json FILE] [--filter SUBSTRING] [--min-time MILLISECONDS] [--samples N]\n"
+            << "  --json FILE    write the results as JSON to FILE ('-' for the standard output)\n"
+            << "  --filter STR   only run the benchmarks whose name contains STR\n"
+            << "  --min-time MS  minimal time spent measuring each benchmark (default 250)\n"
+            << "  --samples N    number of timed samples per benchmark (default 5)\n";
+}
+
+void render_benchmarks(Bench::Runner& runner)
+{
+  const std::size_t sizes[][2]{
+    {80,  24},
+    {200, 60},
+    {400, 120}
+  };
+  const std::pair<Density, std::string> densities[]{std::make_pair(Density::Plain, "plain"), std::make_pair(Density::Sparse, "sparse"), std::make_pair(Density::Dense, "dense")};
+  for(std::size_t size = 0; size != sizeof(sizes) / sizeof(sizes[0]); ++size)
+  {
+    for(std::size_t density = 0; density != sizeof(densities) / sizeof(densities[0]); ++density)
+    {
+      Term::Window      window{make_window(sizes[size][0], sizes[size][1], densities[density].first)};
+      const std::string name{"window/render/" + std::to_string(sizes[size][0]) + "x" + std::to_string(sizes[size][1]) + "/" + densities[density].second};
+      const std::size_t frame_bytes{window.render(1, 1, true).size()};
+      runner.run(
+        name,
+        [&window](const std::uint64_t& iterations)
+        {
+          for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(window.render(1, 1, true)); }
+        },
+        static_cast<double>(frame_bytes));
+    }
+  }
+  // Fill a frame line by line: UTF-8 decoding, grapheme segmentation and cell updates
+  const std::pair<std::string, std::string> lines[]{
+    std::make_pair(std::string("ascii"), std::string("The quick brown fox jumps over the lazy dog, 0123456789 (+-*/) [ok] {done}.....")),
+    std::make_pair(std::string("mixed"), std::string("Cre\xcc\x80me bru\xcc\x82le\xcc\x81" "e, \xe4\xbd\xa0\xe5\xa5\xbd \xe4\xb8\x96\xe7\x95\x8c, \xea\xb0\x80\xeb\x82\x98\xeb\x8b\xa4, na\xc3\xafve r\xc3\xa9sum\xc3\xa9 \xe2\x94\x80\xe2\x94\x80 \xce\xb1\xce\xb2\xce\xb3 ok")),
+    std::make_pair(std::string("emoji"), std::string("\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x91\xa7 \xf0\x9f\x87\xab\xf0\x9f\x87\xb7 \xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd \xe2\x9d\xa4\xef\xb8\x8f 1\xef\xb8\x8f\xe2\x83\xa3 \xf0\x9f\x98\x80 done"))};
+  for(std::size_t line = 0; line != sizeof(lines) / sizeof(lines[0]); ++line)
+  {
+    Term::Window      target(80, 24);
+    const std::string text{lines[line].second};
+    runner.run(
+      "window/print_str/80x24/" + lines[line].first,
+      [&target, &text](const std::uint64_t& iterations)
+      {
+        for(std::uint64_t i = 0; i != iterations; ++i)
+        {
+          for(std::size_t row = 1; row <= 24; ++row) { target.print_str(1, row, text); }
+        }
+        Bench::do_not_optimize(target.get_w());
+      },
+      static_cast<double>(24 * text.size()));
+  }
+  // Parse a full dense frame, the work done by the terminal itself
+  Term::Window      window{make_window(200, 60, Density::Dense)};
+  const std::string frame{window.render(1, 1, true)};
+  runner.run(
+    "emulator/feed/200x60/dense",
+    [&frame](const std::uint64_t& iterations)
+    {
+      Term::Emulator emulator(60, 200);
+      for(std::uint64_t i = 0; i != iterations; ++i) { emulator.feed(frame); }
+      Bench::do_not_optimize(emulator.bytes());
+    },
+    static_cast<double>(frame.size()));
+}
+
+void color_benchmarks(Bench::Runner& runner)
+{
+  runner.run("color/fg/name",
+             [](const std::uint64_t& iterations)
+             {
+               for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(Term::color_fg(static_cast<Term::Color::Name>(i % 8))); }
+             });
+  runner.run("color/fg/bit8",
+             [](const std::uint64_t& iterations)
+             {
+               for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(Term::color_fg(static_cast<std::uint8_t>(i))); }
+             });
+  runner.run("color/fg/bit24",
+             [](const std::uint64_t& iterations)
+             {
+               for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(Term::color_fg(static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(i >> 8), static_cast<std::uint8_t>(i >> 16))); }
+             });
+  runner.run("color/bg/bit24",
+             [](const std::uint64_t& iterations)
+             {
+               for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(Term::color_bg(static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(i >> 8), static_cast<std::uint8_t>(i >> 16))); }
+             });
+  runner.run("color/to8bits",
+             [](const std::uint64_t& iterations)
+             {
+               for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(Term::Color(static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(i >> 8), static_cast<std::uint8_t>(i >> 16)).to8bits()); }
+             });
+  // Quantize a 320x200 RGB image
+  std::vector<std::uint8_t> pixels(320 * 200 * 3);
+  for(std::size_t i = 0; i != pixels.size(); ++i) { pixels[i] = static_cast<std::uint8_t>(i * 7 + i / 960); }
+  runner.run(
+    "color/to8bits/batch/320x200",
+    [&pixels](const std::uint64_t& iterations)
+    {
+      std::vector<std::uint8_t> colors(pixels.size() / 3);
+      for(std::uint64_t i = 0; i != iterations; ++i) { Term::to8bits(pixels.data(), colors.size(), colors.data()); }
+      Bench::do_not_optimize(colors);
+    },
+    static_cast<double>(pixels.size()));
+  runner.run("style",
+             [](const std::uint64_t& iterations)
+             {
+               for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(Term::style(static_cast<Term::Style>(i % 10))); }
+             });
+  // The renderer appends to its frame instead of building strings
+  runner.run("color/fg/bit8/append",
+             [](const std::uint64_t& iterations)
+             {
+               std::string out;
+               for(std::uint64_t i = 0; i != iterations; ++i)
+               {
+                 if(out.size() > 4096) { out.clear(); }
+                 Term::append_color_fg(out, static_cast<std::uint8_t>(i));
+               }
+               Bench::do_not_optimize(out);
+             });
+  runner.run("color/bg/bit24/append",
+             [](const std::uint64_t& iterations)
+             {
+               std::string out;
+               for(std::uint64_t i = 0; i != iterations; ++i)
+               {
+                 if(out.size() > 4096) { out.clear(); }
+                 Term::append_color_bg(out, Term::Color(static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(i >> 8), static_cast<std::uint8_t>(i >> 16)));
+               }
+               Bench::do_not_optimize(out);
+             });
+}
+
+// A 1080p frame scaled to a 160x45 terminal, the budget is a 60Hz frame
+void image_benchmarks(Bench::Runner& runner)
+{
+  std::vector<std::uint8_t> pixels(1920 * 1080 * 3);
+  for(std::size_t i = 0; i != pixels.size(); ++i) { pixels[i] = static_cast<std::uint8_t>(i * 7 + i / 5760); }
+  const Term::Image image(pixels.data(), 1920, 1080);
+  const char* const names[4]{"image/draw/1920x1080/halfblock", "image/draw/1920x1080/quadrant", "image/draw/1920x1080/halfblock/threads=4", "image/draw/1920x1080/quadrant/threads=4"};
+  for(std::size_t i = 0; i != 4; ++i)
+  {
+    const Term::Blitter blitter{i % 2 == 0 ? Term::Blitter::HalfBlock : Term::Blitter::Quadrant};
+    const std::size_t   threads{i < 2 ? 1U : 4U};
+    runner.run(
+      names[i],
+      [&image, blitter, threads](const std::uint64_t& iterations)
+      {
+        Term::Window window(160, 45);
+        for(std::uint64_t j = 0; j != iterations; ++j) { Term::draw_image(window, 1, 1, 160, 45, image, blitter, threads); }
+        Bench::do_not_optimize(window);
+      },
+      static_cast<double>(pixels.size()));
+  }
+}
+
+// A live chart of 640x360 pixels: a few colors on a dark background
+void graphics_benchmarks(Bench::Runner& runner)
+{
+  std::vector<std::uint8_t> pixels(640 * 360 * 3, 16);
+  for(std::size_t x = 0; x != 640; ++x)
+  {
+    for(std::size_t serie = 0; serie != 4; ++serie)
+    {
+      const std::size_t y{(x * (serie + 1) * 7 + serie * 90) % 360};
+      pixels[(y * 640 + x) * 3 + serie % 3] = 255;
+    }
+  }
+  const Term::Image image(pixels.data(), 640, 360);
+  runner.run(
+    "graphics/sixel/640x360",
+    [&image](const std::uint64_t& iterations)
+    {
+      Term::SixelEncoder encoder;
+      std::string        out;
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        out.clear();
+        encoder.encode(out, image);
+      }
+      Bench::do_not_optimize(out);
+    },
+    static_cast<double>(pixels.size()));
+  runner.run(
+    "graphics/kitty/640x360",
+    [&image](const std::uint64_t& iterations)
+    {
+      Term::KittyEncoder encoder;
+      std::string        out;
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        out.clear();
+        encoder.clear();
+        encoder.encode(out, image, 1);
+      }
+      Bench::do_not_optimize(out);
+    },
+    static_cast<double>(pixels.size()));
+  // Unchanged image: hashed then placed again
+  runner.run(
+    "graphics/kitty/640x360/unchanged",
+    [&image](const std::uint64_t& iterations)
+    {
+      Term::KittyEncoder encoder;
+      std::string        out;
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        out.clear();
+        encoder.encode(out, image, 1);
+      }
+      Bench::do_not_optimize(out);
+    },
+    static_cast<double>(pixels.size()));
+}
+
+// A scatter plot frame: 100k points on the braille dots of a 160x45 terminal, then the cells written in the window
+void canvas_benchmarks(Bench::Runner& runner)
+{
+  std::vector<std::pair<std::size_t, std::size_t>> points(100000);
+  for(std::size_t i = 0; i != points.size(); ++i) { points[i] = std::make_pair((i * 7919) % 320, (i * 104729) % 180); }
+  runner.run(
+    "canvas/points/100k",
+    [&points](const std::uint64_t& iterations)
+    {
+      Term::Canvas canvas(160, 45);
+      Term::Window window(160, 45);
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        canvas.clear();
+        for(std::size_t j = 0; j != points.size(); ++j) { canvas.set(points[j].first, points[j].second); }
+        canvas.draw(window, 1, 1);
+      }
+      Bench::do_not_optimize(window);
+    },
+    static_cast<double>(points.size()));
+  runner.run("canvas/line/320x180",
+             [](const std::uint64_t& iterations)
+             {
+               Term::Canvas canvas(160, 45);
+               for(std::uint64_t i = 0; i != iterations; ++i) { canvas.line(0, i % 180, 319, 179 - i % 180); }
+               Bench::do_not_optimize(canvas);
+             });
+}
+
+// Typing 16KB on one line of the multiline prompt: the gap buffer against rebuilding the line on each key as the prompt used to
+void prompt_benchmarks(Bench::Runner& runner)
+{
+  const std::size_t size{16384};
+  runner.run(
+    "prompt/type/16KB",
+    [size](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        Term::Model model;
+        for(std::size_t j = 0; j != size; ++j)
+        {
+          model.insert(static_cast<char>('a' + j % 26));
+          if(j % 64 == 0) { model.move_left(); }
+        }
+        Bench::do_not_optimize(model);
+      }
+    },
+    static_cast<double>(size));
+  runner.run(
+    "prompt/type/16KB/legacy",
+    [size](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        std::vector<std::string> lines{""};
+        std::size_t              cursor_col{1};
+        for(std::size_t j = 0; j != size; ++j)
+        {
+          std::string before = lines[0].substr(0, cursor_col - 1);
+          std::string newchar;
+          newchar.push_back(static_cast<char>('a' + j % 26));
+          std::string after = lines[0].substr(cursor_col - 1);
+          lines[0]          = before += newchar += after;
+          cursor_col++;
+          if(j % 64 == 0) { cursor_col--; }
+        }
+        Bench::do_not_optimize(lines);
+      }
+    },
+    static_cast<double>(size));
+  // One keystroke in the middle of a 200 line input, written against the previous frame or in full
+  const std::size_t columns{80};
+  Term::Model       input;
+  input.prompt_string = "> ";
+  for(std::size_t line = 1; line <= 200; ++line)
+  {
+    input.insert("SELECT column_" + std::to_string(line) + " FROM table WHERE id = " + std::to_string(line) + ";");
+    if(line != 200) { input.new_line(); }
+  }
+  input.set_cursor(100, 8);
+  for(const bool incremental: {true, false})
+  {
+    Term::Model  model{input};
+    Term::Window scr(columns, model.lines());
+    Term::Window previous(columns, model.lines());
+    Term::render(previous, model, columns);
+    model.insert('x');
+    Term::render(scr, model, columns);
+    const std::size_t keystroke_bytes{incremental ? scr.render(1, 1, previous).size() : scr.render(1, 1, true).size()};
+    std::swap(scr, previous);
+    runner.run(
+      incremental ? "prompt/redraw/200lines" : "prompt/redraw/200lines/full",
+      [&](const std::uint64_t& iterations)
+      {
+        for(std::uint64_t i = 0; i != iterations; ++i)
+        {
+          if(i % 2 == 0) { model.erase_before(); }
+          else { model.insert('x'); }
+          Term::render(scr, model, columns);
+          Bench::do_not_optimize(incremental ? scr.render(1, 1, previous) : scr.render(1, 1, true));
+          std::swap(scr, previous);
+        }
+      },
+      static_cast<double>(keystroke_bytes));
+  }
+}
+
+void history_benchmarks(Bench::Runner& runner)
+{
+  // 100k commands, a tenth of them repeated
+  const std::string file{"cpp-terminal-bench.history"};
+  std::remove(file.c_str());
+  {
+    std::ofstream out(file, std::ios::binary);
+    for(std::size_t i = 0; i != 100000; ++i) { out << "git commit -m 'change " << (i % 10 == 0 ? i % 1000 : i) << "' && make -j8 test" << '\0'; }
+  }
+  Term::Private::FileId id{};
+  const double          bytes{static_cast<double>(Term::Private::read_file(file, 0, id).size())};
+  runner.run(
+    "history/load/100k",
+    [&file](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        Term::History history(file);
+        Bench::do_not_optimize(history.size());
+      }
+    },
+    bytes);
+  const Term::History history(file);
+  std::remove(file.c_str());
+  runner.run(
+    "history/search/100k/oldest",
+    [&history](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(history.search("change 1'", history.size())); }
+    },
+    bytes);
+  runner.run(
+    "history/search/100k/none",
+    [&history](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(history.search("cmake --build", history.size())); }
+    },
+    bytes);
+}
+
+void completion_benchmarks(Bench::Runner& runner)
+{
+  // The identifiers of a large SQL schema: 5000 tables of 100 columns
+  std::vector<std::string> identifiers;
+  identifiers.reserve(500000);
+  for(std::size_t i = 0; i != 500000; ++i) { identifiers.push_back("table_" + std::to_string(i % 5000) + ".column_" + std::to_string(i / 5000)); }
+  runner.run(
+    "completion/trie/build/500k",
+    [&identifiers](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        const Term::Trie trie(identifiers);
+        Bench::do_not_optimize(trie.size());
+      }
+    });
+  const Term::Trie        trie(identifiers);
+  const std::atomic<bool> cancelled{false};
+  // What a Tab costs the worker and then the popup: the range of the word and the visible candidates
+  const auto complete = [&trie, &cancelled](const std::string& input)
+  {
+    const Term::Completion completion{trie.complete(input, cancelled)};
+    for(std::size_t i = 0; i != std::min<std::size_t>(completion.size(), 8); ++i) { Bench::do_not_optimize(completion[i]); }
+  };
+  runner.run(
+    "completion/trie/complete/500k/wide",
+    [&complete](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i) { complete("SELECT * FROM ta"); }
+    });
+  runner.run(
+    "completion/trie/complete/500k/deep",
+    [&complete](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i) { complete("SELECT table_4321.column_9"); }
+    });
+}
+
+void highlight_benchmarks(Bench::Runner& runner)
+{
+  // A 100k lines C file, a block comment every 50 lines
+  std::vector<std::string> lines;
+  lines.reserve(100000);
+  double bytes{0};
+  for(std::size_t i = 0; i != 100000; ++i)
+  {
+    if(i % 50 == 0) { lines.push_back("/* block " + std::to_string(i)); }
+    else if(i % 50 == 1) { lines.push_back("   still commented */"); }
+    else { lines.push_back("  for(unsigned int i = 0; i < " + std::to_string(i) + "; ++i) { total += compute(i, \"name\"); } // loop"); }
+    bytes += static_cast<double>(lines.back().size());
+  }
+  runner.run(
+    "highlight/c/all/100k",
+    [&lines](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        Term::Highlighter highlighter(Term::Syntax::c());
+        highlighter.assign(lines);
+        Bench::do_not_optimize(highlighter.update());
+      }
+    },
+    bytes);
+  Term::Highlighter highlighter(Term::Syntax::c());
+  highlighter.assign(lines);
+  highlighter.update();
+  // A key typed in the middle of the file: one line, the state it ends in is unchanged
+  runner.run(
+    "highlight/c/edit/100k",
+    [&highlighter, &lines](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        highlighter.set(50025, lines[50025] + (i % 2 == 0 ? "x" : ""));
+        Bench::do_not_optimize(highlighter.update());
+      }
+    });
+  // Opening a comment, the lines are highlighted again up to where it is closed
+  runner.run(
+    "highlight/c/open-comment/100k",
+    [&highlighter, &lines](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        highlighter.set(50025, i % 2 == 0 ? "/*" + lines[50025] : lines[50025]);
+        Bench::do_not_optimize(highlighter.update());
+      }
+    });
+}
+
+void textbuffer_benchmarks(Bench::Runner& runner)
+{
+  // A 1M lines log, 80 MB
+  const std::string file{"cpp-terminal-bench.log"};
+  {
+    std::ofstream out(file, std::ios::binary);
+    for(std::size_t i = 0; i != 1000000; ++i) { out << "2023-01-01T00:00:00 [worker " << i % 16 << "] processed request " << i << " in " << i % 997 << " ms\n"; }
+  }
+  // What kilo did: every line read into its own string
+  runner.run(
+    "textbuffer/open/1M/getline",
+    [&file](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        std::ifstream            in(file);
+        std::vector<std::string> rows;
+        std::string              line;
+        while(std::getline(in, line)) { rows.push_back(line); }
+        Bench::do_not_optimize(rows.size());
+      }
+    });
+  // Opening and showing a screen reads the first lines only
+  runner.run(
+    "textbuffer/open/1M/first-screen",
+    [&file](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        const Term::TextBuffer buffer{Term::TextBuffer::open(file)};
+        for(std::size_t row = 0; row != 50; ++row) { Bench::do_not_optimize(buffer.line(row)); }
+      }
+    });
+  runner.run(
+    "textbuffer/open/1M/lines",
+    [&file](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(Term::TextBuffer::open(file).lines()); }
+    });
+  Term::TextBuffer buffer{Term::TextBuffer::open(file)};
+  std::remove(file.c_str());
+  // Typing in the middle of the file and reading the line back
+  const std::size_t middle{buffer.line_begin(500000)};
+  runner.run(
+    "textbuffer/type/1M",
+    [&buffer, &middle](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        buffer.insert(middle + i % 64, "x");
+        if(i % 64 == 63) { buffer.erase(middle, 64); }
+        Bench::do_not_optimize(buffer.line(500000));
+      }
+    });
+}
+
+void pager_benchmarks(Bench::Runner& runner)
+{
+  // A 1M lines log, 80 MB
+  const std::string file{"cpp-terminal-bench-pager.log"};
+  {
+    std::ofstream out(file, std::ios::binary);
+    for(std::size_t i = 0; i != 1000000; ++i) { out << "2023-01-01T00:00:00 [worker " << i % 16 << "] processed request " << i << " in " << i % 997 << " ms\n"; }
+  }
+  Term::Window window(120, 50);
+  // Opening and showing the first screen does not wait for the index
+  runner.run(
+    "pager/open/1M/first-screen",
+    [&file, &window](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        Term::Pager pager(file);
+        pager.render(window, 1, 1, 120, 50);
+        Bench::do_not_optimize(pager.top_offset());
+      }
+    });
+  runner.run(
+    "pager/index/1M",
+    [&file](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        Term::Pager pager(file);
+        while(pager.indexing()) { std::this_thread::yield(); }
+        Bench::do_not_optimize(pager.lines());
+      }
+    });
+  Term::Pager pager(file);
+  while(pager.indexing()) { std::this_thread::yield(); }
+  pager.update();
+  runner.run(
+    "pager/jump_to_line/1M",
+    [&pager, &window](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        pager.jump_to_line((i * 7919) % 1000000);
+        pager.render(window, 1, 1, 120, 50);
+        Bench::do_not_optimize(pager.top_line());
+      }
+    });
+  runner.run(
+    "pager/jump_to_percent/1M",
+    [&pager, &window](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        pager.jump_to_percent(static_cast<double>(i % 100));
+        pager.render(window, 1, 1, 120, 50);
+        Bench::do_not_optimize(pager.top_line());
+      }
+    });
+  runner.run(
+    "pager/scroll/1M",
+    [&pager, &window](const std::uint64_t& iterations)
+    {
+      pager.jump_to_line(500000);
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        pager.scroll(i % 2 == 0 ? 1 : -1);
+        pager.render(window, 1, 1, 120, 50);
+        Bench::do_not_optimize(pager.top_line());
+      }
+    });
+  std::remove(file.c_str());
+}
+
+void search_benchmarks(Bench::Runner& runner)
+{
+  // A 1M lines log, 80 MB, the pattern on its last line
+  std::string text;
+  for(std::size_t i = 0; i != 1000000; ++i) { text += "2023-01-01T00:00:00 [worker " + std::to_string(i % 16) + "] processed request " + std::to_string(i) + " in " + std::to_string(i % 997) + " ms\n"; }
+  text += "2023-01-01T00:00:00 [worker 0] request timed out\n";
+  const Term::TextBuffer buffer(text);
+  // What kilo did: each row copied, strstr on it
+  runner.run(
+    "search/literal/80MB/strstr-rows",
+    [&buffer](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        std::size_t row{0};
+        for(; row != buffer.lines(); ++row)
+        {
+          if(std::strstr(buffer.line(row).c_str(), "timed out") != nullptr) { break; }
+        }
+        Bench::do_not_optimize(row);
+      }
+    },
+    static_cast<double>(text.size()));
+  runner.run(
+    "search/literal/80MB/std::string::find",
+    [&text](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(text.find("timed out")); }
+    },
+    static_cast<double>(text.size()));
+  const Term::Search literal("timed out");
+  runner.run(
+    "search/literal/80MB/search",
+    [&buffer, &literal](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(buffer.find(literal).position); }
+    },
+    static_cast<double>(text.size()));
+  const Term::Search ignore_case("TIMED OUT", Term::Search::Syntax::Literal, true);
+  runner.run(
+    "search/literal/80MB/ignore-case",
+    [&buffer, &ignore_case](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(buffer.find(ignore_case).position); }
+    },
+    static_cast<double>(text.size()));
+  const Term::Search regex("timed? out$", Term::Search::Syntax::Regex);
+  runner.run(
+    "search/regex/8MB",
+    [&buffer, &regex, &text](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(buffer.find(regex, text.size() - 8 * 1024 * 1024).position); }
+    },
+    8.0 * 1024 * 1024);
+  // Typing "timed out" a character at a time, one step between the keys: the searches resume from the previous match
+  runner.run(
+    "search/incremental/80MB/typing",
+    [&buffer](const std::uint64_t& iterations)
+    {
+      const std::string       pattern{"timed out"};
+      Term::IncrementalSearch search;
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        search.cancel();
+        for(std::size_t size = 1; size <= pattern.size(); ++size)
+        {
+          search.start(buffer, Term::Search(pattern.substr(0, size)), 0);
+          search.step();
+        }
+        Bench::do_not_optimize(search.run().position);
+      }
+    });
+}
+
+// utf8_to_utf32 as it was before the ASCII kernels, kept as the baseline of the unicode/utf8_to_utf32/*/legacy benchmarks
+namespace Legacy
+{
+
+bool is_valid_utf8(const std::string::const_iterator& begin, const std::string::const_iterator& end)
+{
+  if(begin > end) { return false; }
+  for(std::string::const_iterator it = begin; it != end;)
+  {
+    const std::uint8_t lead{static_cast<std::uint8_t>(*it)};
+    const std::size_t  byte_count{Term::Private::utf8_codepoint_size(lead)};
+    if(byte_count == 0 || it + byte_count > end) { return false; }
+    if(byte_count == 1 && (lead & 0x80) != 0) { return false; }
+    for(std::size_t i = 1; i < byte_count; ++i)
+    {
+      if((static_cast<std::uint8_t>(*(it + i)) & 0xC0) != 0x80) { return false; }
+    }
+    it += byte_count;
+  }
+  return true;
+}
+
+std::u32string utf8_to_utf32(const std::string& str)
+{
+  static const std::uint8_t mask_first[]{0x7F, 0x1F, 0x0F, 0x07};
+  std::u32string            ret;
+  for(std::size_t byte = 0; byte < str.size();)
+  {
+    const std::size_t byte_count{Term::Private::utf8_codepoint_size(static_cast<std::uint8_t>(str[byte]))};
+    if(byte_count == 0)
+    {
+      ret.push_back(U'\U0000FFFD');
+      byte += 1;
+      continue;
+    }
+    if(is_valid_utf8(str.begin() + byte, str.begin() + byte + byte_count))
+    {
+      char32_t codepoint{static_cast<char32_t>(static_cast<std::uint8_t>(str[byte]) & mask_first[byte_count - 1])};
+      for(std::size_t i = 1; i < byte_count; ++i) { codepoint = (codepoint << 6U) | (static_cast<std::uint8_t>(str[byte + i]) & 0x3FU); }
+      ret.push_back(codepoint);
+    }
+    else { ret.push_back(U'\U0000FFFD'); }
+    byte += byte_count;
+  }
+  return ret;
+}
+
+}  // namespace Legacy
+
+std::string utf8_kernel_name(const Term::Private::Utf8Kernel& kernel)
+{
+  switch(kernel)
+  {
+    case Term::Private::Utf8Kernel::Scalar: return "scalar";
+    case Term::Private::Utf8Kernel::Sse2: return "sse2";
+    case Term::Private::Utf8Kernel::Avx2: return "avx2";
+    case Term::Private::Utf8Kernel::Neon: return "neon";
+    default: return "unknown";
+  }
+}
+
+void table_benchmarks(Bench::Runner& runner)
+{
+  // 1M rows of 6 cells, made up as they are asked for
+  const auto rows = [](const std::size_t& row) -> std::vector<std::string>
+  { return {std::to_string(row), "file_" + std::to_string(row) + ".dat", std::to_string(row * 2654435761U % 100000000), "2023-01-01 00:00", row % 2 == 0 ? "source" : "header", "src/module/file_" + std::to_string(row) + ".dat"}; };
+  const std::vector<Term::Table::Column> columns{Term::Table::Column("#", Term::Table::Align::Right), Term::Table::Column("Name"), Term::Table::Column("Size", Term::Table::Align::Right), Term::Table::Column("Modified", Term::Table::Align::Center), Term::Table::Column("Kind"), Term::Table::Column("Path")};
+  Term::Window                           window(120, 50);
+  Term::Table                            table(columns, 1000000, rows);
+  runner.run(
+    "table/open/1M/first-screen",
+    [&columns, &rows, &window](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        Term::Table opened(columns, 1000000, rows);
+        opened.render(window, 1, 1, 120, 50);
+        Bench::do_not_optimize(opened.width());
+      }
+    });
+  runner.run(
+    "table/scroll-page/1M",
+    [&table, &window](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        table.scroll(i % 1000 < 500 ? 49 : -49);
+        table.render(window, 1, 1, 120, 50);
+        Bench::do_not_optimize(table.top());
+      }
+    });
+  runner.run(
+    "table/scroll-line/1M",
+    [&table, &window](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        table.scroll(i % 2 == 0 ? 1 : -1);
+        table.render(window, 1, 1, 120, 50);
+        Bench::do_not_optimize(table.top());
+      }
+    });
+  runner.run(
+    "table/jump/1M",
+    [&table, &window](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        table.scroll_to((i * 7919) % 1000000);
+        table.render(window, 1, 1, 120, 50);
+        Bench::do_not_optimize(table.top());
+      }
+    });
+}
+
+void unicode_benchmarks(Bench::Runner& runner)
+{
+  const std::pair<std::string, std::string> texts[]{std::make_pair(std::string("ascii"), ascii_text(64 * 1024)), std::make_pair(std::string("mixed"), mixed_text(64 * 1024))};
+  const Term::Private::Utf8Kernel           detected{Term::Private::utf8_kernel()};
+  const Term::Private::Utf8Kernel           kernels[]{Term::Private::Utf8Kernel::Scalar, Term::Private::Utf8Kernel::Sse2, Term::Private::Utf8Kernel::Avx2, Term::Private::Utf8Kernel::Neon};
+  for(std::size_t text = 0; text != sizeof(texts) / sizeof(texts[0]); ++text)
+  {
+    const std::string    utf8{texts[text].second};
+    const std::u32string utf32{Term::Private::utf8_to_utf32(utf8)};
+    runner.run(
+      "unicode/utf8_to_utf32/" + texts[text].first,
+      [&utf8](const std::uint64_t& iterations)
+      {
+        for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(Term::Private::utf8_to_utf32(utf8)); }
+      },
+      static_cast<double>(utf8.size()));
+    runner.run(
+      "unicode/utf8_to_utf32/" + texts[text].first + "/legacy",
+      [&utf8](const std::uint64_t& iterations)
+      {
+        for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(Legacy::utf8_to_utf32(utf8)); }
+      },
+      static_cast<double>(utf8.size()));
+    for(std::size_t kernel = 0; kernel != sizeof(kernels) / sizeof(kernels[0]); ++kernel)
+    {
+      if(!Term::Private::set_utf8_kernel(kernels[kernel])) { continue; }
+      runner.run(
+        "unicode/utf8_to_utf32/" + texts[text].first + "/" + utf8_kernel_name(kernels[kernel]),
+        [&utf8](const std::uint64_t& iterations)
+        {
+          for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(Term::Private::utf8_to_utf32(utf8)); }
+        },
+        static_cast<double>(utf8.size()));
+    }
+    Term::Private::set_utf8_kernel(detected);
+    runner.run(
+      "unicode/is_valid_utf8/" + texts[text].first,
+      [&utf8](const std::uint64_t& iterations)
+      {
+        for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(Term::Private::is_valid_utf8(utf8.begin(), utf8.end())); }
+      },
+      static_cast<double>(utf8.size()));
+    runner.run(
+      "unicode/utf32_to_utf8/" + texts[text].first,
+      [&utf32](const std::uint64_t& iterations)
+      {
+        for(std::uint64_t i = 0; i != iterations; ++i) { Bench::do_not_optimize(Term::Private::utf32_to_utf8(utf32)); }
+      },
+      static_cast<double>(utf8.size()));
+  }
+}
+
+void event_benchmarks(Bench::Runner& runner)
+{
+  const std::vector<std::string> corpus{input_corpus()};
+  std::size_t                    bytes{0};
+  for(std::size_t i = 0; i != corpus.size(); ++i) { bytes += corpus[i].size(); }
+  runner.run(
+    "event/parse/corpus",
+    [&corpus](const std::uint64_t& iterations)
+    {
+      for(std::uint64_t i = 0; i != iterations; ++i)
+      {
+        for(std::size_t j = 0; j != corpus.size(); ++j) { Bench::do_not_optimize(Term::Event(corpus[j])); }
+      }
+    },
+    static_cast<double>(bytes));
+}
+
+void queue_benchmarks(Bench::Runner& runner)
+{
+  runner.run("blocking_queue/push_pop",
+             [](const std::uint64_t& iterations)
+             {
+               Term::Private::BlockingQueue queue;
+               const Term::Event            event{Term::Key(Term::Key::Value::a)};
+               for(std::uint64_t i = 0; i != iterations; ++i)
+               {
+                 queue.push(event);
+                 Bench::do_not_optimize(queue.pop());
+               }
+             });
+  runner.run("blocking_queue/producer_consumer",
+             [](const std::uint64_t& iterations)
+             {
+               Term::Private::BlockingQueue queue;
+               std::thread                  producer(
+                 [&queue, &iterations]()
+                 {
+                   const Term::Event event{Term::Key(Term::Key::Value::a)};
+                   for(std::uint64_t i = 0; i != iterations; ++i) { queue.push(event); }
+                 });
+               for(std::uint64_t i = 0; i != iterations; ++i)
+               {
+                 while(queue.empty()) { std::this_thread::yield(); }
+                 Bench::do_not_optimize(queue.pop());
+               }
+               producer.join();
+             });
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  std::string json;
+  std::string filter;
+  long        min_time{250};
+  long        samples{5};
+  for(int i = 1; i < argc; ++i)
+  {
+    const std::string argument{argv[i]};
+    if(argument == "--help" || argument == "-h")
+    {
+      usage(argv[0]);
+      return EXIT_SUCCESS;
+    }
+    if(i + 1 == argc)
+    {
+      usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+    if(argument == "--json") { json = argv[++i]; }
+    else if(argument == "--filter") { filter = argv[++i]; }
+    else if(argument == "--min-time") { min_time = std::strtol(argv[++i], nullptr, 10); }
+    else if(argument == "--samples") { samples = std::strtol(argv[++i], nullptr, 10); }
+    else
+    {
+      usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  // Detect the color mode like a program running in this terminal would, the escape sequences depend on it
+  const Term::Terminfo terminfo;
+  Bench::Runner        runner(std::chrono::milliseconds(std::max(1L, min_time)), static_cast<std::size_t>(std::max(1L, samples)), filter);
+  render_benchmarks(runner);
+  color_benchmarks(runner);
+  image_benchmarks(runner);
+  canvas_benchmarks(runner);
+  graphics_benchmarks(runner);
+  prompt_benchmarks(runner);
+  history_benchmarks(runner);
+  completion_benchmarks(runner);
+  highlight_benchmarks(runner);
+  textbuffer_benchmarks(runner);
+  pager_benchmarks(runner);
+  search_benchmarks(runner);
+  table_benchmarks(runner);
+  unicode_benchmarks(runner);
+  event_benchmarks(runner);
+  queue_benchmarks(runner);
+
+  std::vector<std::pair<std::string, std::string>> context;
+  context.push_back(std::make_pair("version", Term::Version::string()));
+  context.push_back(std::make_pair("color_mode", color_mode()));
+  context.push_back(std::make_pair("utf8_kernel", utf8_kernel_name(Term::Private::utf8_kernel())));
+#if defined(__clang__)
+  context.push_back(std::make_pair("compiler", std::string("clang ") + __clang_version__));
+#elif defined(__GNUC__)
+  context.push_back(std::make_pair("compiler", std::string("gcc ") + __VERSION__));
+#elif defined(_MSC_VER)
+  context.push_back(std::make_pair("compiler", "msvc " + std::to_string(_MSC_VER)));
+#endif
+#if defined(NDEBUG)
+  context.push_back(std::make_pair("assertions", "off"));
+#else
+  context.push_back(std::make_pair("assertions", "on"));
+#endif
+  context.push_back(std::make_pair("min_time_ms", std::to_string(min_time)));
+  context.push_back(std::make_pair("samples", std::to_string(samples)));
+
+  if(json != "-") { runner.write_table(std::cout); }
+  if(json == "-") { runner.write_json(std::cout, context); }
+  else if(!json.empty())
+  {
+    std::ofstream file(json.c_str());
+    if(!file)
+    {
+      std::cerr << "Can't open " << json << '\n';
+      return EXIT_FAILURE;
+    }
+    runner.write_json(file, context);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,249 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+// Drive an interactive program through a pseudo terminal, press keys and measure how long the frame showing each key takes to reach the tty.
+// The pseudo terminal is emulated with Term::Emulator so cursor position queries are answered like a real terminal would.
+
+#include "cpp-terminal/emulator.hpp"
+#include "cpp-terminal/instrumentation.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <poll.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/ioctl.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+std::uint64_t nanoseconds(const Clock::duration& duration) { return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()); }
+
+class Pty
+{
+public:
+  Pty(const std::vector<std::string>& command, const std::size_t& rows, const std::size_t& columns) : m_emulator(rows, columns)
+  {
+    m_master = ::posix_openpt(O_RDWR | O_NOCTTY);
+    if(m_master == -1 || ::grantpt(m_master) == -1 || ::unlockpt(m_master) == -1) { throw std::runtime_error("posix_openpt() failed"); }
+    const std::string slave{::ptsname(m_master)};
+    m_pid = ::fork();
+    if(m_pid == -1) { throw std::runtime_error("fork() failed"); }
+    if(m_pid == 0)
+    {
+      // Child: new session with the slave as controlling terminal, like a terminal emulator does
+      ::setsid();
+      const int fd{::open(slave.c_str(), O_RDWR)};
+      if(fd == -1) { ::_exit(127); }
+      ::ioctl(fd, TIOCSCTTY, 0);
+      ::winsize size;
+      std::memset(&size, 0, sizeof(size));
+      size.ws_row = static_cast<unsigned short>(rows);
+      size.ws_col = static_cast<unsigned short>(columns);
+      ::ioctl(fd, TIOCSWINSZ, &size);
+      ::dup2(fd, 0);
+      ::dup2(fd, 1);
+      ::dup2(fd, 2);
+      if(fd > 2) { ::close(fd); }
+      ::setenv("TERM", "xterm-256color", 1);
+      ::setenv("CPPTERMINAL_LATENCY_REPORT", "1", 1);
+      std::vector<char*> arguments;
+      for(std::size_t i = 0; i != command.size(); ++i) { arguments.push_back(const_cast<char*>(command[i].c_str())); }
+      arguments.push_back(nullptr);
+      ::execvp(arguments[0], &arguments[0]);
+      ::_exit(127);
+    }
+    ::fcntl(m_master, F_SETFL, ::fcntl(m_master, F_GETFL) | O_NONBLOCK);
+  }
+
+  ~Pty()
+  {
+    if(m_pid > 0 && ::waitpid(m_pid, nullptr, WNOHANG) == 0)
+    {
+      ::kill(m_pid, SIGKILL);
+      ::waitpid(m_pid, nullptr, 0);
+    }
+    ::close(m_master);
+  }
+
+  Pty(const Pty&)            = delete;
+  Pty(Pty&&)                 = delete;
+  Pty& operator=(const Pty&) = delete;
+  Pty& operator=(Pty&&)      = delete;
+
+  void write(const std::string& bytes)
+  {
+    std::size_t written{0};
+    while(written != bytes.size())
+    {
+      const ::ssize_t ret{::write(m_master, bytes.data() + written, bytes.size() - written)};
+      if(ret > 0) { written += static_cast<std::size_t>(ret); }
+      else if(ret == -1 && errno != EAGAIN && errno != EINTR) { throw std::runtime_error("write() failed"); }
+    }
+  }
+
+  ///
+  /// Read the output until nothing arrives for \b quiet . Returns the arrival time of the first and last bytes (or \b false if nothing came before \b timeout ).
+  ///
+  bool read_burst(const std::chrono::milliseconds& quiet, const std::chrono::milliseconds& timeout, Clock::time_point& first, Clock::time_point& last)
+  {
+    bool                    received{false};
+    const Clock::time_point deadline{Clock::now() + timeout};
+    while(true)
+    {
+      const Clock::time_point now{Clock::now()};
+      if(!received && now >= deadline) { return false; }
+      const std::chrono::milliseconds wait{received ? quiet : std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now)};
+      ::pollfd                        output;
+      output.fd      = m_master;
+      output.events  = POLLIN;
+      output.revents = 0;
+      if(::poll(&output, 1, static_cast<int>(wait.count())) <= 0) { return received; }
+      char            buffer[65536];
+      const ::ssize_t ret{::read(m_master, buffer, sizeof(buffer))};
+      if(ret <= 0) { return received; }  // EIO: the child closed the tty
+      last = Clock::now();
+      if(!received) { first = last; }
+      received = true;
+      m_output.append(buffer, static_cast<std::size_t>(ret));
+      m_emulator.feed(buffer, static_cast<std::size_t>(ret));
+      const std::string responses{m_emulator.responses()};
+      if(!responses.empty()) { write(responses); }
+    }
+  }
+
+  int wait()
+  {
+    int status{0};
+    if(::waitpid(m_pid, &status, 0) == m_pid) { m_pid = -1; }
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+  }
+
+  const std::string& output() const { return m_output; }
+
+private:
+  int            m_master{-1};
+  ::pid_t        m_pid{-1};
+  Term::Emulator m_emulator;
+  std::string    m_output;
+};
+
+void usage(const char* name)
+{
+  std::cout << "Usage: " << name << " [--keys N] [--json FILE] [--] [PROGRAM [ARGS...]]\n"
+            << "  Runs PROGRAM (default: the menu example) in a pseudo terminal, presses N arrow keys (default 200)\n"
+            << "  and reports how long each resulting frame takes to reach the terminal.\n";
+}
+
+std::string microseconds(const std::uint64_t& value)
+{
+  std::ostringstream ret;
+  ret << std::fixed << std::setprecision(1) << static_cast<double>(value) / 1000.0;
+  return ret.str();
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  std::size_t              keys{200};
+  std::string              json;
+  std::vector<std::string> command;
+  for(int i = 1; i < argc; ++i)
+  {
+    const std::string argument{argv[i]};
+    if(!command.empty() || argument == "--")
+    {
+      if(argument != "--" || !command.empty()) { command.push_back(argument); }
+    }
+    else if(argument == "--help" || argument == "-h")
+    {
+      usage(argv[0]);
+      return EXIT_SUCCESS;
+    }
+    else if(argument == "--keys" && i + 1 < argc) { keys = static_cast<std::size_t>(std::strtoul(argv[++i], nullptr, 10)); }
+    else if(argument == "--json" && i + 1 < argc) { json = argv[++i]; }
+    else { command.push_back(argument); }
+  }
+#if defined(CPPTERMINAL_LATENCY_DEFAULT_PROGRAM)
+  if(command.empty()) { command.push_back(CPPTERMINAL_LATENCY_DEFAULT_PROGRAM); }
+#endif
+  if(command.empty())
+  {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    Pty               pty(command, 40, 120);
+    Clock::time_point first;
+    Clock::time_point last;
+    if(!pty.read_burst(std::chrono::milliseconds(300), std::chrono::seconds(10), first, last)) { throw std::runtime_error("no output from " + command[0]); }
+    Term::LatencyHistogram first_byte;
+    Term::LatencyHistogram full_frame;
+    std::size_t            bytes{pty.output().size()};
+    std::size_t            missed{0};
+    for(std::size_t i = 0; i != keys; ++i)
+    {
+      // Go down then up so every key changes the selection
+      const Clock::time_point pressed{Clock::now()};
+      pty.write((i / 9) % 2 == 0 ? "\u001b[B" : "\u001b[A");
+      if(!pty.read_burst(std::chrono::milliseconds(20), std::chrono::seconds(2), first, last))
+      {
+        ++missed;
+        continue;
+      }
+      first_byte.record(nanoseconds(first - pressed));
+      full_frame.record(nanoseconds(last - pressed));
+    }
+    bytes = pty.output().size() - bytes;
+    pty.write("q");
+    pty.read_burst(std::chrono::milliseconds(200), std::chrono::seconds(2), first, last);
+    const int status{pty.wait()};
+    // The program's own measurement (Term::FrameLatency), if it printed one
+    std::string       internal;
+    const std::size_t found{pty.output().rfind("frames: ")};
+    if(found != std::string::npos) { internal = pty.output().substr(found, pty.output().find_first_of("\r\n", found) - found); }
+
+    std::cout << "program:            " << command[0] << " (exit status " << status << ")\n"
+              << "keys:               " << keys << " (" << missed << " without a frame)\n"
+              << "bytes per frame:    " << (keys == missed ? 0 : bytes / (keys - missed)) << '\n'
+              << "key-to-first-byte:  p50 " << microseconds(first_byte.percentile(50)) << "us, p99 " << microseconds(first_byte.percentile(99)) << "us, max " << microseconds(first_byte.max()) << "us\n"
+              << "key-to-full-frame:  p50 " << microseconds(full_frame.percentile(50)) << "us, p99 " << microseconds(full_frame.percentile(99)) << "us, max " << microseconds(full_frame.max()) << "us\n";
+    if(!internal.empty()) { std::cout << "in-process:         " << internal << '\n'; }
+    if(!json.empty())
+    {
+      std::ofstream file(json.c_str());
+      file << "{\n  \"program\": \"" << command[0] << "\",\n  \"keys\": " << keys << ",\n  \"missed\": " << missed << ",\n  \"bytes\": " << bytes << ",\n"
+           << "  \"first_byte_ns\": {\"p50\": " << first_byte.percentile(50) << ", \"p99\": " << first_byte.percentile(99) << ", \"max\": " << first_byte.max() << "},\n"
+           << "  \"full_frame_ns\": {\"p50\": " << full_frame.percentile(50) << ", \"p99\": " << full_frame.percentile(99) << ", \"max\": " << full_frame.max() << "}\n}\n";
+    }
+    return missed == keys ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+  catch(const std::exception& exception)
+  {
+    std::cerr << "cpp-terminal-latency: " << exception.what() << '\n';
+    return EXIT_FAILURE;
+  }
+}
@@ -11,8 +11,10 @@
 
 #include "cpp-terminal/options.hpp"
 #include "cpp-terminal/private/file.hpp"
+#include "cpp-terminal/private/unicode.hpp"
 #include "cpp-terminal/terminal.hpp"
 
+#include <algorithm>
 #include <cstddef>
 
 static std::string replace(const Term::Buffer::int_type& c)
@@ -37,6 +39,12 @@ static bool newline_sequence(const std::string& str)  //https://en.wikipedia.org
     return false;
 }
 
+static void erase_codepoint(std::string& str)
+{
+  while(!str.empty() && (static_cast<unsigned char>(str.back()) & 0xC0) == 0x80) { str.pop_back(); }
+  if(!str.empty()) { str.pop_back(); }
+}
+
 int Term::Buffer::sync()
 {
   const int ret = Term::Private::out.write(m_buffer);
@@ -68,37 +76,40 @@ Term::Buffer::int_type Term::Buffer::underflow()
   try
   {
     //TODO Maybe use input function ?
+    // Characters split between two reads are completed before being echoed or erased
+    static Term::Private::Utf8Decoder decoder;
     m_buffer.clear();
     if(terminal.getOptions().has(Option::Raw))
     {
       do {
-        std::string ret{Term::Private::in.read()};
-        if(!ret.empty())
+        const std::string ret{decoder.complete(Term::Private::in.read())};
+        if(ret.empty() || ret[0] == '\033') { continue; }  // For now if it's escape sequence do nothing
+        std::string echo;
+        for(std::size_t i = 0; i < ret.size();)
         {
-          if(ret[0] == '\x7f' || ret[0] == '\b')
-          {
-            Term::Private::out.write("\b \b");  //Backspace is DEL, CTRL+Backspace is Backspace '\b'
-            if(!m_buffer.empty()) m_buffer.erase(m_buffer.size() - 1);
-          }
-          else if(ret[0] == '\033')
+          const unsigned char c{static_cast<unsigned char>(ret[i])};
+          const std::size_t   size{std::max<std::size_t>(1, std::min(Term::Private::utf8_codepoint_size(c), ret.size() - i))};
+          if(c == '\x7f' || c == '\b')
           {
-            continue;  // For now if it's escape sequence do nothing
+            echo += "\b \b";  //Backspace is DEL, CTRL+Backspace is Backspace '\b'
+            erase_codepoint(m_buffer);
           }
-          else if(ret[0] <= 31 && ret[0] != '\t' && ret[0] != '\b' && ret[0] != 127 && ret[0] != ' ' && ret[0] != '\n' && ret[0] != '\r') { continue; }
+          else if(c <= 31 && c != '\t' && c != '\n' && c != '\r') {}
           else
           {
-            Term::Private::out.write(ret);
-            m_buffer += ret;
+            echo.append(ret, i, size);
+            m_buffer.append(ret, i, size);
           }
+          i += size;
         }
+        Term::Private::out.write(echo);
       } while(m_buffer.empty() || !newline_sequence(m_buffer));
       Term::Private::out.write('\n');
     }
     else
     {
       do {
-        std::string ret{Term::Private::in.read()};
-        m_buffer += ret;
+        m_buffer += decoder.complete(Term::Private::in.read());
       } while(m_buffer.empty());
     }
     setg(&m_buffer[0], &m_buffer[0], &m_buffer[0] + m_buffer.size());
@@ -0,0 +1,172 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/canvas.hpp"
+
+#include "cpp-terminal/window.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+
+// Bit of the dot (x % 2, y % 4) in a braille character: dots 1 2 3 7 on the left column, 4 5 6 8 on the right one
+const constexpr std::uint8_t dots[4][2]{
+  {0x01, 0x08},
+  {0x02, 0x10},
+  {0x04, 0x20},
+  {0x40, 0x80}
+};
+
+// Bits of the dots of both columns of a cell row
+const constexpr std::uint8_t row_dots[4]{0x09, 0x12, 0x24, 0xC0};
+
+std::uint64_t ceil_div(const std::uint64_t& numerator, const std::uint64_t& denominator) { return (numerator + denominator - 1) / denominator; }
+
+// The offsets from start, going forward or backward, of the coordinates in [0, size): [first, last], false if there is none
+bool on_canvas(const std::uint64_t& start, const bool& forward, const std::uint64_t& size, std::uint64_t& first, std::uint64_t& last)
+{
+  if(size == 0 || (forward && start >= size)) { return false; }
+  first = forward || start < size ? 0 : start - size + 1;
+  last  = forward ? size - 1 - start : start;
+  return true;
+}
+
+}  // namespace
+
+Term::Canvas::Canvas(const std::size_t& columns, const std::size_t& rows) : m_columns(columns), m_rows(rows), m_cells(columns * rows, 0) {}
+
+std::size_t Term::Canvas::columns() const { return m_columns; }
+
+std::size_t Term::Canvas::rows() const { return m_rows; }
+
+std::size_t Term::Canvas::width() const { return 2 * m_columns; }
+
+std::size_t Term::Canvas::height() const { return 4 * m_rows; }
+
+bool Term::Canvas::get(const std::size_t& x, const std::size_t& y) const
+{
+  if(x >= width() || y >= height()) { return false; }
+  return (m_cells[(y / 4) * m_columns + x / 2] & dots[y % 4][x % 2]) != 0;
+}
+
+void Term::Canvas::set(const std::size_t& x, const std::size_t& y)
+{
+  if(x < width() && y < height()) { m_cells[(y / 4) * m_columns + x / 2] |= dots[y % 4][x % 2]; }
+}
+
+void Term::Canvas::unset(const std::size_t& x, const std::size_t& y)
+{
+  if(x < width() && y < height()) { m_cells[(y / 4) * m_columns + x / 2] &= static_cast<std::uint8_t>(~dots[y % 4][x % 2]); }
+}
+
+void Term::Canvas::clear() { std::fill(m_cells.begin(), m_cells.end(), 0); }
+
+void Term::Canvas::line(const std::size_t& x0, const std::size_t& y0, const std::size_t& x1, const std::size_t& y1)
+{
+  // Far enough to keep the products below in range, the slope is unchanged for any sensible coordinate
+  const std::uint64_t limit{std::uint64_t{1} << 31};
+  const std::uint64_t x{std::min<std::uint64_t>(x0, limit)};
+  const std::uint64_t y{std::min<std::uint64_t>(y0, limit)};
+  const std::uint64_t end_x{std::min<std::uint64_t>(x1, limit)};
+  const std::uint64_t end_y{std::min<std::uint64_t>(y1, limit)};
+  const std::uint64_t dx{end_x > x ? end_x - x : x - end_x};
+  const std::uint64_t dy{end_y > y ? end_y - y : y - end_y};
+  // Bresenham steps once along the major axis at each dot, the minor offset of the dot n is floor((2 n minor + major) / (2 major)).
+  // The dots on the canvas are found from that, so only they are walked whatever the length of the segment.
+  const bool          x_major{dx >= dy};
+  const std::uint64_t start{x_major ? x : y};
+  const std::uint64_t start_minor{x_major ? y : x};
+  const bool          forward{x_major ? end_x > x : end_y > y};
+  const bool          forward_minor{x_major ? end_y > y : end_x > x};
+  const std::uint64_t major{x_major ? dx : dy};
+  const std::uint64_t minor{x_major ? dy : dx};
+  std::uint64_t       first{0};
+  std::uint64_t       last{0};
+  std::uint64_t       minor_first{0};
+  std::uint64_t       minor_last{0};
+  if(!on_canvas(start, forward, x_major ? width() : height(), first, last) || !on_canvas(start_minor, forward_minor, x_major ? height() : width(), minor_first, minor_last)) { return; }
+  last = std::min(last, major);
+  if(minor == 0)
+  {
+    if(minor_first != 0) { return; }
+  }
+  else
+  {
+    if(minor_first != 0) { first = std::max(first, ceil_div((2 * minor_first - 1) * major, 2 * minor)); }
+    last = std::min(last, ceil_div((2 * minor_last + 1) * major, 2 * minor) - 1);
+  }
+  if(first > last) { return; }
+  const std::uint64_t twice_major{2 * std::max<std::uint64_t>(major, 1)};
+  std::uint64_t       offset{(2 * first * minor + major) / twice_major};
+  std::uint64_t       rest{(2 * first * minor + major) % twice_major};
+  for(std::uint64_t n = first;; ++n)
+  {
+    const std::uint64_t along{forward ? start + n : start - n};
+    const std::uint64_t across{forward_minor ? start_minor + offset : start_minor - offset};
+    set(static_cast<std::size_t>(x_major ? along : across), static_cast<std::size_t>(x_major ? across : along));
+    if(n == last) { return; }
+    rest += 2 * minor;
+    if(rest >= twice_major)
+    {
+      rest -= twice_major;
+      ++offset;
+    }
+  }
+}
+
+void Term::Canvas::rectangle(const std::size_t& x0, const std::size_t& y0, const std::size_t& x1, const std::size_t& y1, bool fill)
+{
+  const std::size_t left{std::min(x0, x1)};
+  const std::size_t top{std::min(y0, y1)};
+  const std::size_t right{std::max(x0, x1)};
+  const std::size_t bottom{std::max(y0, y1)};
+  if(!fill)
+  {
+    line(left, top, right, top);
+    line(left, bottom, right, bottom);
+    line(left, top, left, bottom);
+    line(right, top, right, bottom);
+    return;
+  }
+  if(left >= width() || top >= height()) { return; }
+  const std::size_t last_x{std::min(right, width() - 1)};
+  const std::size_t last_y{std::min(bottom, height() - 1)};
+  // A byte per cell: the cells fully covered horizontally get both columns of dots at once
+  for(std::size_t y = top; y <= last_y; ++y)
+  {
+    std::uint8_t* cells{&m_cells[(y / 4) * m_columns]};
+    std::size_t   x{left};
+    if(x % 2 == 1) { cells[x++ / 2] |= dots[y % 4][1]; }
+    for(; x + 1 <= last_x; x += 2) { cells[x / 2] |= row_dots[y % 4]; }
+    if(x == last_x) { cells[x / 2] |= dots[y % 4][0]; }
+  }
+}
+
+void Term::Canvas::draw(Term::Window& window, const std::size_t& column, const std::size_t& row) const { draw(window, column, row, nullptr); }
+
+void Term::Canvas::draw(Term::Window& window, const std::size_t& column, const std::size_t& row, const Term::Color& color) const { draw(window, column, row, &color); }
+
+void Term::Canvas::draw(Term::Window& window, const std::size_t& column, const std::size_t& row, const Term::Color* color) const
+{
+  if(column == 0 || row == 0) { return; }
+  const std::size_t columns{column > window.get_w() ? 0 : std::min(m_columns, window.get_w() - column + 1)};
+  const std::size_t rows{row > window.get_h() ? 0 : std::min(m_rows, window.get_h() - row + 1)};
+  for(std::size_t j = 0; j != rows; ++j)
+  {
+    const std::uint8_t* cells{&m_cells[j * m_columns]};
+    for(std::size_t i = 0; i != columns; ++i)
+    {
+      if(cells[i] == 0) { continue; }
+      window.set_char(column + i, row + j, static_cast<char32_t>(0x2800 + cells[i]));
+      if(color != nullptr) { window.set_fg(column + i, row + j, *color); }
+    }
+  }
+}
@@ -0,0 +1,70 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include "cpp-terminal/color.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Term
+{
+
+class Window;
+
+///
+/// @brief Monochrome bitmap of 2x4 dots per cell, drawn in a \b Window with the braille characters (U+2800 to U+28FF).
+///
+/// Dots are addressed by (\b x , \b y ) from the top left corner, \b x in [0, 2 * columns) and \b y in [0, 4 * rows). Dots outside the canvas are ignored, so shapes are clipped.
+/// Each cell is stored as one byte in the bit order of the braille block, drawing it is a single addition to U+2800.
+///
+class Canvas
+{
+public:
+  Canvas(const std::size_t& columns, const std::size_t& rows);
+  std::size_t columns() const;
+  std::size_t rows() const;
+  std::size_t width() const;
+  std::size_t height() const;
+
+  bool get(const std::size_t& x, const std::size_t& y) const;
+  void set(const std::size_t& x, const std::size_t& y);
+  void unset(const std::size_t& x, const std::size_t& y);
+  void clear();
+
+  ///
+  /// @brief Set the dots of the segment from (\b x0 , \b y0 ) to (\b x1 , \b y1 ), both included (Bresenham).
+  ///
+  void line(const std::size_t& x0, const std::size_t& y0, const std::size_t& x1, const std::size_t& y1);
+
+  ///
+  /// @brief Set the dots of the border of the rectangle with corners (\b x0 , \b y0 ) and (\b x1 , \b y1 ), or all of them if \b fill .
+  ///
+  void rectangle(const std::size_t& x0, const std::size_t& y0, const std::size_t& x1, const std::size_t& y1, bool fill = false);
+
+  ///
+  /// @brief Write the cells having at least one dot in \b window , the top left cell at (\b column , \b row ). Empty cells leave the window untouched and cells outside of it are skipped.
+  ///
+  void draw(Term::Window& window, const std::size_t& column, const std::size_t& row) const;
+
+  ///
+  /// @brief Same, with \b color as the foreground color of the cells written.
+  ///
+  void draw(Term::Window& window, const std::size_t& column, const std::size_t& row, const Term::Color& color) const;
+
+private:
+  void                      draw(Term::Window& window, const std::size_t& column, const std::size_t& row, const Term::Color* color) const;
+  std::size_t               m_columns{0};
+  std::size_t               m_rows{0};
+  std::vector<std::uint8_t> m_cells;
+};
+
+}  // namespace Term
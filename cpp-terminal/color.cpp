@@ -9,8 +9,21 @@
 
 #include "cpp-terminal/color.hpp"
 
+#include "cpp-terminal/private/palette_table.hpp"
 #include "cpp-terminal/terminfo.hpp"
 
+namespace
+{
+
+namespace Palette = Term::Private::Palette;
+
+// Lookups in the tables of the 24bit colors
+std::uint8_t nearest_8bits(const std::uint8_t& red, const std::uint8_t& green, const std::uint8_t& blue) { return Palette::bit24_to_bit8[(static_cast<std::size_t>(Palette::level[red]) * Palette::levels + Palette::level[green]) * Palette::levels + Palette::level[blue]]; }
+
+Term::Color::Name nearest_4bits(const std::uint8_t& red, const std::uint8_t& green, const std::uint8_t& blue) { return static_cast<Term::Color::Name>(Palette::bit24_to_bit4[(static_cast<std::size_t>(red >> Palette::bits4) << (2 * Palette::bits4)) | (static_cast<std::size_t>(green >> Palette::bits4) << Palette::bits4) | static_cast<std::size_t>(blue >> Palette::bits4)]); }
+
+}  // namespace
+
 bool Term::Color::operator==(const Term::Color& color) const
 {
   if(color.getType() != getType()) { return false; }
@@ -44,67 +57,46 @@ Term::Color::Name Term::Color::to3bits() const
   return ret;
 }
 
-// Convert 24bits and 8bits to 4bits
+// Convert 24bits and 8bits to 4bits: nearest color in the OKLab space
 Term::Color::Name Term::Color::to4bits() const
 {
-  //https://ajalt.github.io/colormath/converter/
-  // clang-format off
-  static const constexpr std::array<std::uint8_t,256> table ={{
-    0,  1,  2,  3,  4,  5,  6,  7,  60, 61, 62, 63, 64, 65, 66, 67, 0,  4,  4,  4,  64, 64, 2,  6,  4,  4,  64, 64, 2,  2,  6,  4,  64, 64, 2,  2,  2,  6,  64, 64, 62, 62, 62, 62, 66, 64, 62, 62, 62, 62, 62, 66,
-    1,  5,  4,  4,  64, 64, 3,  60, 4,  4,  64, 64, 2,  2,  6,  4,  64, 64, 2,  2,  2,  6,  64, 64, 62, 62, 62, 62, 66, 64, 62, 62, 62, 62, 62, 66, 1,  1,  5,  4,  64, 64, 1,  1,  5,  4,  64, 64, 3,  3,  60, 4,
-    64, 64, 2,  2,  2,  6,  64, 64, 62, 62, 62, 62, 66, 64, 62, 62, 62, 62, 62, 66, 1,  1,  1,  5,  64, 64, 1,  1,  1,  5,  64, 64, 1,  1,  1,  5,  64, 64, 3,  3,  3,  7,  64, 64, 62, 62, 62, 62, 66, 64, 62, 62,
-    62, 62, 62, 66, 61, 61, 61, 61, 65, 64, 61, 61, 61, 61, 65, 64, 61, 61, 61, 61, 65, 64, 61, 61, 61, 61, 65, 64, 63, 63, 63, 63, 7,  64, 62, 62, 62, 62, 62, 66, 61, 61, 61, 61, 61, 65, 61, 61, 61, 61, 61, 65,
-    61, 61, 61, 61, 61, 65, 61, 61, 61, 61, 61, 65, 61, 61, 61, 61, 61, 65, 63, 63, 63, 63, 63, 67, 0,  0,  0,  0,  0,  0,  60, 60, 60, 60, 60, 60, 7,  7,  7,  7,  7,  7,  67, 67, 67, 67, 67, 67}};
-  // clang-format on
-  if((getType() == Term::Color::Type::Bit24) || (getType() == Term::Color::Type::Bit8)) { return static_cast<Term::Color::Name>(table[to8bits()]); }
+  if(getType() == Term::Color::Type::Bit24) { return nearest_4bits(m_bit24[0], m_bit24[1], m_bit24[2]); }
+  if(getType() == Term::Color::Type::Bit8) { return static_cast<Term::Color::Name>(Palette::bit8_to_bit4[m_bit8]); }
   return static_cast<Term::Color::Name>(m_bit8);
 }
 
-// Convert 24bits to 8bits
+// Convert 24bits to 8bits: nearest color of the 6x6x6 cube and the grayscale ramp in the OKLab space
 std::uint8_t Term::Color::to8bits() const
 {
-  if(getType() == Term::Color::Type::Bit24)
-  {
-    // check gray scale in 24 steps
-    if(m_bit24[0] == m_bit24[1] && m_bit24[0] == m_bit24[2]) { return static_cast<std::uint8_t>(232 + m_bit24[0] / 32 + m_bit24[1] / 32 + m_bit24[2] / 32); }
-    // normal color space
-    return static_cast<std::uint8_t>(16 + 36 * (m_bit24[0] / 51) + 6 * (m_bit24[1] / 51) + (m_bit24[2] / 51));
-  }
+  if(getType() == Term::Color::Type::Bit24) { return nearest_8bits(m_bit24[0], m_bit24[1], m_bit24[2]); }
   return m_bit8;
 }
 
 // Nothing to do
 std::array<std::uint8_t, 3> Term::Color::to24bits() const { return m_bit24; }
 
+void Term::to8bits(const std::uint8_t* rgb, const std::size_t& count, std::uint8_t* colors)
+{
+  // Four table lookups per pixel and nothing to compute: SIMD gathers would not be faster
+  for(std::size_t i = 0; i != count; ++i, rgb += 3) { colors[i] = nearest_8bits(rgb[0], rgb[1], rgb[2]); }
+}
+
+void Term::to4bits(const std::uint8_t* rgb, const std::size_t& count, Term::Color::Name* colors)
+{
+  for(std::size_t i = 0; i != count; ++i, rgb += 3) { colors[i] = nearest_4bits(rgb[0], rgb[1], rgb[2]); }
+}
+
 std::string Term::color_bg(const Term::Color::Name& color) { return color_bg(Color(color)); }
 
 std::string Term::color_bg(const std::uint8_t& color) { return color_bg(Color(color)); }
 
 std::string Term::color_bg(const std::uint8_t& r, const std::uint8_t& g, const std::uint8_t& b) { return color_bg(Color(r, g, b)); }
 
-//https://unix.stackexchange.com/questions/212933/background-color-whitespace-when-end-of-the-terminal-reached
-//FIX maybe we need an other function without [K if we want to modify background of part of the screen (Moving cursor and changing color )
 std::string Term::color_bg(const Color& color)
 {
-  if(color.getType() == Term::Color::Type::Unset || color.getType() == Term::Color::Type::NoColor) return "";
-  switch(Term::Terminfo::getColorMode())
-  {
-    case Term::Terminfo::ColorMode::Unset:
-    case Term::Terminfo::ColorMode::NoColor: return {};
-    case Term::Terminfo::ColorMode::Bit3: return "\u001b[" + std::to_string(static_cast<uint8_t>(color.to3bits()) + 40) + "m\u001b[K";
-    case Term::Terminfo::ColorMode::Bit4: return "\u001b[" + std::to_string(static_cast<uint8_t>(color.to4bits()) + 40) + "m\u001b[K";
-    case Term::Terminfo::ColorMode::Bit8:
-      if(color.getType() == Term::Color::Type::Bit4 || color.getType() == Term::Color::Type::Bit3) return "\u001b[" + std::to_string(static_cast<uint8_t>(color.to4bits()) + 40) + "m\u001b[K";
-      else
-        return "\u001b[48;5;" + std::to_string(color.to8bits()) + "m\u001b[K";
-    case Term::Terminfo::ColorMode::Bit24:
-      if(color.getType() == Term::Color::Type::Bit3 || color.getType() == Term::Color::Type::Bit4) return "\u001b[" + std::to_string(static_cast<uint8_t>(color.to4bits()) + 40) + "m\u001b[K";
-      else if(color.getType() == Term::Color::Type::Bit8)
-        return "\u001b[48;5;" + std::to_string(color.to8bits()) + "m\u001b[K";
-      else
-        return "\u001b[48;2;" + std::to_string(color.to24bits()[0]) + ';' + std::to_string(color.to24bits()[1]) + ';' + std::to_string(color.to24bits()[2]) + "m\u001b[K";
-    default: return {};
-  }
+  std::string ret;
+  append_color_bg(ret, color);
+  return ret;
 }
 
 std::string Term::color_fg(const Term::Color::Name& name) { return color_fg(Color(name)); }
@@ -115,23 +107,136 @@ std::string Term::color_fg(const std::uint8_t& red, const std::uint8_t& green, c
 
 std::string Term::color_fg(const Color& color)
 {
-  if(color.getType() == Term::Color::Type::Unset || color.getType() == Term::Color::Type::NoColor) { return {}; }
+  std::string ret;
+  append_color_fg(ret, color);
+  return ret;
+}
+
+namespace
+{
+
+// An escape sequence short enough to be stored in place
+class Sequence
+{
+public:
+  char         bytes[15];
+  std::uint8_t size{0};
+  void         append(const char* str)
+  {
+    while(*str != '\0') { bytes[size++] = *str++; }
+  }
+  void append(unsigned value)
+  {
+    if(value >= 100) { bytes[size++] = static_cast<char>('0' + value / 100); }
+    if(value >= 10) { bytes[size++] = static_cast<char>('0' + value / 10 % 10); }
+    bytes[size++] = static_cast<char>('0' + value % 10);
+  }
+};
+
+// The sequences of the 4bit (indexed by Term::Color::Name) and 8bit colors, and the decimal digits of 0-255 for the 24bit ones
+class Tables
+{
+public:
+  Tables()
+  {
+    for(unsigned i = 0; i != 256; ++i)
+    {
+      fg8[i].append("\u001b[38;5;");
+      fg8[i].append(i);
+      fg8[i].append("m");
+      //https://unix.stackexchange.com/questions/212933/background-color-whitespace-when-end-of-the-terminal-reached
+      //FIX maybe we need an other function without [K if we want to modify background of part of the screen (Moving cursor and changing color )
+      bg8[i].append("\u001b[48;5;");
+      bg8[i].append(i);
+      bg8[i].append("m\u001b[K");
+      decimal[i].append(i);
+    }
+    for(unsigned i = 0; i != 68; ++i)
+    {
+      fg4[i].append("\u001b[");
+      fg4[i].append(i + 30);
+      fg4[i].append("m");
+      bg4[i].append("\u001b[");
+      bg4[i].append(i + 40);
+      bg4[i].append("m\u001b[K");
+    }
+  }
+  Sequence fg4[68];
+  Sequence bg4[68];
+  Sequence fg8[256];
+  Sequence bg8[256];
+  Sequence decimal[256];
+};
+
+const Tables& tables()
+{
+  static const Tables ret;
+  return ret;
+}
+
+void append(std::string& out, const Sequence& sequence) { out.append(sequence.bytes, sequence.size); }
+
+void append_4bits(std::string& out, const Term::Color::Name& name, const bool& background)
+{
+  const std::uint8_t value{static_cast<std::uint8_t>(name)};
+  if(value < 68) { append(out, background ? tables().bg4[value] : tables().fg4[value]); }
+  else
+  {
+    Sequence sequence;
+    sequence.append("\u001b[");
+    sequence.append(static_cast<unsigned>(value) + (background ? 40 : 30));
+    sequence.append(background ? "m\u001b[K" : "m");
+    append(out, sequence);
+  }
+}
+
+void append_8bits(std::string& out, const std::uint8_t& value, const bool& background) { append(out, background ? tables().bg8[value] : tables().fg8[value]); }
+
+void append_24bits(std::string& out, const std::array<std::uint8_t, 3>& rgb, const bool& background)
+{
+  // \033[48;2;255;255;255m\033[K at most
+  char        buffer[32]{'\u001b', '[', background ? '4' : '3', '8', ';', '2', ';'};
+  std::size_t size{7};
+  for(std::size_t i = 0; i != 3; ++i)
+  {
+    const Sequence& digits{tables().decimal[rgb[i]]};
+    for(std::size_t j = 0; j != digits.size; ++j) { buffer[size++] = digits.bytes[j]; }
+    buffer[size++] = (i == 2) ? 'm' : ';';
+  }
+  if(background)
+  {
+    buffer[size++] = '\u001b';
+    buffer[size++] = '[';
+    buffer[size++] = 'K';
+  }
+  out.append(buffer, size);
+}
+
+void append_color(std::string& out, const Term::Color& color, const bool& background)
+{
+  if(color.getType() == Term::Color::Type::Unset || color.getType() == Term::Color::Type::NoColor) { return; }
+  const bool indexed{color.getType() == Term::Color::Type::Bit3 || color.getType() == Term::Color::Type::Bit4};
   switch(Term::Terminfo::getColorMode())
   {
-    case Term::Terminfo::ColorMode::Unset:
-    case Term::Terminfo::ColorMode::NoColor: return "";
-    case Term::Terminfo::ColorMode::Bit3: return "\u001b[" + std::to_string(static_cast<uint8_t>(color.to3bits()) + 30) + "m";
-    case Term::Terminfo::ColorMode::Bit4: return "\u001b[" + std::to_string(static_cast<uint8_t>(color.to4bits()) + 30) + "m";
+    case Term::Terminfo::ColorMode::Bit3: append_4bits(out, color.to3bits(), background); break;
+    case Term::Terminfo::ColorMode::Bit4: append_4bits(out, color.to4bits(), background); break;
     case Term::Terminfo::ColorMode::Bit8:
-      if(color.getType() == Term::Color::Type::Bit4 || color.getType() == Term::Color::Type::Bit3) return "\u001b[" + std::to_string(static_cast<uint8_t>(color.to4bits()) + 30) + "m";
-      else
-        return "\u001b[38;5;" + std::to_string(color.to8bits()) + "m";
+      if(indexed) { append_4bits(out, color.to4bits(), background); }
+      else { append_8bits(out, color.to8bits(), background); }
+      break;
     case Term::Terminfo::ColorMode::Bit24:
-      if(color.getType() == Term::Color::Type::Bit3 || color.getType() == Term::Color::Type::Bit4) return "\u001b[" + std::to_string(static_cast<uint8_t>(color.to4bits()) + 30) + "m";
-      else if(color.getType() == Term::Color::Type::Bit8)
-        return "\u001b[38;5;" + std::to_string(color.to8bits()) + "m";
-      else
-        return "\u001b[38;2;" + std::to_string(color.to24bits()[0]) + ';' + std::to_string(color.to24bits()[1]) + ';' + std::to_string(color.to24bits()[2]) + "m";
-    default: return {};
+      if(indexed) { append_4bits(out, color.to4bits(), background); }
+      else if(color.getType() == Term::Color::Type::Bit8) { append_8bits(out, color.to8bits(), background); }
+      else { append_24bits(out, color.to24bits(), background); }
+      break;
+    case Term::Terminfo::ColorMode::Unset:
+    case Term::Terminfo::ColorMode::NoColor:
+    default: break;
   }
 }
+
+}  // namespace
+
+void Term::append_color_bg(std::string& out, const Color& color) { append_color(out, color, true); }
+
+void Term::append_color_fg(std::string& out, const Color& color) { append_color(out, color, false); }
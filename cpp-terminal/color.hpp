@@ -12,6 +12,7 @@
 #include "cpp-terminal/terminfo.hpp"
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -65,7 +66,14 @@ public:
   Color(const std::uint8_t& red, const std::uint8_t& green, const std::uint8_t& blue);
   Type                        getType() const;
   Name                        to3bits() const;
+  ///
+  /// @brief Nearest 4bit color. 24bit and 8bit colors are compared in the OKLab space, which matches the perceived differences.
+  ///
   Name                        to4bits() const;
+  ///
+  /// @brief Nearest 8bit color in the OKLab space: a color of the 6x6x6 cube or of the grayscale ramp (the 16 first colors depend on the terminal theme).
+  /// @note Served from a precomputed table: each channel is rounded to the nearest level used by the palette.
+  ///
   std::uint8_t                to8bits() const;
   std::array<std::uint8_t, 3> to24bits() const;
 
@@ -78,6 +86,16 @@ private:
   };
 };
 
+///
+/// @brief Nearest 8bit color of \b count 24bit colors, like \b Color::to8bits() : \b rgb holds 3 bytes per color, \b colors gets one byte per color.
+///
+void to8bits(const std::uint8_t* rgb, const std::size_t& count, std::uint8_t* colors);
+
+///
+/// @brief Nearest 4bit color of \b count 24bit colors, like \b Color::to4bits() .
+///
+void to4bits(const std::uint8_t* rgb, const std::size_t& count, Term::Color::Name* colors);
+
 std::string color_bg(const Term::Color::Name& name);
 std::string color_bg(const std::uint8_t& value);
 std::string color_bg(const std::uint8_t& red, const std::uint8_t& green, const std::uint8_t& blue);
@@ -88,4 +106,15 @@ std::string color_fg(const std::uint8_t& value);
 std::string color_fg(const std::uint8_t& red, const std::uint8_t& green, const std::uint8_t& blue);
 std::string color_fg(const Color& color);
 
+///
+/// @brief Append the escape sequence of \b color_bg(color) to \b out .
+/// @note The sequences of the 4bit and 8bit colors are precomputed: this is a copy of a few bytes, without allocation when \b out has room.
+///
+void append_color_bg(std::string& out, const Color& color);
+
+///
+/// @brief Append the escape sequence of \b color_fg(color) to \b out .
+///
+void append_color_fg(std::string& out, const Color& color);
+
 }  // namespace Term
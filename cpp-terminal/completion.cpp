@@ -0,0 +1,159 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/completion.hpp"
+
+#include "cpp-terminal/exception.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+namespace
+{
+
+bool is_word(const char& character)
+{
+  const unsigned char byte{static_cast<unsigned char>(character)};
+  return (byte >= '0' && byte <= '9') || (byte >= 'a' && byte <= 'z') || (byte >= 'A' && byte <= 'Z') || byte == '_' || byte == '.' || byte == '$' || byte >= 0x80;
+}
+
+}  // namespace
+
+Term::Completion::Completion(const std::size_t& start, const std::vector<std::string>& candidates) : m_start(start), m_size(candidates.size())
+{
+  const std::shared_ptr<const std::vector<std::string>> shared{std::make_shared<const std::vector<std::string>>(candidates)};
+  m_candidate = [shared](const std::size_t& index) { return (*shared)[index]; };
+}
+
+Term::Completion::Completion(const std::size_t& start, const std::size_t& size, const Candidate& candidate) : m_start(start), m_size(size), m_candidate(candidate) {}
+
+std::size_t Term::Completion::start() const { return m_start; }
+
+std::size_t Term::Completion::size() const { return m_size; }
+
+bool Term::Completion::empty() const { return m_size == 0; }
+
+std::string Term::Completion::operator[](const std::size_t& index) const
+{
+  if(index >= m_size) { throw Term::Exception("Completion index out of range"); }
+  return m_candidate(index);
+}
+
+Term::Trie::Trie(std::vector<std::string> words)
+{
+  std::sort(words.begin(), words.end());
+  words.erase(std::unique(words.begin(), words.end()), words.end());
+  if(words.size() >= std::numeric_limits<std::uint32_t>::max()) { throw Term::Exception("Too many words for a Trie"); }
+  std::size_t bytes{0};
+  for(const std::string& word: words) { bytes += word.size(); }
+  m_data.reserve(bytes);
+  m_offsets.reserve(words.size() + 1);
+  for(const std::string& word: words)
+  {
+    m_data.append(word);
+    m_offsets.push_back(m_data.size());
+  }
+  if(words.empty()) { return; }
+  Node root;
+  root.end   = static_cast<std::uint32_t>(words.size());
+  root.depth = static_cast<std::uint32_t>(common_prefix(0, words.size() - 1));
+  m_nodes.push_back(root);
+  // Breadth first, the children of a node are pushed together
+  for(std::size_t i = 0; i != m_nodes.size(); ++i)
+  {
+    const Node  node{m_nodes[i]};
+    std::size_t begin{node.begin};
+    if(length(begin) == node.depth) { ++begin; }  // the word that is the prefix itself sorts first and has no child
+    m_nodes[i].first_child = static_cast<std::uint32_t>(m_nodes.size());
+    while(begin != node.end)
+    {
+      // The words with the same byte at depth are consecutive
+      const char  byte{word(begin)[node.depth]};
+      std::size_t low{begin + 1};
+      std::size_t high{node.end};
+      while(low < high)
+      {
+        const std::size_t middle{low + (high - low) / 2};
+        if(word(middle)[node.depth] == byte) { low = middle + 1; }
+        else { high = middle; }
+      }
+      Node child;
+      child.begin = static_cast<std::uint32_t>(begin);
+      child.end   = static_cast<std::uint32_t>(low);
+      child.depth = static_cast<std::uint32_t>(common_prefix(begin, low - 1));
+      m_nodes.push_back(child);
+      begin = low;
+    }
+    m_nodes[i].children = static_cast<std::uint32_t>(m_nodes.size() - m_nodes[i].first_child);
+  }
+}
+
+std::size_t Term::Trie::size() const { return m_offsets.size() - 1; }
+
+bool Term::Trie::empty() const { return m_offsets.size() == 1; }
+
+std::string Term::Trie::operator[](const std::size_t& index) const
+{
+  if(index >= size()) { throw Term::Exception("Trie index out of range"); }
+  return std::string(word(index), length(index));
+}
+
+std::pair<std::size_t, std::size_t> Term::Trie::range(const std::string& prefix) const
+{
+  if(m_nodes.empty()) { return {0, 0}; }
+  std::size_t node{0};
+  std::size_t matched{0};  // bytes of the prefix already compared
+  while(true)
+  {
+    const Node&       current{m_nodes[node]};
+    const std::size_t shared{std::min<std::size_t>(current.depth, prefix.size())};
+    if(std::memcmp(word(current.begin) + matched, prefix.data() + matched, shared - matched) != 0) { return {0, 0}; }
+    if(prefix.size() <= current.depth) { return {current.begin, current.end}; }
+    matched = current.depth;
+    const unsigned char byte{static_cast<unsigned char>(prefix[matched])};
+    std::size_t         low{current.first_child};
+    const std::size_t   last{std::size_t{current.first_child} + current.children};
+    std::size_t         high{last};
+    while(low < high)
+    {
+      const std::size_t middle{low + (high - low) / 2};
+      if(static_cast<unsigned char>(word(m_nodes[middle].begin)[current.depth]) < byte) { low = middle + 1; }
+      else { high = middle; }
+    }
+    if(low == last || static_cast<unsigned char>(word(m_nodes[low].begin)[current.depth]) != byte) { return {0, 0}; }
+    node = low;
+  }
+}
+
+Term::Completion Term::Trie::complete(const std::string& input, const std::atomic<bool>& cancelled) const
+{
+  if(cancelled) { return {}; }
+  std::size_t start{input.size()};
+  while(start != 0 && is_word(input[start - 1])) { --start; }
+  const std::pair<std::size_t, std::size_t> found{range(input.substr(start))};
+  const Term::Trie*                         trie{this};
+  const std::size_t                         first{found.first};
+  return Completion(start, found.second - found.first, [trie, first](const std::size_t& index) { return (*trie)[first + index]; });
+}
+
+const char* Term::Trie::word(const std::size_t& index) const { return m_data.data() + m_offsets[index]; }
+
+std::size_t Term::Trie::length(const std::size_t& index) const { return m_offsets[index + 1] - m_offsets[index]; }
+
+std::size_t Term::Trie::common_prefix(const std::size_t& first, const std::size_t& last) const
+{
+  const std::size_t size{std::min(length(first), length(last))};
+  const char*       lhs{word(first)};
+  const char*       rhs{word(last)};
+  std::size_t       ret{0};
+  while(ret != size && lhs[ret] == rhs[ret]) { ++ret; }
+  return ret;
+}
@@ -0,0 +1,112 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Term
+{
+
+///
+/// @brief The candidates completing the word before the cursor, they replace the input from \b start() to the cursor.
+///
+/// Candidates are produced on demand by index, so a prompt showing a few of them never builds the others.
+///
+class Completion
+{
+public:
+  using Candidate = std::function<std::string(const std::size_t&)>;
+  Completion()    = default;
+  Completion(const std::size_t& start, const std::vector<std::string>& candidates);
+  ///
+  /// @brief \b size candidates, the i-th returned by \b candidate (called on the thread reading the completion).
+  ///
+  Completion(const std::size_t& start, const std::size_t& size, const Candidate& candidate);
+
+  std::size_t start() const;
+  std::size_t size() const;
+  bool        empty() const;
+  std::string operator[](const std::size_t& index) const;
+
+private:
+  std::size_t m_start{0};
+  std::size_t m_size{0};
+  Candidate   m_candidate;
+};
+
+///
+/// @brief Provides the completions of a prompt.
+///
+/// \b complete is called on a worker thread, never twice at the same time. When the user keeps typing the request is superseded : \b cancelled becomes \b true and whatever is returned is thrown away, so slow providers should check it and return early.
+///
+class Completer
+{
+public:
+  virtual ~Completer() = default;
+  ///
+  /// @brief The completions of \b input , the text before the cursor. Exceptions are rethrown on the thread of the prompt.
+  ///
+  virtual Completion complete(const std::string& input, const std::atomic<bool>& cancelled) const = 0;
+};
+
+///
+/// @brief Completes the word before the cursor from a fixed vocabulary.
+///
+/// The words are sorted and stored back to back. The trie is a radix tree over them : each node is the range of the words sharing a prefix and branches only where they differ, so there are fewer nodes than twice the words.
+/// Finding the words starting with a prefix costs the length of the prefix (a binary search on the children of each node it crosses), whatever the size of the vocabulary, and the completion does not copy them.
+/// A word is made of letters, digits, '_', '.', '$' and non ASCII characters.
+///
+class Trie : public Completer
+{
+public:
+  Trie() = default;
+  explicit Trie(std::vector<std::string> words);
+
+  std::size_t size() const;
+  bool        empty() const;
+  ///
+  /// @brief The word \b index in sorted order.
+  ///
+  std::string operator[](const std::size_t& index) const;
+
+  ///
+  /// @brief The words starting with \b prefix are the words [first, second) in sorted order.
+  ///
+  std::pair<std::size_t, std::size_t> range(const std::string& prefix) const;
+
+  ///
+  /// @brief The words starting with the word ending \b input . They are read from the trie, which must outlive the completion.
+  ///
+  Completion complete(const std::string& input, const std::atomic<bool>& cancelled) const override;
+
+private:
+  struct Node
+  {
+    std::uint32_t begin{0};        ///< First word of the node.
+    std::uint32_t end{0};          ///< Past its last word.
+    std::uint32_t depth{0};        ///< Length of the prefix its words share.
+    std::uint32_t first_child{0};  ///< Children are consecutive, ordered by their byte at depth.
+    std::uint32_t children{0};
+  };
+  const char*              word(const std::size_t& index) const;
+  std::size_t              length(const std::size_t& index) const;
+  std::size_t              common_prefix(const std::size_t& first, const std::size_t& last) const;
+  std::string              m_data;        ///< The words, sorted and without duplicates.
+  std::vector<std::size_t> m_offsets{0};  ///< Start of each word in m_data, and its end.
+  std::vector<Node>        m_nodes;       ///< The root first, then breadth first.
+};
+
+}  // namespace Term
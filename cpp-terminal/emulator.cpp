@@ -0,0 +1,688 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/emulator.hpp"
+
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/private/unicode.hpp"
+#include "cpp-terminal/private/grapheme.hpp"
+#include "cpp-terminal/private/wcwidth.hpp"
+
+#include <algorithm>
+
+namespace
+{
+
+// Longer parameters are ignored: no sequence needs that many, and they would grow without limit
+const std::size_t max_parameters{256};
+
+// The cells of a rows x columns screen, cropped or filled with blanks to new_rows x new_columns
+std::vector<Term::Emulator::Cell> crop(const std::vector<Term::Emulator::Cell>& cells, const std::size_t& columns, const std::size_t& new_rows, const std::size_t& new_columns)
+{
+  std::vector<Term::Emulator::Cell> ret(new_rows * new_columns, Term::Emulator::Cell());
+  for(std::size_t row = 0; row != std::min(cells.size() / columns, new_rows); ++row)
+  {
+    for(std::size_t column = 0; column != std::min(columns, new_columns); ++column) { ret[row * new_columns + column] = cells[row * columns + column]; }
+  }
+  return ret;
+}
+
+}  // namespace
+
+bool Term::Emulator::Cell::has(const Term::Style& style) const
+{
+  const std::uint8_t value{static_cast<std::uint8_t>(style)};
+  return value < 16 && (attributes & (1U << value)) != 0;
+}
+
+bool Term::Emulator::Cell::operator==(const Cell& cell) const { return character == cell.character && combining == cell.combining && fg == cell.fg && bg == cell.bg && attributes == cell.attributes; }
+
+bool Term::Emulator::Cell::operator!=(const Cell& cell) const { return !(*this == cell); }
+
+Term::Emulator::Emulator(const std::size_t& rows, const std::size_t& columns) : m_size(rows, columns), m_bottom(rows)
+{
+  if(rows == 0 || columns == 0) { throw Term::Exception("Emulator(): the screen can't be empty"); }
+  m_cells.assign(rows * columns, Cell());
+}
+
+std::size_t Term::Emulator::rows() const { return m_size.rows(); }
+
+std::size_t Term::Emulator::columns() const { return m_size.columns(); }
+
+Term::Screen Term::Emulator::size() const { return m_size; }
+
+Term::Cursor Term::Emulator::cursor() const { return {m_row, m_column}; }
+
+bool Term::Emulator::cursor_visible() const { return m_cursor_visible; }
+
+std::size_t Term::Emulator::bytes() const { return m_bytes; }
+
+void Term::Emulator::reset_bytes() { m_bytes = 0; }
+
+void Term::Emulator::set_translate_newline(const bool& translate) { m_translate_newline = translate; }
+
+std::string Term::Emulator::responses()
+{
+  std::string ret;
+  ret.swap(m_responses);
+  return ret;
+}
+
+std::size_t Term::Emulator::index(const std::size_t& row, const std::size_t& column) const
+{
+  if(row < 1 || column < 1 || row > rows() || column > columns()) { throw Term::Exception("Emulator: (row,column) out of range"); }
+  return ((row - 1) * columns()) + (column - 1);
+}
+
+Term::Emulator::Cell& Term::Emulator::at(const std::size_t& row, const std::size_t& column) { return m_cells[index(row, column)]; }
+
+const Term::Emulator::Cell& Term::Emulator::cell(const std::size_t& row, const std::size_t& column) const { return m_cells[index(row, column)]; }
+
+std::string Term::Emulator::row(const std::size_t& row) const
+{
+  std::string ret;
+  for(std::size_t column = 1; column <= columns(); ++column)
+  {
+    if(cell(row, column).character != U'\0')
+    {
+      Private::append_utf8(ret, cell(row, column).character);
+      Private::append_utf8(ret, cell(row, column).combining.data(), cell(row, column).combining.size());
+    }
+  }
+  return ret;
+}
+
+std::string Term::Emulator::text() const
+{
+  std::string ret;
+  for(std::size_t line = 1; line <= rows(); ++line)
+  {
+    std::string content{row(line)};
+    content.erase(content.find_last_not_of(' ') + 1);
+    ret.append(content);
+    if(line != rows()) { ret.push_back('\n'); }
+  }
+  return ret;
+}
+
+void Term::Emulator::resize(const std::size_t& new_rows, const std::size_t& new_columns)
+{
+  if(new_rows == 0 || new_columns == 0) { throw Term::Exception("Emulator::resize(): the screen can't be empty"); }
+  m_cells = crop(m_cells, columns(), new_rows, new_columns);
+  // The main screen, saved while the alternate one is shown
+  if(m_alternate_active) { m_alternate = crop(m_alternate, columns(), new_rows, new_columns); }
+  m_size         = {new_rows, new_columns};
+  m_top          = 1;
+  m_bottom       = new_rows;
+  m_row          = std::min(m_row, new_rows);
+  m_column       = std::min(m_column, new_columns);
+  m_saved_row    = std::min(m_saved_row, new_rows);
+  m_saved_column = std::min(m_saved_column, new_columns);
+  m_pending_wrap = false;
+  m_grapheme     = 0;
+}
+
+void Term::Emulator::reset()
+{
+  m_pen = Cell();
+  m_cells.assign(rows() * columns(), Cell());
+  m_alternate.clear();
+  m_alternate_active = false;
+  m_row              = 1;
+  m_column           = 1;
+  m_saved_row        = 1;
+  m_saved_column     = 1;
+  m_saved_pen        = Cell();
+  m_pending_wrap     = false;
+  m_top              = 1;
+  m_bottom           = rows();
+  m_cursor_visible   = true;
+  m_autowrap         = true;
+  m_state            = State::Ground;
+  m_utf8_remaining   = 0;
+  m_grapheme         = 0;
+}
+
+void Term::Emulator::feed(const std::string& bytes) { feed(bytes.data(), bytes.size()); }
+
+void Term::Emulator::feed(const char* bytes, const std::size_t& size)
+{
+  m_bytes += size;
+  for(std::size_t i = 0; i != size; ++i)
+  {
+    const unsigned char byte{static_cast<unsigned char>(bytes[i])};
+    // Unfinished UTF-8 sequence interrupted by something else
+    if(m_utf8_remaining != 0 && (byte & 0xC0) != 0x80)
+    {
+      m_utf8_remaining = 0;
+      print(U'\uFFFD');
+    }
+    if(byte == 0x18 || byte == 0x1A)  // CAN, SUB abort sequences
+    {
+      m_state = State::Ground;
+      continue;
+    }
+    if(byte == 0x1B)
+    {
+      m_grapheme     = 0;
+      m_state        = (m_state == State::String) ? State::StringEscape : State::Escape;
+      m_intermediate = '\0';
+      continue;
+    }
+    switch(m_state)
+    {
+      case State::Ground:
+      {
+        if(byte < 0x20)
+        {
+          m_grapheme = 0;
+          execute(static_cast<char>(byte));
+        }
+        else if(byte == 0x7F) {}
+        else if(byte < 0x80) { print(byte); }
+        else if(m_utf8_remaining != 0)
+        {
+          m_utf8_codepoint = (m_utf8_codepoint << 6) | (byte & 0x3FU);
+          if(--m_utf8_remaining == 0) { print(m_utf8_codepoint > 0x10FFFF ? U'\uFFFD' : static_cast<char32_t>(m_utf8_codepoint)); }
+        }
+        else
+        {
+          const std::size_t size_codepoint{Private::utf8_codepoint_size(byte)};
+          if(size_codepoint < 2) { print(U'\uFFFD'); }
+          else
+          {
+            static const constexpr std::uint8_t mask[5]{0, 0, 0x1F, 0x0F, 0x07};
+            m_utf8_codepoint = byte & mask[size_codepoint];
+            m_utf8_remaining = size_codepoint - 1;
+          }
+        }
+        break;
+      }
+      case State::Escape:
+      {
+        if(byte < 0x20) { execute(static_cast<char>(byte)); }
+        else if(byte == '[')
+        {
+          m_state = State::Csi;
+          m_parameters.clear();
+          m_private = '\0';
+        }
+        else if(byte == ']' || byte == 'P' || byte == 'X' || byte == '^' || byte == '_') { m_state = State::String; }
+        else if(byte < 0x30)
+        {
+          m_intermediate = static_cast<char>(byte);
+          m_state        = State::EscapeIntermediate;
+        }
+        else
+        {
+          m_state = State::Ground;
+          escape(static_cast<char>(byte));
+        }
+        break;
+      }
+      case State::EscapeIntermediate:
+      {
+        // Character sets (ESC ( B, ESC % G...) and DEC line attributes are not emulated
+        if(byte < 0x20) { execute(static_cast<char>(byte)); }
+        else if(byte >= 0x30) { m_state = State::Ground; }
+        break;
+      }
+      case State::Csi:
+      {
+        if(byte < 0x20) { execute(static_cast<char>(byte)); }
+        else if(byte >= '<' && byte <= '?' && m_parameters.empty() && m_private == '\0') { m_private = static_cast<char>(byte); }
+        else if(byte >= 0x30 && byte < 0x40)
+        {
+          if(m_parameters.size() < max_parameters) { m_parameters.push_back(static_cast<char>(byte)); }
+        }
+        else if(byte < 0x30) { m_intermediate = static_cast<char>(byte); }
+        else
+        {
+          m_state = State::Ground;
+          if(m_intermediate == '\0') { csi(static_cast<char>(byte)); }
+          m_intermediate = '\0';
+        }
+        break;
+      }
+      case State::String:
+      {
+        if(byte == 0x07) { m_state = State::Ground; }
+        break;
+      }
+      case State::StringEscape:
+      {
+        m_state = State::Ground;
+        if(byte != '\\')  // not ST: the ESC started a new sequence
+        {
+          m_state = State::Escape;
+          --i;
+        }
+        break;
+      }
+    }
+  }
+}
+
+void Term::Emulator::print(const char32_t& character)
+{
+  if(!Private::is_grapheme_boundary(m_grapheme, character))
+  {
+    join(character);
+    return;
+  }
+  if(m_pending_wrap)
+  {
+    m_column = 1;
+    line_feed();
+  }
+  const int width{Private::wcwidth(character)};
+  if(width < 1)
+  {
+    // Nothing to join: dropped, like what follows in its cluster
+    m_grapheme = 0;
+    return;
+  }
+  if(width == 2 && m_column == columns() && columns() > 1)
+  {
+    // No room for the second half: wrap first (or overwrite the last two cells)
+    if(m_autowrap)
+    {
+      at(m_row, m_column) = blank();
+      m_column            = 1;
+      line_feed();
+    }
+    else { --m_column; }
+  }
+  m_cluster = index(m_row, m_column);
+  Cell& cell{at(m_row, m_column)};
+  cell           = m_pen;
+  cell.character = character;
+  if(width == 2 && m_column < columns())
+  {
+    ++m_column;
+    at(m_row, m_column)           = m_pen;
+    at(m_row, m_column).character = U'\0';
+  }
+  if(m_column == columns()) { m_pending_wrap = m_autowrap; }
+  else { ++m_column; }
+}
+
+void Term::Emulator::join(const char32_t& character)
+{
+  Cell&          cell{m_cells[m_cluster]};
+  std::u32string cluster{cell.character};
+  cluster += cell.combining;
+  const bool     narrow{Private::grapheme_width(cluster.data(), cluster.size()) != 2};
+  cluster.push_back(character);
+  cell.combining.push_back(character);
+  // VS16 and flags make a narrow cluster wide, when the next cell is free
+  if(narrow && Private::grapheme_width(cluster.data(), cluster.size()) == 2 && !m_pending_wrap && index(m_row, m_column) == m_cluster + 1)
+  {
+    at(m_row, m_column)           = m_pen;
+    at(m_row, m_column).character = U'\0';
+    if(m_column == columns()) { m_pending_wrap = m_autowrap; }
+    else { ++m_column; }
+  }
+}
+
+void Term::Emulator::execute(const char& control)
+{
+  switch(control)
+  {
+    case '\b':
+    {
+      if(m_column > 1) { --m_column; }
+      m_pending_wrap = false;
+      break;
+    }
+    case '\t':
+    {
+      m_column       = std::min(((m_column - 1) / 8 + 1) * 8 + 1, columns());
+      m_pending_wrap = false;
+      break;
+    }
+    case '\n':
+    case '\v':
+    case '\f':
+    {
+      line_feed();
+      if(m_translate_newline) { m_column = 1; }
+      m_pending_wrap = false;
+      break;
+    }
+    case '\r':
+    {
+      m_column       = 1;
+      m_pending_wrap = false;
+      break;
+    }
+    default: break;  // BEL, SO, SI...
+  }
+}
+
+void Term::Emulator::escape(const char& final)
+{
+  switch(final)
+  {
+    case '7': save_cursor(); break;
+    case '8': restore_cursor(); break;
+    case 'D': line_feed(); break;
+    case 'E':
+    {
+      m_column = 1;
+      line_feed();
+      break;
+    }
+    case 'M': reverse_line_feed(); break;
+    case 'c': reset(); break;
+    default: break;
+  }
+  m_pending_wrap = false;
+}
+
+void Term::Emulator::parse_parameters()
+{
+  m_values.clear();
+  std::size_t value{0};
+  bool        has_value{false};
+  for(const char character: m_parameters)
+  {
+    if(character >= '0' && character <= '9')
+    {
+      value     = std::min<std::size_t>(value * 10 + static_cast<std::size_t>(character - '0'), 0xFFFF);
+      has_value = true;
+    }
+    else if(character == ';' || character == ':')
+    {
+      m_values.push_back(value);
+      value     = 0;
+      has_value = false;
+    }
+  }
+  if(has_value || !m_values.empty()) { m_values.push_back(value); }
+}
+
+std::size_t Term::Emulator::parameter(const std::size_t& index, const std::size_t& default_value) const
+{
+  if(index >= m_values.size() || m_values[index] == 0) { return default_value; }
+  return m_values[index];
+}
+
+void Term::Emulator::csi(const char& final)
+{
+  parse_parameters();
+  if(final == 'h' || final == 'l')
+  {
+    set_mode(final == 'h');
+    return;
+  }
+  if(m_private != '\0') { return; }  // DA2, XTVERSION, kitty keyboard... are not emulated
+  const std::size_t count{parameter(0)};
+  switch(final)
+  {
+    case '@':  // ICH
+    {
+      std::vector<Cell>::iterator begin{m_cells.begin() + static_cast<long>(index(m_row, m_column))};
+      std::vector<Cell>::iterator end{m_cells.begin() + static_cast<long>(index(m_row, columns())) + 1};
+      const std::size_t           shift{std::min(count, columns() - m_column + 1)};
+      std::copy_backward(begin, end - static_cast<long>(shift), end);
+      std::fill(begin, begin + static_cast<long>(shift), blank());
+      break;
+    }
+    case 'A':  // CUU
+    case 'F':  // CPL
+    {
+      const std::size_t limit{m_row >= m_top ? m_top : 1};
+      m_row = m_row > limit + count ? m_row - count : limit;
+      if(final == 'F') { m_column = 1; }
+      break;
+    }
+    case 'B':  // CUD
+    case 'E':  // CNL
+    {
+      const std::size_t limit{m_row <= m_bottom ? m_bottom : rows()};
+      m_row = std::min(m_row + count, limit);
+      if(final == 'E') { m_column = 1; }
+      break;
+    }
+    case 'C': m_column = std::min(m_column + count, columns()); break;  // CUF
+    case 'D': m_column = m_column > count ? m_column - count : 1; break;  // CUB
+    case 'G':                                                            // CHA
+    case '`': m_column = std::min(count, columns()); break;              // HPA
+    case 'd': m_row = std::min(count, rows()); break;                    // VPA
+    case 'H':                                                            // CUP
+    case 'f': move_to(parameter(0), parameter(1)); break;                // HVP
+    case 'J':                                                            // ED
+    {
+      const std::size_t mode{parameter(0, 0)};
+      if(mode == 0)
+      {
+        erase(m_row, m_column, columns());
+        for(std::size_t row = m_row + 1; row <= rows(); ++row) { erase(row, 1, columns()); }
+      }
+      else if(mode == 1)
+      {
+        for(std::size_t row = 1; row < m_row; ++row) { erase(row, 1, columns()); }
+        erase(m_row, 1, m_column);
+      }
+      else
+      {
+        for(std::size_t row = 1; row <= rows(); ++row) { erase(row, 1, columns()); }
+      }
+      break;
+    }
+    case 'K':  // EL
+    {
+      const std::size_t mode{parameter(0, 0)};
+      if(mode == 0) { erase(m_row, m_column, columns()); }
+      else if(mode == 1) { erase(m_row, 1, m_column); }
+      else { erase(m_row, 1, columns()); }
+      break;
+    }
+    case 'L':  // IL
+    {
+      if(m_row >= m_top && m_row <= m_bottom) { scroll_down(m_row, m_bottom, count); }
+      m_column = 1;
+      break;
+    }
+    case 'M':  // DL
+    {
+      if(m_row >= m_top && m_row <= m_bottom) { scroll_up(m_row, m_bottom, count); }
+      m_column = 1;
+      break;
+    }
+    case 'P':  // DCH
+    {
+      std::vector<Cell>::iterator begin{m_cells.begin() + static_cast<long>(index(m_row, m_column))};
+      std::vector<Cell>::iterator end{m_cells.begin() + static_cast<long>(index(m_row, columns())) + 1};
+      const std::size_t           shift{std::min(count, columns() - m_column + 1)};
+      std::copy(begin + static_cast<long>(shift), end, begin);
+      std::fill(end - static_cast<long>(shift), end, blank());
+      break;
+    }
+    case 'S': scroll_up(m_top, m_bottom, count); break;                                    // SU
+    case 'T': scroll_down(m_top, m_bottom, count); break;                                  // SD
+    case 'X': erase(m_row, m_column, std::min(m_column + count - 1, columns())); break;  // ECH
+    case 'c':  // DA1: a VT220 with ANSI colors, without Sixel
+    {
+      if(parameter(0, 0) == 0) { m_responses.append("\u001b[?62;22c"); }
+      break;
+    }
+    case 'm': sgr(); break;
+    case 'n':  // DSR
+    {
+      if(parameter(0, 0) == 6) { m_responses.append("\u001b[" + std::to_string(m_row) + ';' + std::to_string(m_column) + 'R'); }
+      else if(parameter(0, 0) == 5) { m_responses.append("\u001b[0n"); }
+      break;
+    }
+    case 'r':  // DECSTBM
+    {
+      const std::size_t top{parameter(0)};
+      const std::size_t bottom{std::min(parameter(1, rows()), rows())};
+      if(top < bottom)
+      {
+        m_top    = top;
+        m_bottom = bottom;
+        move_to(1, 1);
+      }
+      break;
+    }
+    case 's': save_cursor(); break;
+    case 'u': restore_cursor(); break;
+    default: break;
+  }
+  m_pending_wrap = false;
+}
+
+void Term::Emulator::set_mode(const bool& set)
+{
+  if(m_private != '?') { return; }  // ANSI modes (IRM, LNM) are not emulated
+  for(std::size_t i = 0; i != m_values.size(); ++i)
+  {
+    switch(m_values[i])
+    {
+      case 7: m_autowrap = set; break;
+      case 25: m_cursor_visible = set; break;
+      case 47:
+      case 1047: alternate_screen(set); break;
+      case 1049:
+      {
+        if(set)
+        {
+          save_cursor();
+          alternate_screen(true);
+        }
+        else
+        {
+          alternate_screen(false);
+          restore_cursor();
+        }
+        break;
+      }
+      default: break;  // mouse, focus, bracketed paste...
+    }
+  }
+}
+
+void Term::Emulator::sgr()
+{
+  if(m_values.empty()) { m_values.push_back(0); }
+  for(std::size_t i = 0; i < m_values.size(); ++i)
+  {
+    const std::size_t value{m_values[i]};
+    if(value == 0)
+    {
+      m_pen.fg         = Term::Color::Name::Default;
+      m_pen.bg         = Term::Color::Name::Default;
+      m_pen.attributes = 0;
+    }
+    else if(value <= 9) { m_pen.attributes |= static_cast<std::uint16_t>(1U << value); }
+    else if(value == 22) { m_pen.attributes &= static_cast<std::uint16_t>(~((1U << 1) | (1U << 2))); }
+    else if(value == 23 || value == 24 || value == 27 || value == 28 || value == 29) { m_pen.attributes &= static_cast<std::uint16_t>(~(1U << (value - 20))); }
+    else if(value == 25) { m_pen.attributes &= static_cast<std::uint16_t>(~((1U << 5) | (1U << 6))); }
+    else if(value >= 30 && value <= 37) { m_pen.fg = static_cast<Term::Color::Name>(value - 30); }
+    else if(value == 39) { m_pen.fg = Term::Color::Name::Default; }
+    else if(value >= 40 && value <= 47) { m_pen.bg = static_cast<Term::Color::Name>(value - 40); }
+    else if(value == 49) { m_pen.bg = Term::Color::Name::Default; }
+    else if(value >= 90 && value <= 97) { m_pen.fg = static_cast<Term::Color::Name>(value - 90 + 60); }
+    else if(value >= 100 && value <= 107) { m_pen.bg = static_cast<Term::Color::Name>(value - 100 + 60); }
+    else if(value == 38 || value == 48)
+    {
+      Term::Color color;
+      if(i + 2 < m_values.size() && m_values[i + 1] == 5)
+      {
+        color = Term::Color(static_cast<std::uint8_t>(m_values[i + 2]));
+        i += 2;
+      }
+      else if(i + 4 < m_values.size() && m_values[i + 1] == 2)
+      {
+        color = Term::Color(static_cast<std::uint8_t>(m_values[i + 2]), static_cast<std::uint8_t>(m_values[i + 3]), static_cast<std::uint8_t>(m_values[i + 4]));
+        i += 4;
+      }
+      else { return; }
+      if(value == 38) { m_pen.fg = color; }
+      else { m_pen.bg = color; }
+    }
+  }
+}
+
+Term::Emulator::Cell Term::Emulator::blank() const
+{
+  Cell ret;
+  ret.bg = m_pen.bg;  // back color erase, like xterm
+  return ret;
+}
+
+void Term::Emulator::erase(const std::size_t& row, const std::size_t& from, const std::size_t& to)
+{
+  if(from > to) { return; }
+  std::fill(m_cells.begin() + static_cast<long>(index(row, from)), m_cells.begin() + static_cast<long>(index(row, to)) + 1, blank());
+}
+
+void Term::Emulator::scroll_up(const std::size_t& top, const std::size_t& bottom, const std::size_t& count)
+{
+  const std::size_t lines{std::min(count, bottom - top + 1)};
+  const long        first{static_cast<long>(index(top, 1))};
+  const long        last{static_cast<long>(index(bottom, columns())) + 1};
+  const long        shift{static_cast<long>(lines * columns())};
+  std::copy(m_cells.begin() + first + shift, m_cells.begin() + last, m_cells.begin() + first);
+  std::fill(m_cells.begin() + last - shift, m_cells.begin() + last, blank());
+}
+
+void Term::Emulator::scroll_down(const std::size_t& top, const std::size_t& bottom, const std::size_t& count)
+{
+  const std::size_t lines{std::min(count, bottom - top + 1)};
+  const long        first{static_cast<long>(index(top, 1))};
+  const long        last{static_cast<long>(index(bottom, columns())) + 1};
+  const long        shift{static_cast<long>(lines * columns())};
+  std::copy_backward(m_cells.begin() + first, m_cells.begin() + last - shift, m_cells.begin() + last);
+  std::fill(m_cells.begin() + first, m_cells.begin() + first + shift, blank());
+}
+
+void Term::Emulator::line_feed()
+{
+  m_pending_wrap = false;
+  if(m_row == m_bottom) { scroll_up(m_top, m_bottom, 1); }
+  else if(m_row < rows()) { ++m_row; }
+}
+
+void Term::Emulator::reverse_line_feed()
+{
+  m_pending_wrap = false;
+  if(m_row == m_top) { scroll_down(m_top, m_bottom, 1); }
+  else if(m_row > 1) { --m_row; }
+}
+
+void Term::Emulator::move_to(const std::size_t& row, const std::size_t& column)
+{
+  m_row          = std::max<std::size_t>(1, std::min(row, rows()));
+  m_column       = std::max<std::size_t>(1, std::min(column, columns()));
+  m_pending_wrap = false;
+}
+
+void Term::Emulator::save_cursor()
+{
+  m_saved_row    = m_row;
+  m_saved_column = m_column;
+  m_saved_pen    = m_pen;
+}
+
+void Term::Emulator::restore_cursor()
+{
+  move_to(m_saved_row, m_saved_column);
+  m_pen = m_saved_pen;
+}
+
+void Term::Emulator::alternate_screen(const bool& enable)
+{
+  if(enable == m_alternate_active) { return; }
+  m_alternate.swap(m_cells);
+  if(enable) { m_cells.assign(rows() * columns(), blank()); }
+  m_alternate_active = enable;
+}
@@ -0,0 +1,167 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include "cpp-terminal/color.hpp"
+#include "cpp-terminal/cursor.hpp"
+#include "cpp-terminal/screen.hpp"
+#include "cpp-terminal/style.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Term
+{
+
+///
+/// @brief Headless terminal emulator: a VT500-subset parser writing into a grid of cells.
+///
+/// Feed it the bytes cpp-terminal would write to the terminal (for example the output of \b Window::render) and inspect the resulting screen.
+/// It is used to test rendering byte-exactly, to measure the number of bytes per frame, and as an offscreen render target.
+///
+/// Supported: UTF-8 (sequences may be split across \b feed() calls), wide characters (two cells), grapheme clusters (one cell, two when made wide by VS16 or a flag), C0 controls, cursor movement (CUU/CUD/CUF/CUB/CNL/CPL/CHA/VPA/CUP), erase (ED/EL/ECH),
+/// insert/delete (ICH/DCH/IL/DL), scrolling (SU/SD/IND/RI/DECSTBM), SGR (16, 256 and 24bit colors, styles 1-9 and their resets), cursor save/restore,
+/// alternate screen (?47/?1047/?1049), cursor visibility (?25), autowrap (?7), the cursor position report (DSR 6) and the primary device attributes (DA1). OSC/DCS/APC strings are skipped.
+///
+class Emulator
+{
+public:
+  class Cell
+  {
+  public:
+    char32_t       character{U' '};  ///< \b U'\\0' in the second cell of a wide character.
+    std::u32string combining;        ///< The code points following \b character in its grapheme cluster (combining marks, ZWJ sequences...).
+    Term::Color    fg{Term::Color::Name::Default};
+    Term::Color    bg{Term::Color::Name::Default};
+    std::uint16_t  attributes{0};  ///< Bit \b n is set when SGR \b n (1 to 9) is active.
+    bool           has(const Term::Style& style) const;
+    bool           operator==(const Cell& cell) const;
+    bool           operator!=(const Cell& cell) const;
+  };
+
+  Emulator(const std::size_t& rows, const std::size_t& columns);
+
+  ///
+  /// @brief Parse \b bytes and update the screen.
+  ///
+  void feed(const std::string& bytes);
+  void feed(const char* bytes, const std::size_t& size);
+
+  std::size_t  rows() const;
+  std::size_t  columns() const;
+  Term::Screen size() const;
+
+  ///
+  /// @brief Resize the grid, keeping the top-left content. Resets the scrolling region.
+  ///
+  void resize(const std::size_t& rows, const std::size_t& columns);
+
+  ///
+  /// @brief The cell at (row, column), starting from (1,1) like \b Term::Cursor .
+  ///
+  const Cell& cell(const std::size_t& row, const std::size_t& column) const;
+
+  ///
+  /// @brief The characters of a row encoded in UTF-8, trailing blanks included.
+  ///
+  std::string row(const std::size_t& row) const;
+
+  ///
+  /// @brief All the rows separated by \b '\\n' with trailing blanks removed.
+  ///
+  std::string text() const;
+
+  Term::Cursor cursor() const;
+  bool         cursor_visible() const;
+
+  ///
+  /// @brief The replies the terminal would send back (cursor position reports...). Clears them.
+  ///
+  std::string responses();
+
+  ///
+  /// @brief Number of bytes fed since construction or the last \b reset_bytes() .
+  ///
+  std::size_t bytes() const;
+  void        reset_bytes();
+
+  ///
+  /// @brief Translate \b '\\n' into \b "\\r\\n" like the tty does by default (\b ONLCR ). Enabled by default.
+  ///
+  void set_translate_newline(const bool& translate);
+
+  ///
+  /// @brief Full reset (RIS): clear the screen, home the cursor, reset attributes and modes.
+  ///
+  void reset();
+
+private:
+  enum class State : std::uint8_t
+  {
+    Ground,
+    Escape,
+    EscapeIntermediate,
+    Csi,
+    String,
+    StringEscape
+  };
+  void                     print(const char32_t& character);
+  void                     join(const char32_t& character);
+  void                     execute(const char& control);
+  void                     escape(const char& final);
+  void                     csi(const char& final);
+  void                     sgr();
+  void                     parse_parameters();
+  void                     set_mode(const bool& set);
+  void                     line_feed();
+  void                     reverse_line_feed();
+  void                     scroll_up(const std::size_t& top, const std::size_t& bottom, const std::size_t& count);
+  void                     scroll_down(const std::size_t& top, const std::size_t& bottom, const std::size_t& count);
+  void                     erase(const std::size_t& row, const std::size_t& from, const std::size_t& to);
+  void                     move_to(const std::size_t& row, const std::size_t& column);
+  void                     save_cursor();
+  void                     restore_cursor();
+  void                     alternate_screen(const bool& enable);
+  Cell                     blank() const;
+  std::size_t              parameter(const std::size_t& index, const std::size_t& default_value = 1) const;
+  Cell&                    at(const std::size_t& row, const std::size_t& column);
+  std::size_t              index(const std::size_t& row, const std::size_t& column) const;
+  Term::Screen             m_size;
+  std::vector<Cell>        m_cells;
+  std::vector<Cell>        m_alternate;
+  bool                     m_alternate_active{false};
+  std::size_t              m_row{1};
+  std::size_t              m_column{1};
+  bool                     m_pending_wrap{false};
+  Cell                     m_pen;
+  std::size_t              m_saved_row{1};
+  std::size_t              m_saved_column{1};
+  Cell                     m_saved_pen;
+  std::size_t              m_top{1};
+  std::size_t              m_bottom{1};
+  bool                     m_cursor_visible{true};
+  bool                     m_autowrap{true};
+  bool                     m_translate_newline{true};
+  State                    m_state{State::Ground};
+  std::string              m_parameters;
+  std::vector<std::size_t> m_values;
+  char                     m_private{'\0'};
+  char                     m_intermediate{'\0'};
+  std::uint32_t            m_utf8_codepoint{0};
+  std::size_t              m_utf8_remaining{0};
+  std::uint32_t            m_grapheme{0};  // segmentation state, 0 when the next character can't join the previous cell
+  std::size_t              m_cluster{0};   // the cell of the last grapheme cluster
+  std::string              m_responses;
+  std::size_t              m_bytes{0};
+};
+
+}  // namespace Term
@@ -103,7 +103,8 @@ const Term::Focus* Term::Event::get_if_focus() const
 
 Term::Event& Term::Event::operator=(const Term::Event& event)
 {
-  m_Type = event.m_Type;
+  m_Type      = event.m_Type;
+  m_timestamp = event.m_timestamp;
   switch(m_Type)
   {
     case Type::Empty: break;
@@ -120,7 +121,7 @@ Term::Event& Term::Event::operator=(const Term::Event& event)
 
 Term::Event::Event(const Term::Focus& focus) : m_Type(Type::Focus) { m_container.m_Focus = focus; }
 
-Term::Event::Event(const Term::Event& event)
+Term::Event::Event(const Term::Event& event) : m_timestamp(event.m_timestamp)
 {
   m_Type = event.m_Type;
   switch(m_Type)
@@ -144,7 +145,7 @@ Term::Event::~Event()
 
 Term::Event::Event() = default;
 
-Term::Event::Event(Term::Event&& event) noexcept : m_Type(event.m_Type)
+Term::Event::Event(Term::Event&& event) noexcept : m_Type(event.m_Type), m_timestamp(event.m_timestamp)
 {
   switch(m_Type)
   {
@@ -161,6 +162,7 @@ Term::Event::Event(Term::Event&& event) noexcept : m_Type(event.m_Type)
 
 Term::Event& Term::Event::operator=(Term::Event&& other) noexcept
 {
+  m_timestamp = other.m_timestamp;
   switch(other.m_Type)
   {
     case Type::Empty: break;
@@ -179,6 +181,8 @@ Term::Event::Event(const Term::Mouse& mouse) : m_Type(Type::Mouse) { m_container
 
 bool Term::Event::empty() const { return m_Type == Type::Empty; }
 
+std::chrono::steady_clock::time_point Term::Event::timestamp() const { return m_timestamp; }
+
 Term::Event::operator Term::Mouse() const
 {
   if(m_Type == Type::Mouse) { return m_container.m_Mouse; }
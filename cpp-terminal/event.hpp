@@ -15,6 +15,7 @@
 #include "cpp-terminal/mouse.hpp"
 #include "cpp-terminal/screen.hpp"
 
+#include <chrono>
 #include <cstdint>
 #include <string>
 
@@ -69,6 +70,11 @@ public:
   std::string*       get_if_copy_paste();
   const std::string* get_if_copy_paste() const;
 
+  ///
+  /// @brief When the event was created. Events coming from the terminal are created by the input thread as soon as their bytes have been read, so this is their arrival time. Copies keep the timestamp.
+  ///
+  std::chrono::steady_clock::time_point timestamp() const;
+
 private:
   void parse(const std::string& str);
   union container
@@ -86,8 +92,9 @@ private:
     Term::Mouse  m_Mouse;
     std::string  m_string;
   };
-  Type      m_Type{Type::Empty};
-  container m_container;
+  Type                                  m_Type{Type::Empty};
+  container                             m_container;
+  std::chrono::steady_clock::time_point m_timestamp{std::chrono::steady_clock::now()};
 };
 
 }  // namespace Term
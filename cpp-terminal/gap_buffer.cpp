@@ -0,0 +1,151 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/gap_buffer.hpp"
+
+#include "cpp-terminal/exception.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+Term::GapBuffer::GapBuffer(const std::string& text) { assign(text); }
+
+std::size_t Term::GapBuffer::size() const { return m_buffer.size() - (m_gap_end - m_gap_begin); }
+
+bool Term::GapBuffer::empty() const { return size() == 0; }
+
+char Term::GapBuffer::operator[](const std::size_t& position) const { return position < m_gap_begin ? m_buffer[position] : m_buffer[position + m_gap_end - m_gap_begin]; }
+
+std::string Term::GapBuffer::substr(const std::size_t& position, const std::size_t& count) const
+{
+  if(position > size()) { throw Term::Exception("GapBuffer::substr(): position out of range"); }
+  const std::size_t end{position + std::min(count, size() - position)};
+  std::string       ret;
+  ret.reserve(end - position);
+  if(position < m_gap_begin) { ret.append(&m_buffer[position], std::min(end, m_gap_begin) - position); }
+  if(end > m_gap_begin)
+  {
+    const std::size_t begin{std::max(position, m_gap_begin)};
+    ret.append(&m_buffer[begin + m_gap_end - m_gap_begin], end - begin);
+  }
+  return ret;
+}
+
+std::string Term::GapBuffer::str() const { return substr(0, size()); }
+
+void Term::GapBuffer::insert(const std::size_t& position, const std::string& text)
+{
+  if(position > size()) { throw Term::Exception("GapBuffer::insert(): position out of range"); }
+  if(text.empty()) { return; }
+  move_gap(position);
+  if(m_gap_end - m_gap_begin < text.size()) { grow(text.size()); }
+  std::memcpy(&m_buffer[m_gap_begin], text.data(), text.size());
+  for(std::size_t i = 0; i != text.size(); ++i)
+  {
+    if(text[i] == '\n') { m_before.push_back(m_gap_begin + i); }
+  }
+  m_gap_begin += text.size();
+}
+
+void Term::GapBuffer::insert(const std::size_t& position, const char& character)
+{
+  if(position > size()) { throw Term::Exception("GapBuffer::insert(): position out of range"); }
+  move_gap(position);
+  if(m_gap_end == m_gap_begin) { grow(1); }
+  if(character == '\n') { m_before.push_back(m_gap_begin); }
+  m_buffer[m_gap_begin++] = character;
+}
+
+void Term::GapBuffer::erase(const std::size_t& position, const std::size_t& count)
+{
+  if(position > size()) { throw Term::Exception("GapBuffer::erase(): position out of range"); }
+  const std::size_t erased{std::min(count, size() - position)};
+  move_gap(position);
+  // The bytes erased are the first ones after the gap, so are their '\n'
+  const std::size_t distance{size() - position - erased};
+  while(!m_after.empty() && m_after.back() > distance) { m_after.pop_back(); }
+  m_gap_end += erased;
+}
+
+void Term::GapBuffer::assign(const std::string& text)
+{
+  m_buffer.assign(text.begin(), text.end());
+  m_gap_begin = text.size();
+  m_gap_end   = text.size();
+  m_before.clear();
+  m_after.clear();
+  for(std::size_t i = 0; i != text.size(); ++i)
+  {
+    if(text[i] == '\n') { m_before.push_back(i); }
+  }
+}
+
+void Term::GapBuffer::clear() { assign(std::string()); }
+
+std::size_t Term::GapBuffer::lines() const { return m_before.size() + m_after.size() + 1; }
+
+std::size_t Term::GapBuffer::newline(const std::size_t& index) const { return index < m_before.size() ? m_before[index] : size() - m_after[m_after.size() - 1 - (index - m_before.size())]; }
+
+std::size_t Term::GapBuffer::line_begin(const std::size_t& line) const
+{
+  if(line >= lines()) { throw Term::Exception("GapBuffer::line_begin(): line out of range"); }
+  return line == 0 ? 0 : newline(line - 1) + 1;
+}
+
+std::size_t Term::GapBuffer::line_end(const std::size_t& line) const
+{
+  if(line >= lines()) { throw Term::Exception("GapBuffer::line_end(): line out of range"); }
+  return line + 1 == lines() ? size() : newline(line);
+}
+
+std::size_t Term::GapBuffer::line_of(const std::size_t& position) const
+{
+  // Number of '\n' before position
+  const std::size_t before{static_cast<std::size_t>(std::lower_bound(m_before.begin(), m_before.end(), position) - m_before.begin())};
+  if(before != m_before.size() || position <= m_gap_begin) { return before; }
+  return before + static_cast<std::size_t>(m_after.end() - std::upper_bound(m_after.begin(), m_after.end(), size() - position));
+}
+
+void Term::GapBuffer::move_gap(const std::size_t& position)
+{
+  if(position < m_gap_begin)
+  {
+    const std::size_t count{m_gap_begin - position};
+    std::memmove(&m_buffer[m_gap_end - count], &m_buffer[position], count);
+    while(!m_before.empty() && m_before.back() >= position)
+    {
+      m_after.push_back(size() - m_before.back());
+      m_before.pop_back();
+    }
+    m_gap_begin -= count;
+    m_gap_end -= count;
+  }
+  else if(position > m_gap_begin)
+  {
+    const std::size_t count{position - m_gap_begin};
+    std::memmove(&m_buffer[m_gap_begin], &m_buffer[m_gap_end], count);
+    while(!m_after.empty() && size() - m_after.back() < position)
+    {
+      m_before.push_back(size() - m_after.back());
+      m_after.pop_back();
+    }
+    m_gap_begin += count;
+    m_gap_end += count;
+  }
+}
+
+void Term::GapBuffer::grow(const std::size_t& count)
+{
+  // Double the capacity so a sequence of inserts costs O(1) each
+  const std::size_t after{m_buffer.size() - m_gap_end};
+  const std::size_t gap{std::max(count, std::max<std::size_t>(size(), 64))};
+  m_buffer.resize(m_gap_begin + gap + after);
+  if(after != 0) { std::memmove(&m_buffer[m_gap_begin + gap], &m_buffer[m_gap_end], after); }
+  m_gap_end = m_gap_begin + gap;
+}
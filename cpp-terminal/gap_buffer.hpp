@@ -0,0 +1,74 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Term
+{
+
+///
+/// @brief Text stored with a gap at the last edit position, so that inserting and erasing where the previous edit happened is O(1) amortized.
+///
+/// Editing elsewhere first moves the gap, which copies the bytes in between. The positions of the '\\n' are indexed the same way (before the gap from the start of the text, after it from its end),
+/// so finding the start of a line is O(1) and the line of a position is O(log lines). Positions are in bytes, lines are numbered from 0.
+///
+class GapBuffer
+{
+public:
+  GapBuffer() = default;
+  explicit GapBuffer(const std::string& text);
+
+  std::size_t size() const;
+  bool        empty() const;
+  char        operator[](const std::size_t& position) const;
+  std::string substr(const std::size_t& position, const std::size_t& count) const;
+  std::string str() const;
+
+  void insert(const std::size_t& position, const std::string& text);
+  void insert(const std::size_t& position, const char& character);
+  void erase(const std::size_t& position, const std::size_t& count);
+  void assign(const std::string& text);
+  void clear();
+
+  ///
+  /// @brief Number of lines: one more than the number of '\\n'.
+  ///
+  std::size_t lines() const;
+
+  ///
+  /// @brief Position of the first character of \b line .
+  ///
+  std::size_t line_begin(const std::size_t& line) const;
+
+  ///
+  /// @brief Position of the '\\n' ending \b line , \b size() for the last line.
+  ///
+  std::size_t line_end(const std::size_t& line) const;
+
+  ///
+  /// @brief The line containing \b position (the '\\n' ending a line belongs to it).
+  ///
+  std::size_t line_of(const std::size_t& position) const;
+
+private:
+  std::size_t              newline(const std::size_t& index) const;
+  void                     move_gap(const std::size_t& position);
+  void                     grow(const std::size_t& count);
+  std::vector<char>        m_buffer;
+  std::size_t              m_gap_begin{0};
+  std::size_t              m_gap_end{0};
+  std::vector<std::size_t> m_before;  ///< Positions of the '\\n' before the gap, increasing.
+  std::vector<std::size_t> m_after;   ///< Distances from the end of the text of the '\\n' after the gap, increasing (the last one is the closest to the gap).
+};
+
+}  // namespace Term
@@ -0,0 +1,350 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/graphics.hpp"
+
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/image.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+
+void append_decimal(std::string& out, std::size_t value)
+{
+  char        digits[20];
+  std::size_t size{0};
+  do {
+    digits[size++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while(value != 0);
+  while(size != 0) { out.push_back(digits[--size]); }
+}
+
+// 5 bits per channel
+std::uint16_t bin(const std::uint8_t* pixel) { return static_cast<std::uint16_t>(((pixel[0] >> 3U) << 10U) | ((pixel[1] >> 3U) << 5U) | (pixel[2] >> 3U)); }
+
+std::uint8_t channel(const std::uint16_t& bin, const std::size_t& channel) { return static_cast<std::uint8_t>((bin >> (10 - 5 * channel)) & 0x1FU); }
+
+bool transparent(const Term::Image& image, const std::uint8_t* pixel) { return image.channels() == 4 && pixel[3] < 128; }
+
+}  // namespace
+
+std::string Term::graphics_query() { return "\u001b_Gi=31,s=1,v=1,a=q,t=d,f=24;AAAA\u001b\\\u001b[c"; }
+
+Term::Graphics Term::graphics_support(const std::string& reply)
+{
+  if(reply.find("\u001b_Gi=31;OK") != std::string::npos) { return Term::Graphics::Kitty; }
+  const std::size_t begin{reply.find("\u001b[?")};
+  if(begin == std::string::npos) { return Term::Graphics::None; }
+  const std::size_t end{reply.find('c', begin)};
+  if(end == std::string::npos) { return Term::Graphics::None; }
+  // The attributes follow the conformance level: ESC [ ? 62 ; 4 ; 22 c
+  std::size_t attribute{begin + 3};
+  while(attribute < end)
+  {
+    std::size_t next{reply.find(';', attribute)};
+    if(next == std::string::npos || next > end) { next = end; }
+    if(attribute != begin + 3 && reply.compare(attribute, next - attribute, "4") == 0) { return Term::Graphics::Sixel; }
+    attribute = next + 1;
+  }
+  return Term::Graphics::None;
+}
+
+Term::SixelEncoder::SixelEncoder(const std::size_t& colors) : m_colors(colors), m_count(32768, 0), m_sums(3 * 32768, 0), m_index(32768, 0)
+{
+  if(colors == 0 || colors > 256) { throw Term::Exception("SixelEncoder: between 1 and 256 colors"); }
+}
+
+void Term::SixelEncoder::bounds(Box& box) const
+{
+  std::fill(box.min, box.min + 3, 31);
+  std::fill(box.max, box.max + 3, 0);
+  for(std::size_t i = box.begin; i != box.end; ++i)
+  {
+    for(std::size_t c = 0; c != 3; ++c)
+    {
+      box.min[c] = std::min(box.min[c], channel(m_bins[i], c));
+      box.max[c] = std::max(box.max[c], channel(m_bins[i], c));
+    }
+  }
+}
+
+void Term::SixelEncoder::quantize(const Term::Image& image)
+{
+  m_bins.clear();
+  for(std::size_t y = 0; y != image.height(); ++y)
+  {
+    const std::uint8_t* pixel{image.row(y)};
+    for(std::size_t x = 0; x != image.width(); ++x, pixel += image.channels())
+    {
+      if(transparent(image, pixel)) { continue; }
+      const std::uint16_t key{bin(pixel)};
+      if(m_count[key]++ == 0) { m_bins.push_back(key); }
+      m_sums[3 * key] += pixel[0];
+      m_sums[3 * key + 1] += pixel[1];
+      m_sums[3 * key + 2] += pixel[2];
+    }
+  }
+  // Median cut: split the box with the widest channel at the median of its pixels until there are enough colors
+  m_boxes.clear();
+  if(!m_bins.empty())
+  {
+    Box all;
+    all.end = m_bins.size();
+    bounds(all);
+    m_boxes.push_back(all);
+  }
+  while(m_boxes.size() < m_colors)
+  {
+    int         range{0};
+    std::size_t widest{m_boxes.size()};
+    std::size_t axis{0};
+    for(std::size_t i = 0; i != m_boxes.size(); ++i)
+    {
+      for(std::size_t c = 0; c != 3; ++c)
+      {
+        if(m_boxes[i].max[c] - m_boxes[i].min[c] > range)
+        {
+          range  = m_boxes[i].max[c] - m_boxes[i].min[c];
+          widest = i;
+          axis   = c;
+        }
+      }
+    }
+    // A single bin per box: every color has its own entry already
+    if(widest == m_boxes.size()) { break; }
+    Box& box{m_boxes[widest]};
+    std::sort(m_bins.begin() + static_cast<long>(box.begin), m_bins.begin() + static_cast<long>(box.end), [axis](const std::uint16_t& a, const std::uint16_t& b) { return channel(a, axis) < channel(b, axis); });
+    std::uint64_t total{0};
+    for(std::size_t j = box.begin; j != box.end; ++j) { total += m_count[m_bins[j]]; }
+    std::uint64_t below{m_count[m_bins[box.begin]]};
+    std::size_t   median{box.begin + 1};
+    while(median + 1 < box.end && 2 * (below + m_count[m_bins[median]]) <= total) { below += m_count[m_bins[median++]]; }
+    Box upper;
+    upper.begin = median;
+    upper.end   = box.end;
+    box.end     = median;
+    bounds(box);
+    bounds(upper);
+    m_boxes.push_back(upper);
+  }
+  // Each bin is mapped to its box, whose color is the average of its pixels
+  m_palette.resize(3 * m_boxes.size());
+  for(std::size_t i = 0; i != m_boxes.size(); ++i)
+  {
+    std::uint64_t count{0};
+    std::uint64_t sums[3]{0, 0, 0};
+    for(std::size_t j = m_boxes[i].begin; j != m_boxes[i].end; ++j)
+    {
+      const std::uint16_t key{m_bins[j]};
+      m_index[key] = static_cast<std::uint8_t>(i);
+      count += m_count[key];
+      for(std::size_t c = 0; c != 3; ++c) { sums[c] += m_sums[3 * key + c]; }
+      m_count[key] = 0;
+      std::fill(&m_sums[3 * key], &m_sums[3 * key] + 3, 0);
+    }
+    for(std::size_t c = 0; c != 3; ++c) { m_palette[3 * i + c] = static_cast<std::uint8_t>((sums[c] + count / 2) / count); }
+  }
+}
+
+void Term::SixelEncoder::encode(std::string& out, const Term::Image& image)
+{
+  quantize(image);
+  const std::size_t colors{m_boxes.size()};
+  const std::size_t width{image.width()};
+  // P2 = 1: the pixels without color keep the background
+  out.append("\u001bP0;1;0q\"1;1;");
+  append_decimal(out, width);
+  out.push_back(';');
+  append_decimal(out, image.height());
+  for(std::size_t i = 0; i != colors; ++i)
+  {
+    out.push_back('#');
+    append_decimal(out, i);
+    out.append(";2;");
+    for(std::size_t c = 0; c != 3; ++c)
+    {
+      append_decimal(out, (m_palette[3 * i + c] * 100U + 127U) / 255U);
+      if(c != 2) { out.push_back(';'); }
+    }
+  }
+  m_sixels.resize(colors * width);
+  m_last.assign(colors, 0);
+  for(std::size_t top = 0; top < image.height(); top += 6)
+  {
+    // The 6 bits of each column for each color of the band, and the last column used by the color
+    for(std::size_t bit = 0; bit != 6 && top + bit != image.height(); ++bit)
+    {
+      const std::uint8_t* pixel{image.row(top + bit)};
+      for(std::size_t x = 0; x != width; ++x, pixel += image.channels())
+      {
+        if(transparent(image, pixel)) { continue; }
+        const std::size_t color{m_index[bin(pixel)]};
+        m_sixels[color * width + x] |= static_cast<std::uint8_t>(1U << bit);
+        m_last[color] = std::max(m_last[color], x + 1);
+      }
+    }
+    bool first{true};
+    for(std::size_t color = 0; color != colors; ++color)
+    {
+      if(m_last[color] == 0) { continue; }
+      // Back to the start of the band for each color after the first
+      if(!first) { out.push_back('$'); }
+      first = false;
+      out.push_back('#');
+      append_decimal(out, color);
+      std::uint8_t* sixels{&m_sixels[color * width]};
+      for(std::size_t x = 0; x != m_last[color];)
+      {
+        std::size_t run{1};
+        while(x + run != m_last[color] && sixels[x + run] == sixels[x]) { ++run; }
+        const char sixel{static_cast<char>('?' + sixels[x])};
+        if(run > 3)
+        {
+          out.push_back('!');
+          append_decimal(out, run);
+          out.push_back(sixel);
+        }
+        else { out.append(run, sixel); }
+        x += run;
+      }
+      std::fill(sixels, sixels + m_last[color], 0);
+      m_last[color] = 0;
+    }
+    if(top + 6 < image.height()) { out.push_back('-'); }
+  }
+  out.append("\u001b\\");
+}
+
+namespace
+{
+
+const constexpr char base64[65]{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+
+void append_base64(std::string& out, const std::uint8_t* data, const std::size_t& size)
+{
+  const std::size_t begin{out.size()};
+  out.resize(begin + (size + 2) / 3 * 4);
+  char*       it{&out[begin]};
+  std::size_t i{0};
+  for(; i + 3 <= size; i += 3)
+  {
+    const std::uint32_t bits{(static_cast<std::uint32_t>(data[i]) << 16U) | (static_cast<std::uint32_t>(data[i + 1]) << 8U) | data[i + 2]};
+    *it++ = base64[(bits >> 18U) & 0x3FU];
+    *it++ = base64[(bits >> 12U) & 0x3FU];
+    *it++ = base64[(bits >> 6U) & 0x3FU];
+    *it++ = base64[bits & 0x3FU];
+  }
+  if(i != size)
+  {
+    const std::uint32_t bits{(static_cast<std::uint32_t>(data[i]) << 16U) | (i + 1 != size ? static_cast<std::uint32_t>(data[i + 1]) << 8U : 0U)};
+    *it++ = base64[(bits >> 18U) & 0x3FU];
+    *it++ = base64[(bits >> 12U) & 0x3FU];
+    *it++ = i + 1 != size ? base64[(bits >> 6U) & 0x3FU] : '=';
+    *it++ = '=';
+  }
+}
+
+// Not cryptographic: detects an image changing between two frames, 8 bytes at a time
+std::uint64_t hash(const Term::Image& image)
+{
+  std::uint64_t     ret{0x9E3779B97F4A7C15ULL ^ (image.width() << 32U) ^ (image.height() << 4U) ^ image.channels()};
+  const std::size_t size{image.width() * image.channels()};
+  for(std::size_t y = 0; y != image.height(); ++y)
+  {
+    const std::uint8_t* row{image.row(y)};
+    std::size_t         x{0};
+    for(; x + 8 <= size; x += 8)
+    {
+      std::uint64_t word;
+      std::memcpy(&word, row + x, 8);
+      ret = (ret ^ word) * 0xFF51AFD7ED558CCDULL;
+      ret ^= ret >> 29U;
+    }
+    for(; x != size; ++x) { ret = (ret ^ row[x]) * 0x100000001B3ULL; }
+  }
+  return ret;
+}
+
+void append_placement(std::string& out, const std::uint32_t& id, const std::size_t& columns, const std::size_t& rows)
+{
+  out.append("i=");
+  append_decimal(out, id);
+  if(columns != 0)
+  {
+    out.append(",c=");
+    append_decimal(out, columns);
+  }
+  if(rows != 0)
+  {
+    out.append(",r=");
+    append_decimal(out, rows);
+  }
+  // No OK or error replies, they would end up in the input
+  out.append(",q=2");
+}
+
+}  // namespace
+
+void Term::KittyEncoder::encode(std::string& out, const Term::Image& image, const std::uint32_t& id, const std::size_t& columns, const std::size_t& rows)
+{
+  if(image.width() == 0 || image.height() == 0) { return; }
+  const std::uint64_t                                        fingerprint{hash(image)};
+  std::unordered_map<std::uint32_t, std::uint64_t>::iterator sent{m_sent.find(id)};
+  if(sent != m_sent.end() && sent->second == fingerprint)
+  {
+    out.append("\u001b_Ga=p,");
+    append_placement(out, id, columns, rows);
+    out.append("\u001b\\");
+    return;
+  }
+  m_sent[id] = fingerprint;
+  const std::size_t   row_size{image.width() * image.channels()};
+  const std::size_t   size{row_size * image.height()};
+  const std::uint8_t* pixels{image.row(0)};
+  if(image.stride() != row_size)
+  {
+    m_packed.resize(size);
+    for(std::size_t y = 0; y != image.height(); ++y) { std::memcpy(&m_packed[y * row_size], image.row(y), row_size); }
+    pixels = m_packed.data();
+  }
+  // 3072 bytes of pixels make the 4096 bytes of base64 allowed per chunk
+  const std::size_t chunk{3072};
+  out.reserve(out.size() + (size + 2) / 3 * 4 + (size / chunk + 1) * 16 + 64);
+  for(std::size_t offset = 0; offset < size; offset += chunk)
+  {
+    out.append("\u001b_G");
+    if(offset == 0)
+    {
+      out.append(image.channels() == 4 ? "a=T,f=32,s=" : "a=T,f=24,s=");
+      append_decimal(out, image.width());
+      out.append(",v=");
+      append_decimal(out, image.height());
+      out.push_back(',');
+      append_placement(out, id, columns, rows);
+      out.push_back(',');
+    }
+    out.append(offset + chunk < size ? "m=1;" : "m=0;");
+    append_base64(out, pixels + offset, std::min(chunk, size - offset));
+    out.append("\u001b\\");
+  }
+}
+
+void Term::KittyEncoder::erase(std::string& out, const std::uint32_t& id)
+{
+  out.append("\u001b_Ga=d,d=I,i=");
+  append_decimal(out, id);
+  out.append(",q=2\u001b\\");
+  m_sent.erase(id);
+}
+
+void Term::KittyEncoder::clear() { m_sent.clear(); }
@@ -0,0 +1,111 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Term
+{
+
+class Image;
+
+///
+/// @brief Inline image protocols, by order of preference.
+///
+enum class Graphics : std::uint8_t
+{
+  None,
+  Sixel,  ///< DEC Sixel (xterm -ti vt340, foot, mlterm, WezTerm, Windows Terminal...).
+  Kitty   ///< kitty graphics protocol (kitty, WezTerm, Ghostty, Konsole...).
+};
+
+///
+/// @brief The query sent to the terminal to detect its inline image protocols: a kitty graphics query followed by the primary device attributes request (DA1).
+///
+std::string graphics_query();
+
+///
+/// @brief The best protocol announced in \b reply , the answer of the terminal to \b graphics_query() .
+///
+/// Terminals ignoring the kitty query only answer DA1, which lists Sixel support as attribute 4.
+///
+Term::Graphics graphics_support(const std::string& reply);
+
+///
+/// @brief Encode images as Sixel DCS sequences.
+///
+/// The colors are reduced to a palette of at most \b colors entries with a median cut over a 15 bits histogram, then each band of 6 rows is written color by color with run-length compression.
+/// RGBA pixels with an alpha below 128 are left transparent. The buffers are kept between calls so encoding frames of the same size does not allocate.
+///
+class SixelEncoder
+{
+public:
+  explicit SixelEncoder(const std::size_t& colors = 256);
+
+  ///
+  /// @brief Append to \b out the sequence drawing \b image at the cursor position.
+  ///
+  void encode(std::string& out, const Term::Image& image);
+
+private:
+  struct Box
+  {
+    std::size_t  begin{0};
+    std::size_t  end{0};
+    std::uint8_t min[3]{0, 0, 0};
+    std::uint8_t max[3]{0, 0, 0};
+  };
+  void                       bounds(Box& box) const;
+  void                       quantize(const Term::Image& image);
+  std::size_t                m_colors{256};
+  std::vector<std::uint32_t> m_count;
+  std::vector<std::uint64_t> m_sums;
+  std::vector<std::uint16_t> m_bins;
+  std::vector<std::uint8_t>  m_index;
+  std::vector<Box>           m_boxes;
+  std::vector<std::uint8_t>  m_palette;
+  std::vector<std::uint8_t>  m_sixels;
+  std::vector<std::size_t>   m_last;
+};
+
+///
+/// @brief Encode images with the kitty graphics protocol.
+///
+/// Images are identified by the caller: an image already sent with the same \b id and the same pixels is only placed again, without transmitting its pixels.
+/// The pixels are sent uncompressed (RGB or RGBA) in base64 chunks of 4096 bytes.
+///
+class KittyEncoder
+{
+public:
+  ///
+  /// @brief Append to \b out the sequences displaying \b image at the cursor position, scaled to \b columns x \b rows cells if not 0.
+  ///
+  void encode(std::string& out, const Term::Image& image, const std::uint32_t& id, const std::size_t& columns = 0, const std::size_t& rows = 0);
+
+  ///
+  /// @brief Append to \b out the sequence deleting the image \b id and its placements.
+  ///
+  void erase(std::string& out, const std::uint32_t& id);
+
+  ///
+  /// @brief Forget the images sent, the next \b encode() transmits them again (after the terminal was reset for example).
+  ///
+  void clear();
+
+private:
+  std::unordered_map<std::uint32_t, std::uint64_t> m_sent;
+  std::vector<std::uint8_t>                        m_packed;
+};
+
+}  // namespace Term
@@ -0,0 +1,304 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/highlight.hpp"
+
+#include "cpp-terminal/exception.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace
+{
+
+bool is_digit(const char& character) { return character >= '0' && character <= '9'; }
+
+const constexpr std::uint8_t separator{1};
+const constexpr std::uint8_t quote{2};
+const constexpr char         whitespace[]{'\0', ' ', '\t', '\n', '\r', '\v', '\f'};
+
+bool starts_with(const std::string& line, const std::size_t& position, const std::string& prefix) { return line.compare(position, prefix.size(), prefix) == 0; }
+
+}  // namespace
+
+Term::Color Term::highlight_color(const Term::Highlight& highlight)
+{
+  switch(highlight)
+  {
+    case Highlight::Comment: return Term::Color::Name::BrightCyan;
+    case Highlight::MultilineComment: return Term::Color::Name::Cyan;
+    case Highlight::Keyword: return Term::Color::Name::Yellow;
+    case Highlight::Type: return Term::Color::Name::Green;
+    case Highlight::String: return Term::Color::Name::Magenta;
+    case Highlight::Number: return Term::Color::Name::Red;
+    case Highlight::Normal:
+    default: return Term::Color::Name::Default;
+  }
+}
+
+Term::Syntax Term::Syntax::c()
+{
+  Syntax syntax;
+  syntax.filetype      = "c";
+  syntax.extensions    = {".c", ".h", ".hpp", ".cpp"};
+  syntax.keywords      = {"switch", "if", "while", "for", "break", "continue", "return", "else", "struct", "union", "typedef", "static", "enum", "class", "case", "do", "goto", "default", "const", "sizeof", "namespace", "template", "typename", "public", "private", "protected", "virtual", "inline", "new", "delete", "try", "catch", "throw"};
+  syntax.types         = {"int", "long", "double", "float", "char", "unsigned", "signed", "void", "bool", "short", "auto"};
+  syntax.line_comment  = "//";
+  syntax.comment_start = "/*";
+  syntax.comment_end   = "*/";
+  syntax.quotes        = "\"'";
+  syntax.numbers       = true;
+  return syntax;
+}
+
+bool Term::Syntax::matches(const std::string& filename) const
+{
+  for(const std::string& extension: extensions)
+  {
+    if(filename.size() >= extension.size() && filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0) { return true; }
+  }
+  return false;
+}
+
+Term::Syntax::State Term::Syntax::highlight(const std::string& line, const State& start, std::vector<Term::Highlight>& highlights) const
+{
+  highlights.assign(line.size(), Highlight::Normal);
+  // What each byte is, instead of searching the separators and quotes for every byte of the line
+  std::array<std::uint8_t, 256> classes{};
+  for(const char& character: whitespace) { classes[static_cast<unsigned char>(character)] = separator; }
+  for(const char& character: separators) { classes[static_cast<unsigned char>(character)] |= separator; }
+  for(const char& character: quotes) { classes[static_cast<unsigned char>(character)] |= quote; }
+  const auto  is_separator = [&classes](const char& character) { return (classes[static_cast<unsigned char>(character)] & separator) != 0; };
+  const bool  multiline{!comment_start.empty() && !comment_end.empty()};
+  bool        in_comment{multiline && start == State::Comment};
+  char        in_string{0};
+  bool        previous_separator{true};
+  std::string word;
+  std::size_t i{0};
+  while(i < line.size())
+  {
+    const char      character{line[i]};
+    const Highlight previous{i > 0 ? highlights[i - 1] : Highlight::Normal};
+    if(in_comment)
+    {
+      // Straight to the end of the comment
+      const std::size_t end{line.find(comment_end, i)};
+      const std::size_t stop{end == std::string::npos ? line.size() : end + comment_end.size()};
+      std::fill(highlights.begin() + static_cast<std::ptrdiff_t>(i), highlights.begin() + static_cast<std::ptrdiff_t>(stop), Highlight::MultilineComment);
+      i = stop;
+      if(end != std::string::npos)
+      {
+        in_comment         = false;
+        previous_separator = true;
+      }
+      continue;
+    }
+    if(in_string != 0)
+    {
+      highlights[i] = Highlight::String;
+      if(character == '\\' && i + 1 < line.size())
+      {
+        highlights[i + 1] = Highlight::String;
+        i += 2;
+        continue;
+      }
+      if(character == in_string) { in_string = 0; }
+      ++i;
+      previous_separator = true;
+      continue;
+    }
+    if(!line_comment.empty() && character == line_comment[0] && starts_with(line, i, line_comment))
+    {
+      std::fill(highlights.begin() + static_cast<std::ptrdiff_t>(i), highlights.end(), Highlight::Comment);
+      break;
+    }
+    if(multiline && character == comment_start[0] && starts_with(line, i, comment_start))
+    {
+      std::fill_n(highlights.begin() + static_cast<std::ptrdiff_t>(i), comment_start.size(), Highlight::MultilineComment);
+      i += comment_start.size();
+      in_comment = true;
+      continue;
+    }
+    if((classes[static_cast<unsigned char>(character)] & quote) != 0)
+    {
+      in_string       = character;
+      highlights[i++] = Highlight::String;
+      continue;
+    }
+    if(numbers && ((is_digit(character) && (previous_separator || previous == Highlight::Number)) || (character == '.' && previous == Highlight::Number)))
+    {
+      highlights[i++]    = Highlight::Number;
+      previous_separator = false;
+      continue;
+    }
+    if(previous_separator && !is_separator(character))
+    {
+      // The whole word is looked up at once, its end is the next separator
+      std::size_t end{i + 1};
+      while(end < line.size() && !is_separator(line[end])) { ++end; }
+      word.assign(line, i, end - i);
+      const Highlight found{keywords.count(word) != 0 ? Highlight::Keyword : (types.count(word) != 0 ? Highlight::Type : Highlight::Normal)};
+      if(found != Highlight::Normal)
+      {
+        std::fill(highlights.begin() + static_cast<std::ptrdiff_t>(i), highlights.begin() + static_cast<std::ptrdiff_t>(end), found);
+        i                  = end;
+        previous_separator = false;
+        continue;
+      }
+    }
+    previous_separator = is_separator(character);
+    ++i;
+  }
+  return in_comment ? State::Comment : State::Normal;
+}
+
+Term::Highlighter::Highlighter(const Term::Syntax& syntax) : m_syntax(std::make_shared<const Term::Syntax>(syntax)) {}
+
+void Term::Highlighter::set_syntax(const Term::Syntax& syntax)
+{
+  const std::shared_ptr<const Term::Syntax> replacement{std::make_shared<const Term::Syntax>(syntax)};
+  const std::lock_guard<std::mutex>         lock(m_mutex);
+  m_syntax = replacement;
+  for(std::size_t row = 0; row != m_lines.size(); ++row) { touch(row); }
+}
+
+std::size_t Term::Highlighter::lines() const
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  return m_lines.size();
+}
+
+void Term::Highlighter::insert(const std::size_t& row, const std::string& text)
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  insert_line(row, text);
+}
+
+void Term::Highlighter::erase(const std::size_t& row)
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  erase_line(row);
+}
+
+void Term::Highlighter::set(const std::size_t& row, const std::string& text)
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  set_line(row, text);
+}
+
+void Term::Highlighter::assign(const std::vector<std::string>& text)
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  for(std::size_t row = 0; row != std::min(text.size(), m_lines.size()); ++row) { set_line(row, text[row]); }
+  while(m_lines.size() > text.size()) { erase_line(m_lines.size() - 1); }
+  for(std::size_t row = m_lines.size(); row != text.size(); ++row) { insert_line(row, text[row]); }
+}
+
+std::size_t Term::Highlighter::pending() const
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  return m_pending;
+}
+
+std::size_t Term::Highlighter::update(const std::size_t& limit)
+{
+  std::size_t                  ret{0};
+  std::vector<Term::Highlight> highlights;
+  std::string                  text;
+  while(ret < limit)
+  {
+    std::size_t                         row{0};
+    std::uint64_t                       version{0};
+    Term::Syntax::State                 state{Term::Syntax::State::Normal};
+    std::shared_ptr<const Term::Syntax> syntax;
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      if(m_pending == 0)
+      {
+        m_first_dirty = m_lines.size();
+        break;
+      }
+      while(!m_lines[m_first_dirty].dirty) { ++m_first_dirty; }
+      row     = m_first_dirty;
+      version = m_lines[row].version;
+      state   = start(row);
+      syntax  = m_syntax;
+      text.assign(m_lines[row].text);
+    }
+    // Unlocked, the lines can be edited meanwhile
+    const Term::Syntax::State end{syntax->highlight(text, state, highlights)};
+    ++ret;
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    // Kept only if nothing it depends on changed, otherwise the line is still dirty and is highlighted again
+    if(row >= m_lines.size() || m_lines[row].version != version || start(row) != state || m_syntax != syntax) { continue; }
+    Line& line{m_lines[row]};
+    line.highlights.swap(highlights);
+    line.dirty = false;
+    --m_pending;
+    if(line.end != end)
+    {
+      line.end = end;
+      if(row + 1 < m_lines.size()) { touch(row + 1); }
+    }
+  }
+  return ret;
+}
+
+std::vector<Term::Highlight> Term::Highlighter::highlights(const std::size_t& row) const
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  if(row >= m_lines.size()) { throw Term::Exception("Highlighter row out of range"); }
+  std::vector<Term::Highlight> ret{m_lines[row].highlights};
+  ret.resize(m_lines[row].text.size(), Highlight::Normal);
+  return ret;
+}
+
+void Term::Highlighter::insert_line(const std::size_t& row, const std::string& text)
+{
+  if(row > m_lines.size()) { throw Term::Exception("Highlighter row out of range"); }
+  Line line;
+  line.text    = text;
+  line.version = ++m_version;
+  m_lines.insert(m_lines.begin() + static_cast<std::ptrdiff_t>(row), std::move(line));
+  ++m_pending;
+  m_first_dirty = std::min(m_first_dirty, row);
+  // The next line started where the previous one ended, the new line may end differently
+  if(row + 1 < m_lines.size()) { touch(row + 1); }
+}
+
+void Term::Highlighter::erase_line(const std::size_t& row)
+{
+  if(row >= m_lines.size()) { throw Term::Exception("Highlighter row out of range"); }
+  if(m_lines[row].dirty) { --m_pending; }
+  m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(row));
+  if(row < m_lines.size()) { touch(row); }
+}
+
+void Term::Highlighter::set_line(const std::size_t& row, const std::string& text)
+{
+  if(row >= m_lines.size()) { throw Term::Exception("Highlighter row out of range"); }
+  if(m_lines[row].text == text) { return; }
+  m_lines[row].text    = text;
+  m_lines[row].version = ++m_version;
+  touch(row);
+}
+
+void Term::Highlighter::touch(const std::size_t& row)
+{
+  if(!m_lines[row].dirty)
+  {
+    m_lines[row].dirty = true;
+    ++m_pending;
+  }
+  m_first_dirty = std::min(m_first_dirty, row);
+}
+
+Term::Syntax::State Term::Highlighter::start(const std::size_t& row) const { return row == 0 ? Term::Syntax::State::Normal : m_lines[row - 1].end; }
@@ -0,0 +1,166 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include "cpp-terminal/color.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace Term
+{
+
+///
+/// @brief The class of a byte of highlighted text.
+///
+enum class Highlight : std::uint8_t
+{
+  Normal,
+  Comment,           ///< A comment up to the end of the line.
+  MultilineComment,  ///< A comment between \b Syntax::comment_start and \b Syntax::comment_end .
+  Keyword,
+  Type,
+  String,
+  Number
+};
+
+///
+/// @brief The color editors and prompts show \b highlight in.
+///
+Term::Color highlight_color(const Term::Highlight& highlight);
+
+///
+/// @brief The rules highlighting a language, declared rather than coded : comments, quotes and sets of words.
+///
+/// A word is a run of characters which are not separators ; it is looked up in the hashed sets of keywords and types, whatever their number.
+///
+class Syntax
+{
+public:
+  ///
+  /// @brief What a line leaves open for the next one.
+  ///
+  enum class State : std::uint8_t
+  {
+    Normal,
+    Comment  ///< Inside a multiline comment.
+  };
+
+  ///
+  /// @brief The rules of C and C++.
+  ///
+  static Syntax c();
+
+  ///
+  /// @brief Whether \b filename ends with one of \b extensions .
+  ///
+  bool matches(const std::string& filename) const;
+
+  ///
+  /// @brief Highlight \b line , starting in the state the previous line ended in. Does not touch any shared state, it can run on any thread.
+  ///
+  /// @param highlights Resized to the bytes of \b line , one class per byte.
+  /// @return The state the line ends in.
+  ///
+  State highlight(const std::string& line, const State& start, std::vector<Term::Highlight>& highlights) const;
+
+  std::string                     filetype;
+  std::vector<std::string>        extensions;                      ///< File extensions, dot included.
+  std::unordered_set<std::string> keywords;
+  std::unordered_set<std::string> types;
+  std::string                     line_comment;                    ///< Starts a comment up to the end of the line, none if empty.
+  std::string                     comment_start;                   ///< Starts a multiline comment, none if empty.
+  std::string                     comment_end;                     ///< Ends it.
+  std::string                     quotes;                          ///< The characters delimiting strings, '\\' escapes in them.
+  std::string                     separators{",.()+-/*=~%<>[];"};  ///< Besides whitespace.
+  bool                            numbers{false};                  ///< Highlight the numbers.
+};
+
+///
+/// @brief The highlighting of a text edited line by line, updated incrementally.
+///
+/// Each line keeps its highlighting and the state it ends in. Edits only mark the lines they change, \b update then highlights those lines and, as long as the state they end in changes (a comment opened or closed), the lines after them.
+/// Every function locks the highlighter : \b update can run on a worker thread while the UI thread edits the lines and draws the highlighting it has. A line edited while it was being highlighted is highlighted again.
+///
+class Highlighter
+{
+public:
+  ///
+  /// @brief A highlighter with no lines, highlighting with \b syntax (no rules at all by default).
+  ///
+  explicit Highlighter(const Term::Syntax& syntax = Term::Syntax());
+  Highlighter(const Highlighter&)            = delete;
+  Highlighter(Highlighter&&)                 = delete;
+  Highlighter& operator=(const Highlighter&) = delete;
+  Highlighter& operator=(Highlighter&&)      = delete;
+
+  ///
+  /// @brief Change the rules, every line has to be highlighted again.
+  ///
+  void set_syntax(const Term::Syntax& syntax);
+
+  std::size_t lines() const;
+  void        insert(const std::size_t& row, const std::string& text);
+  void        erase(const std::size_t& row);
+  ///
+  /// @brief Change the text of \b row , nothing to do if it is unchanged.
+  ///
+  void set(const std::size_t& row, const std::string& text);
+  ///
+  /// @brief Make the lines those of \b text , only the lines which differ have to be highlighted again.
+  ///
+  void assign(const std::vector<std::string>& text);
+
+  ///
+  /// @brief The lines to highlight again.
+  ///
+  std::size_t pending() const;
+
+  ///
+  /// @brief Highlight at most \b limit of the pending lines, first to last.
+  ///
+  /// @return The lines highlighted.
+  ///
+  std::size_t update(const std::size_t& limit = std::numeric_limits<std::size_t>::max());
+
+  ///
+  /// @brief The highlighting of \b row , one class per byte of its text. It is the one of a previous text until the line is updated again, missing bytes are \b Highlight::Normal .
+  ///
+  std::vector<Term::Highlight> highlights(const std::size_t& row) const;
+
+private:
+  struct Line
+  {
+    std::string                  text;
+    std::vector<Term::Highlight> highlights;
+    Term::Syntax::State          end{Term::Syntax::State::Normal};
+    std::uint64_t                version{0};  ///< Changes with the text, unique to the line.
+    bool                         dirty{true};
+  };
+  void                                insert_line(const std::size_t& row, const std::string& text);
+  void                                erase_line(const std::size_t& row);
+  void                                set_line(const std::size_t& row, const std::string& text);
+  void                                touch(const std::size_t& row);
+  Term::Syntax::State                 start(const std::size_t& row) const;
+  mutable std::mutex                  m_mutex;
+  std::shared_ptr<const Term::Syntax> m_syntax;  ///< Replaced, never changed, so that update can use it unlocked.
+  std::vector<Line>                   m_lines;
+  std::size_t                         m_first_dirty{0};  ///< No dirty line before it.
+  std::size_t                         m_pending{0};
+  std::uint64_t                       m_version{0};
+};
+
+}  // namespace Term
@@ -0,0 +1,257 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/history.hpp"
+
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/private/shared_file.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+
+// Over that many new records the duplicates are found in one pass over the whole history
+const constexpr std::size_t rebuild_threshold{64};
+
+// Over that size the history is compacted once the copies superseded by newer duplicates are more than half of it
+const constexpr std::size_t compaction_threshold{65536};
+
+// Searched backwards by chunks, each scanned forward with memchr for the byte of the needle that is the rarest in the history
+const constexpr std::size_t chunk_size{65536};
+
+class ReverseSearch
+{
+public:
+  ReverseSearch(const std::string& needle, const std::array<std::size_t, 256>& frequencies) : m_needle(needle)
+  {
+    for(std::size_t i = 1; i != needle.size(); ++i)
+    {
+      if(frequencies[static_cast<unsigned char>(needle[i])] < frequencies[static_cast<unsigned char>(needle[m_rare])]) { m_rare = i; }
+    }
+  }
+  // The start of the last occurrence ending at or before end, or npos
+  std::size_t last(const char* data, std::size_t end) const
+  {
+    const std::size_t size{m_needle.size()};
+    const std::size_t chunk{std::max(chunk_size, 2 * size)};
+    while(end >= size)
+    {
+      const std::size_t begin{end > chunk ? end - chunk : 0};
+      const char*       from{data + begin + m_rare};
+      const char* const to{data + end - (size - 1 - m_rare)};
+      std::size_t       ret{std::string::npos};
+      while(from < to)
+      {
+        const char* found{static_cast<const char*>(std::memchr(from, m_needle[m_rare], static_cast<std::size_t>(to - from)))};
+        if(found == nullptr) { break; }
+        const char* start{found - m_rare};
+        if(std::memcmp(start, m_needle.data(), size) == 0) { ret = static_cast<std::size_t>(start - data); }
+        from = found + 1;
+      }
+      if(ret != std::string::npos || begin == 0) { return ret; }
+      end = begin + size - 1;  // an occurrence can straddle the start of the chunk
+    }
+    return std::string::npos;
+  }
+
+private:
+  const std::string& m_needle;
+  std::size_t        m_rare{0};
+};
+
+}  // namespace
+
+Term::History::History(const std::string& file) : m_file(file) { sync(); }
+
+std::size_t Term::History::size() const { return m_entries.size(); }
+
+bool Term::History::empty() const { return m_entries.empty(); }
+
+std::string Term::History::operator[](const std::size_t& index) const
+{
+  if(index >= m_entries.size()) { throw Term::Exception("History index out of range"); }
+  const std::size_t record{m_entries[index]};
+  return m_data.substr(m_offsets[record], m_offsets[record + 1] - m_offsets[record] - 1);
+}
+
+void Term::History::add(const std::string& entry)
+{
+  if(entry.empty()) { return; }
+  if(entry.find('\0') != std::string::npos) { throw Term::Exception("History entries cannot contain '\\0'"); }
+  std::string record{entry};
+  record.push_back('\0');
+  if(!m_file.empty())
+  {
+    // A torn record at the end of the file (a writer that died) is ended before ours, and loaded as an entry of its own
+    Term::Private::FileId id{m_id};
+    const std::string     others{Term::Private::append_file(m_file, m_loaded, record, id)};
+    if(id != m_id)
+    {
+      // Compacted by another process: others is the whole file
+      clear();
+      m_id = id;
+    }
+    m_loaded += others.size() + record.size();
+    load(others);
+  }
+  load(record);
+  if(m_data.size() > compaction_threshold && m_data.size() > 2 * m_live) { compact(); }
+}
+
+void Term::History::sync()
+{
+  if(m_file.empty()) { return; }
+  Term::Private::FileId id{m_id};
+  const std::string     bytes{Term::Private::read_file(m_file, m_loaded, id)};
+  if(id != m_id)
+  {
+    clear();
+    m_id = id;
+  }
+  const std::size_t last{bytes.rfind('\0')};
+  if(last == std::string::npos) { return; }
+  m_loaded += last + 1;
+  load(bytes);
+}
+
+std::size_t Term::History::search(const std::string& needle, const std::size_t& before) const
+{
+  const std::size_t last{std::min(before, m_entries.size())};
+  if(last == 0) { return std::string::npos; }
+  if(needle.empty()) { return last - 1; }
+  const ReverseSearch reverse(needle, m_frequencies);
+  std::size_t         end{m_offsets[m_entries[last - 1] + 1] - 1};
+  while(true)
+  {
+    const std::size_t match{reverse.last(m_data.data(), end)};
+    if(match == std::string::npos) { break; }
+    // Matches never span two records, they are separated by '\0'
+    const std::size_t record{static_cast<std::size_t>(std::upper_bound(m_offsets.begin(), m_offsets.end(), match) - m_offsets.begin()) - 1};
+    const std::size_t index{index_of(record)};
+    if(index != std::string::npos) { return index; }
+    end = m_offsets[record];  // superseded by a newer duplicate
+  }
+  return std::string::npos;
+}
+
+void Term::History::load(const std::string& bytes)
+{
+  const std::size_t last{bytes.rfind('\0')};
+  if(last == std::string::npos) { return; }
+  const std::size_t first_record{m_offsets.size() - 1};
+  std::size_t       position{m_data.size()};
+  m_data.append(bytes, 0, last + 1);
+  for(std::size_t i = 0; i != last; ++i) { ++m_frequencies[static_cast<unsigned char>(bytes[i])]; }
+  while(position != m_data.size())
+  {
+    position = static_cast<std::size_t>(static_cast<const char*>(std::memchr(&m_data[position], '\0', m_data.size() - position)) - m_data.data()) + 1;
+    m_offsets.push_back(position);
+  }
+  if(m_offsets.size() - 1 - first_record > rebuild_threshold)
+  {
+    rebuild();
+    return;
+  }
+  for(std::size_t record = first_record; record != m_offsets.size() - 1; ++record)
+  {
+    const std::size_t                                   key{hash(record)};
+    const std::pair<Hashes::iterator, Hashes::iterator> range{m_hashes.equal_range(key)};
+    for(Hashes::iterator it = range.first; it != range.second; ++it)
+    {
+      if(equal(it->second, record))
+      {
+        m_live -= m_offsets[it->second + 1] - m_offsets[it->second];
+        m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(index_of(it->second)));
+        m_hashes.erase(it);
+        break;
+      }
+    }
+    m_hashes.emplace(key, static_cast<std::uint32_t>(record));
+    m_entries.push_back(static_cast<std::uint32_t>(record));
+    m_live += m_offsets[record + 1] - m_offsets[record];
+  }
+}
+
+// The newest copy of each entry is kept
+void Term::History::rebuild()
+{
+  const std::size_t records{m_offsets.size() - 1};
+  m_hashes.clear();
+  m_hashes.reserve(records);
+  m_entries.clear();
+  m_live = 0;
+  for(std::size_t record = records; record-- != 0;)
+  {
+    const std::size_t                                   key{hash(record)};
+    const std::pair<Hashes::iterator, Hashes::iterator> range{m_hashes.equal_range(key)};
+    bool                                                duplicate{false};
+    for(Hashes::iterator it = range.first; it != range.second && !duplicate; ++it) { duplicate = equal(it->second, record); }
+    if(duplicate) { continue; }
+    m_hashes.emplace(key, static_cast<std::uint32_t>(record));
+    m_entries.push_back(static_cast<std::uint32_t>(record));
+    m_live += m_offsets[record + 1] - m_offsets[record];
+  }
+  std::reverse(m_entries.begin(), m_entries.end());
+}
+
+void Term::History::clear()
+{
+  m_loaded = 0;
+  m_data.clear();
+  m_offsets.assign(1, 0);
+  m_entries.clear();
+  m_live = 0;
+  m_hashes.clear();
+  m_frequencies.fill(0);
+}
+
+// Only the entries are kept, the file is replaced unless another process did it first (it is then loaded again by the next add() or sync())
+void Term::History::compact()
+{
+  std::string live;
+  live.reserve(m_live);
+  for(const std::uint32_t record: m_entries) { live.append(m_data, m_offsets[record], m_offsets[record + 1] - m_offsets[record]); }
+  Term::Private::FileId id{m_id};
+  const std::string     others{m_file.empty() ? std::string() : Term::Private::replace_file(m_file, m_loaded, live, id)};
+  const std::size_t     loaded{id != m_id ? live.size() + others.size() : m_loaded};
+  clear();
+  m_id     = id;
+  m_loaded = loaded;
+  load(live);
+  load(others);
+}
+
+std::size_t Term::History::index_of(const std::size_t& record) const
+{
+  const std::vector<std::uint32_t>::const_iterator found{std::lower_bound(m_entries.begin(), m_entries.end(), static_cast<std::uint32_t>(record))};
+  if(found == m_entries.end() || *found != record) { return std::string::npos; }
+  return static_cast<std::size_t>(found - m_entries.begin());
+}
+
+// FNV-1a, computed in place instead of hashing a copy of the entry
+std::size_t Term::History::hash(const std::size_t& record) const
+{
+  std::uint64_t ret{14695981039346656037ULL};
+  for(std::size_t i = m_offsets[record]; i != m_offsets[record + 1] - 1; ++i)
+  {
+    ret ^= static_cast<unsigned char>(m_data[i]);
+    ret *= 1099511628211ULL;
+  }
+  return static_cast<std::size_t>(ret);
+}
+
+bool Term::History::equal(const std::size_t& record, const std::size_t& other) const
+{
+  const std::size_t size{m_offsets[record + 1] - m_offsets[record]};
+  return size == m_offsets[other + 1] - m_offsets[other] && std::memcmp(&m_data[m_offsets[record]], &m_data[m_offsets[other]], size) == 0;
+}
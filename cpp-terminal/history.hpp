@@ -0,0 +1,83 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Term
+{
+
+///
+/// @brief The command history of a prompt, optionally kept in a file shared by every process using it.
+///
+/// Entries are numbered from 0 (the oldest) to size() - 1. Adding an entry that is already there moves it to the end, so each entry is seen once when browsing or searching.
+/// The file is only ever appended to, each entry followed by '\\0' ; it is memory mapped when loaded. Appends take an exclusive lock on the file and pick up what other processes added in the meantime.
+/// Once the copies superseded by newer duplicates are more than half of a history over 64 KB, it is compacted : in memory, and the file is replaced by one holding each entry once. The other processes load it again.
+/// In memory the entries are one string with an offset per entry, searched backwards without copying them.
+///
+class History
+{
+public:
+  ///
+  /// @brief A history kept in memory only.
+  ///
+  History() = default;
+  ///
+  /// @brief A history loaded from \b file and saved to it by \b add . The file is created by the first \b add if it does not exist.
+  ///
+  explicit History(const std::string& file);
+
+  std::size_t size() const;
+  bool        empty() const;
+  std::string operator[](const std::size_t& index) const;
+
+  ///
+  /// @brief Append \b entry (and save it to the file). Empty entries are ignored, entries cannot contain '\\0'.
+  ///
+  void add(const std::string& entry);
+
+  ///
+  /// @brief Load the entries other processes appended to the file since it was last read.
+  ///
+  void sync();
+
+  ///
+  /// @brief The newest entry before \b before containing \b needle , for incremental reverse search.
+  ///
+  /// @return Its index, or \b std::string::npos if there is none.
+  ///
+  std::size_t search(const std::string& needle, const std::size_t& before) const;
+
+private:
+  using Hashes = std::unordered_multimap<std::size_t, std::uint32_t>;
+  void                         load(const std::string& bytes);
+  void                         rebuild();
+  void                         clear();
+  void                         compact();
+  std::size_t                  index_of(const std::size_t& record) const;
+  std::size_t                  hash(const std::size_t& record) const;
+  bool                         equal(const std::size_t& record, const std::size_t& other) const;
+  std::string                  m_file;
+  std::array<std::uint64_t, 2> m_id{};            ///< The file loaded, another one once a process compacted it.
+  std::size_t                  m_loaded{0};       ///< Bytes of the file already loaded.
+  std::string                  m_data;            ///< Every record, each followed by '\0' as in the file.
+  std::vector<std::size_t>     m_offsets{0};      ///< Start of each record in m_data, and its end.
+  std::vector<std::uint32_t>   m_entries;         ///< The records not superseded by a newer duplicate, in order.
+  std::size_t                  m_live{0};         ///< Bytes of the records in m_entries.
+  Hashes                       m_hashes;          ///< Hash of each entry to its record.
+  std::array<std::size_t, 256> m_frequencies{};  ///< Occurrences of each byte in m_data, the search looks for the rarest byte of the needle.
+};
+
+}  // namespace Term
@@ -0,0 +1,196 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/image.hpp"
+
+#include "cpp-terminal/color.hpp"
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/window.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <vector>
+
+Term::Image::Image(const std::uint8_t* pixels, const std::size_t& width, const std::size_t& height, const std::size_t& channels, const std::size_t& stride) : m_pixels(pixels), m_width(width), m_height(height), m_channels(channels), m_stride(stride == 0 ? width * channels : stride)
+{
+  if(channels != 3 && channels != 4) { throw Term::Exception("Image: only RGB and RGBA images are supported"); }
+  if(pixels == nullptr && width * height != 0) { throw Term::Exception("Image: no pixels"); }
+  if(m_stride < width * channels) { throw Term::Exception("Image: stride shorter than a row"); }
+}
+
+const std::uint8_t* Term::Image::row(const std::size_t& row) const { return m_pixels + row * m_stride; }
+
+std::size_t Term::Image::width() const { return m_width; }
+
+std::size_t Term::Image::height() const { return m_height; }
+
+std::size_t Term::Image::channels() const { return m_channels; }
+
+std::size_t Term::Image::stride() const { return m_stride; }
+
+namespace
+{
+
+// First pixel of the image covered by the pixel i of a row of size pixels (at least one pixel when enlarging)
+std::size_t first(const std::size_t& i, const std::size_t& size, const std::size_t& image_size) { return i * image_size / size; }
+
+std::size_t last(const std::size_t& i, const std::size_t& size, const std::size_t& image_size)
+{
+  const std::size_t ret{(i + 1) * image_size / size};
+  return ret > first(i, size, image_size) ? ret : first(i, size, image_size) + 1;
+}
+
+// Scale the rows [begin, end) of a width x height RGB version of image into out, averaging the pixels covered (box filter)
+void resample(const Term::Image& image, const std::size_t& width, const std::size_t& height, const std::size_t& begin, const std::size_t& end, std::uint8_t* out)
+{
+  std::vector<std::uint64_t> sums(image.width() * 3);
+  for(std::size_t y = begin; y != end; ++y)
+  {
+    // Sum the rows covered, column by column: the inner loops are vectorized by the compiler
+    std::fill(sums.begin(), sums.end(), 0);
+    const std::size_t y0{first(y, height, image.height())};
+    const std::size_t y1{last(y, height, image.height())};
+    for(std::size_t source = y0; source != y1; ++source)
+    {
+      const std::uint8_t* pixels{image.row(source)};
+      if(image.channels() == 3)
+      {
+        for(std::size_t x = 0; x != sums.size(); ++x) { sums[x] += pixels[x]; }
+      }
+      else
+      {
+        // Premultiplied by alpha: composited over black
+        for(std::size_t x = 0; x != image.width(); ++x)
+        {
+          sums[3 * x] += static_cast<std::uint32_t>(pixels[4 * x]) * pixels[4 * x + 3];
+          sums[3 * x + 1] += static_cast<std::uint32_t>(pixels[4 * x + 1]) * pixels[4 * x + 3];
+          sums[3 * x + 2] += static_cast<std::uint32_t>(pixels[4 * x + 2]) * pixels[4 * x + 3];
+        }
+      }
+    }
+    // Then the columns covered by each pixel
+    for(std::size_t x = 0; x != width; ++x)
+    {
+      const std::size_t x0{first(x, width, image.width())};
+      const std::size_t x1{last(x, width, image.width())};
+      std::uint64_t     rgb[3]{0, 0, 0};
+      for(std::size_t source = x0; source != x1; ++source)
+      {
+        rgb[0] += sums[3 * source];
+        rgb[1] += sums[3 * source + 1];
+        rgb[2] += sums[3 * source + 2];
+      }
+      const std::uint64_t count{static_cast<std::uint64_t>(x1 - x0) * (y1 - y0) * (image.channels() == 4 ? 255 : 1)};
+      for(std::size_t channel = 0; channel != 3; ++channel) { out[(y * width + x) * 3 + channel] = static_cast<std::uint8_t>((rgb[channel] + count / 2) / count); }
+    }
+  }
+}
+
+std::uint32_t distance(const std::uint8_t* a, const std::uint8_t* b)
+{
+  const int red{a[0] - b[0]};
+  const int green{a[1] - b[1]};
+  const int blue{a[2] - b[2]};
+  return static_cast<std::uint32_t>(red * red + green * green + blue * blue);
+}
+
+// The quadrants covered by the foreground: bit 0 top left, 1 top right, 2 bottom left, 3 bottom right
+const constexpr char32_t quadrants[16]{U' ', U'▘', U'▝', U'▀', U'▖', U'▌', U'▞', U'▛', U'▗', U'▚', U'▐', U'▜', U'▄', U'▙', U'▟', U'█'};
+
+// Split the 4 pixels of a cell in the two groups of colors closest to their average
+char32_t split(const std::uint8_t* const pixels[4], std::uint8_t fg[3], std::uint8_t bg[3])
+{
+  std::uint32_t best_error{0xFFFFFFFF};
+  char32_t      ret{U' '};
+  // Masks 0 to 7: the bottom right pixel is always in the background, the other masks are the same splits with fg and bg swapped
+  for(std::uint8_t mask = 0; mask != 8; ++mask)
+  {
+    std::uint32_t sum[2][3]{
+      {0, 0, 0},
+      {0, 0, 0}
+    };
+    std::uint32_t count[2]{0, 0};
+    for(std::size_t pixel = 0; pixel != 4; ++pixel)
+    {
+      const std::size_t group{(mask >> pixel) & 1U};
+      ++count[group];
+      for(std::size_t channel = 0; channel != 3; ++channel) { sum[group][channel] += pixels[pixel][channel]; }
+    }
+    std::uint8_t mean[2][3]{};
+    for(std::size_t group = 0; group != 2; ++group)
+    {
+      if(count[group] == 0) { continue; }
+      for(std::size_t channel = 0; channel != 3; ++channel) { mean[group][channel] = static_cast<std::uint8_t>((sum[group][channel] + count[group] / 2) / count[group]); }
+    }
+    std::uint32_t error{0};
+    for(std::size_t pixel = 0; pixel != 4; ++pixel) { error += distance(pixels[pixel], mean[(mask >> pixel) & 1U]); }
+    if(error < best_error)
+    {
+      best_error = error;
+      ret        = quadrants[mask];
+      for(std::size_t channel = 0; channel != 3; ++channel)
+      {
+        fg[channel] = mean[1][channel];
+        bg[channel] = mean[0][channel];
+      }
+      if(error == 0) { break; }
+    }
+  }
+  return ret;
+}
+
+}  // namespace
+
+void Term::draw_image(Term::Window& window, const std::size_t& column, const std::size_t& row, const std::size_t& columns, const std::size_t& rows, const Image& image, const Blitter& blitter, const std::size_t& threads)
+{
+  if(columns == 0 || rows == 0 || image.width() == 0 || image.height() == 0) { return; }
+  if(!window.insideWindow(column, row) || !window.insideWindow(column + columns - 1, row + rows - 1)) { throw Term::Exception("draw_image(): the cells are out of the window"); }
+  const std::size_t         width{blitter == Blitter::Quadrant ? 2 * columns : columns};
+  const std::size_t         height{2 * rows};
+  std::vector<std::uint8_t> pixels(width * height * 3);
+  // Each thread scales a band of rows
+  const std::size_t bands{threads == 0 ? 1 : (threads > rows ? rows : threads)};
+  if(bands == 1) { resample(image, width, height, 0, height, pixels.data()); }
+  else
+  {
+    std::vector<std::thread> workers;
+    for(std::size_t band = 1; band != bands; ++band) { workers.emplace_back(resample, std::cref(image), width, height, 2 * (band * rows / bands), 2 * ((band + 1) * rows / bands), pixels.data()); }
+    resample(image, width, height, 0, 2 * (rows / bands), pixels.data());
+    for(std::size_t i = 0; i != workers.size(); ++i) { workers[i].join(); }
+  }
+  for(std::size_t j = 0; j != rows; ++j)
+  {
+    const std::uint8_t* top{&pixels[(2 * j) * width * 3]};
+    const std::uint8_t* bottom{&pixels[(2 * j + 1) * width * 3]};
+    for(std::size_t i = 0; i != columns; ++i)
+    {
+      char32_t     character{U'▀'};
+      std::uint8_t fg[3]{};
+      std::uint8_t bg[3]{};
+      if(blitter == Blitter::Quadrant)
+      {
+        const std::uint8_t* const cell[4]{top + 6 * i, top + 6 * i + 3, bottom + 6 * i, bottom + 6 * i + 3};
+        character = split(cell, fg, bg);
+      }
+      else
+      {
+        for(std::size_t channel = 0; channel != 3; ++channel)
+        {
+          fg[channel] = top[3 * i + channel];
+          bg[channel] = bottom[3 * i + channel];
+        }
+        if(distance(fg, bg) == 0) { character = U' '; }
+      }
+      window.set_char(column + i, row + j, character);
+      if(character != U' ') { window.set_fg(column + i, row + j, Term::Color(fg[0], fg[1], fg[2])); }
+      window.set_bg(column + i, row + j, Term::Color(bg[0], bg[1], bg[2]));
+    }
+  }
+}
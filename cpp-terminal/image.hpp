@@ -0,0 +1,62 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Term
+{
+
+class Window;
+
+///
+/// @brief How the pixels of an image are drawn with block characters, each cell showing its foreground and background colors.
+///
+enum class Blitter : std::uint8_t
+{
+  HalfBlock,  ///< 1x2 pixels per cell: '▀' with the top pixel as foreground and the bottom one as background.
+  Quadrant    ///< 2x2 pixels per cell: the quadrant glyph ('▘', '▚', '▙'...) that best splits the 4 pixels in two colors.
+};
+
+///
+/// @brief Read-only view of an RGB or RGBA image, 8 bits per channel. The pixels are not copied.
+///
+class Image
+{
+public:
+  ///
+  /// @param channels 3 (RGB) or 4 (RGBA, composited over black).
+  /// @param stride Bytes between the start of two rows, \b width * \b channels if 0.
+  ///
+  Image(const std::uint8_t* pixels, const std::size_t& width, const std::size_t& height, const std::size_t& channels = 3, const std::size_t& stride = 0);
+  const std::uint8_t* row(const std::size_t& row) const;
+  std::size_t         width() const;
+  std::size_t         height() const;
+  std::size_t         channels() const;
+  std::size_t         stride() const;
+
+private:
+  const std::uint8_t* m_pixels{nullptr};
+  std::size_t         m_width{0};
+  std::size_t         m_height{0};
+  std::size_t         m_channels{3};
+  std::size_t         m_stride{0};
+};
+
+///
+/// @brief Draw \b image in the \b columns x \b rows cells of \b window starting at (\b column , \b row ).
+///
+/// The image is scaled to the pixels of the cells (2 per cell with \b Blitter::HalfBlock , 4 with \b Blitter::Quadrant ), each pixel being the average of the pixels of the image it covers.
+/// The rows of pixels are computed by \b threads threads, the window is then updated by the calling thread.
+///
+void draw_image(Term::Window& window, const std::size_t& column, const std::size_t& row, const std::size_t& columns, const std::size_t& rows, const Image& image, const Blitter& blitter = Blitter::HalfBlock, const std::size_t& threads = 1);
+
+}  // namespace Term
@@ -11,9 +11,18 @@
 
 #include "cpp-terminal/event.hpp"
 
+#include <chrono>
+
 namespace Term
 {
 
 Term::Event read_event();
 
+///
+/// @brief Wait at most \b timeout for an event.
+///
+/// @return The event, or an empty event if none came in time : a program can update what it shows and wait again, feeding the events to a \b MultilinePrompt for example.
+///
+Term::Event read_event(const std::chrono::milliseconds& timeout);
+
 }  // namespace Term
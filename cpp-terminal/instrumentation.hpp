@@ -0,0 +1,95 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include "cpp-terminal/event.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Term
+{
+
+///
+///@brief Log-linear latency histogram (HDR style): every power of two is split in \b sub_buckets linear buckets so the relative error stays below 1/\b sub_buckets .
+///
+class LatencyHistogram
+{
+public:
+  static const constexpr std::size_t sub_buckets{8};
+  static const constexpr std::size_t magnitudes{40};  ///< Up to 2^42 ns (~73 minutes), larger values go to the last bucket.
+  static const constexpr std::size_t buckets{sub_buckets * magnitudes};
+  ///
+  ///@brief The bucket \b nanoseconds falls in.
+  ///
+  static std::size_t                       bucket(const std::uint64_t& nanoseconds);
+  ///
+  ///@brief The smallest value stored in \b bucket .
+  ///
+  static std::uint64_t                     lower_bound(const std::size_t& bucket);
+  void                                     record(const std::uint64_t& nanoseconds, const std::uint64_t& count = 1);
+  void                                     merge(const LatencyHistogram& histogram);
+  std::uint64_t                            count() const;
+  std::uint64_t                            min() const;
+  std::uint64_t                            max() const;
+  double                                   mean() const;
+  ///
+  ///@brief Value (in ns) below which \b percentile percent of the recorded values fall, 0 if the histogram is empty.
+  ///
+  std::uint64_t                            percentile(const double& percentile) const;
+  const std::array<std::uint64_t, buckets>& counts() const;
+
+private:
+  std::array<std::uint64_t, buckets> m_counts{{}};
+  std::uint64_t                      m_count{0};
+  std::uint64_t                      m_sum{0};
+  std::uint64_t                      m_min{0};
+  std::uint64_t                      m_max{0};
+};
+
+///
+///@brief Opt-in counters on the terminal output and on the input thread. Build with \b CPPTERMINAL_ENABLE_INSTRUMENTATION to enable them, otherwise the recording compiles away and the snapshot stays empty.
+///
+namespace Instrumentation
+{
+
+class Snapshot
+{
+public:
+  bool                         enabled{false};
+  std::uint64_t                bytes_written{0};     ///< Bytes accepted by \b write() .
+  std::uint64_t                write_calls{0};       ///< Number of \b write() system calls.
+  std::uint64_t                short_writes{0};      ///< \b write() calls that accepted only part of the buffer.
+  std::uint64_t                eagain_stalls{0};     ///< Times the output was full (\b EAGAIN ) and we had to wait for it.
+  std::array<std::uint64_t, 7> events{{}};           ///< Events queued by the input thread, indexed by \b Term::Event::Type .
+  std::uint64_t                queue_high_water{0};  ///< Largest number of events waiting in the queue.
+  LatencyHistogram             write_latency;        ///< Duration of the \b write() system calls in nanoseconds.
+  std::uint64_t                events_of(const Term::Event::Type& type) const;
+};
+
+///
+///@brief \b true if cpp-terminal was built with \b CPPTERMINAL_ENABLE_INSTRUMENTATION .
+///
+bool     enabled() noexcept;
+
+///
+///@brief Copy the current counters.
+///
+Snapshot snapshot();
+
+///
+///@brief Set all the counters back to zero.
+///
+void     reset();
+
+}  // namespace Instrumentation
+
+}  // namespace Term
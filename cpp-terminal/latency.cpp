@@ -0,0 +1,56 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/latency.hpp"
+
+#include "cpp-terminal/iostream.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+void Term::FrameLatency::input(const Term::Event& event)
+{
+  if(!event.empty()) { m_pending.push_back(event.timestamp()); }
+}
+
+void Term::FrameLatency::present(const std::string& frame)
+{
+  Term::cout << frame << std::flush;
+  flushed();
+}
+
+void Term::FrameLatency::flushed()
+{
+  const std::chrono::steady_clock::time_point now{std::chrono::steady_clock::now()};
+  for(std::size_t i = 0; i != m_pending.size(); ++i)
+  {
+    const long long nanoseconds{static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_pending[i]).count())};
+    m_histogram.record(nanoseconds > 0 ? static_cast<std::uint64_t>(nanoseconds) : 0);
+  }
+  m_pending.clear();
+  ++m_frames;
+}
+
+std::size_t Term::FrameLatency::frames() const { return m_frames; }
+
+const Term::LatencyHistogram& Term::FrameLatency::histogram() const { return m_histogram; }
+
+std::string Term::FrameLatency::report() const
+{
+  std::ostringstream ret;
+  ret << std::fixed << std::setprecision(1) << "frames: " << m_frames << ", inputs: " << m_histogram.count() << ", input-to-frame p50: " << static_cast<double>(m_histogram.percentile(50)) / 1000.0 << "us, p99: " << static_cast<double>(m_histogram.percentile(99)) / 1000.0 << "us, max: " << static_cast<double>(m_histogram.max()) / 1000.0 << "us";
+  return ret.str();
+}
+
+void Term::FrameLatency::reset()
+{
+  m_pending.clear();
+  m_histogram = LatencyHistogram();
+  m_frames    = 0;
+}
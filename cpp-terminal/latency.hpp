@@ -0,0 +1,70 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include "cpp-terminal/event.hpp"
+#include "cpp-terminal/instrumentation.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Term
+{
+
+///
+/// @brief Input-to-frame latency: the time between the arrival of an event (\b Term::Event::timestamp() ) and the moment the frame showing its effect has been written to the terminal.
+///
+/// @code
+/// Term::FrameLatency latency;
+/// while(on)
+/// {
+///   Term::Event event{Term::read_event()};
+///   latency.input(event);
+///   ...
+///   latency.present(window.render(1, 1, true));
+/// }
+/// Term::cerr << latency.report() << std::endl;
+/// @endcode
+///
+class FrameLatency
+{
+public:
+  ///
+  /// @brief The effect of \b event will be visible in the next frame.
+  ///
+  void                    input(const Term::Event& event);
+  ///
+  /// @brief Write \b frame to the terminal, flush it and call \b flushed() .
+  ///
+  void                    present(const std::string& frame);
+  ///
+  /// @brief A frame has just been flushed to the terminal: record the latency of every pending input.
+  ///
+  void                    flushed();
+  std::size_t             frames() const;
+  ///
+  /// @brief Latencies in nanoseconds.
+  ///
+  const LatencyHistogram& histogram() const;
+  ///
+  /// @brief One line summary: number of frames and inputs, p50/p99/max latency in microseconds.
+  ///
+  std::string             report() const;
+  void                    reset();
+
+private:
+  std::vector<std::chrono::steady_clock::time_point> m_pending;
+  LatencyHistogram                                   m_histogram;
+  std::size_t                                        m_frames{0};
+};
+
+}  // namespace Term
@@ -0,0 +1,133 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/model.hpp"
+
+#include "cpp-terminal/exception.hpp"
+
+#include <algorithm>
+
+namespace
+{
+
+bool continuation(const char& byte) { return (static_cast<unsigned char>(byte) & 0xC0U) == 0x80U; }
+
+}  // namespace
+
+Term::Model::Model(const std::string& text) { assign(text); }
+
+const Term::GapBuffer& Term::Model::text() const { return m_text; }
+
+std::size_t Term::Model::lines() const { return m_text.lines(); }
+
+std::string Term::Model::line(const std::size_t& row) const { return m_text.substr(m_text.line_begin(row - 1), m_text.line_end(row - 1) - m_text.line_begin(row - 1)); }
+
+std::string Term::Model::str() const { return m_text.str() + '\n'; }
+
+void Term::Model::assign(const std::string& text)
+{
+  if(!text.empty() && text.back() == '\n') { m_text.assign(text.substr(0, text.size() - 1)); }
+  else { m_text.assign(text); }
+  m_cursor = m_text.size();
+}
+
+std::size_t Term::Model::cursor_row() const { return m_text.line_of(m_cursor) + 1; }
+
+std::size_t Term::Model::cursor_col() const
+{
+  std::size_t col{1};
+  for(std::size_t position = m_text.line_begin(cursor_row() - 1); position != m_cursor; position = next(position)) { ++col; }
+  return col;
+}
+
+std::size_t Term::Model::cursor() const { return m_cursor; }
+
+void Term::Model::set_cursor(const std::size_t& row, const std::size_t& col)
+{
+  const std::size_t line{std::min(row == 0 ? 0 : row - 1, lines() - 1)};
+  const std::size_t end{m_text.line_end(line)};
+  m_cursor = m_text.line_begin(line);
+  for(std::size_t i = 1; i < col && m_cursor != end; ++i) { m_cursor = next(m_cursor); }
+}
+
+void Term::Model::insert(const std::string& text)
+{
+  m_text.insert(m_cursor, text);
+  m_cursor += text.size();
+}
+
+void Term::Model::insert(const char& character) { m_text.insert(m_cursor++, character); }
+
+void Term::Model::replace_before(const std::size_t& position, const std::string& text)
+{
+  if(position > m_cursor) { throw Term::Exception("Model::replace_before: position after the cursor"); }
+  m_text.erase(position, m_cursor - position);
+  m_cursor = position;
+  insert(text);
+}
+
+void Term::Model::new_line() { insert('\n'); }
+
+void Term::Model::erase_before()
+{
+  if(m_cursor == 0) { return; }
+  const std::size_t begin{previous(m_cursor)};
+  m_text.erase(begin, m_cursor - begin);
+  m_cursor = begin;
+}
+
+void Term::Model::erase_after()
+{
+  if(m_cursor != m_text.size()) { m_text.erase(m_cursor, next(m_cursor) - m_cursor); }
+}
+
+// Left and right stay on the line, like the prompt always did
+void Term::Model::move_left()
+{
+  if(m_cursor != m_text.line_begin(cursor_row() - 1)) { m_cursor = previous(m_cursor); }
+}
+
+void Term::Model::move_right()
+{
+  if(m_cursor != m_text.line_end(cursor_row() - 1)) { m_cursor = next(m_cursor); }
+}
+
+void Term::Model::move_home() { m_cursor = m_text.line_begin(cursor_row() - 1); }
+
+void Term::Model::move_end() { m_cursor = m_text.line_end(cursor_row() - 1); }
+
+bool Term::Model::move_up()
+{
+  const std::size_t row{cursor_row()};
+  if(row == 1) { return false; }
+  set_cursor(row - 1, cursor_col());
+  return true;
+}
+
+bool Term::Model::move_down()
+{
+  const std::size_t row{cursor_row()};
+  if(row == lines()) { return false; }
+  set_cursor(row + 1, cursor_col());
+  return true;
+}
+
+std::size_t Term::Model::next(const std::size_t& position) const
+{
+  std::size_t ret{position + 1};
+  while(ret < m_text.size() && continuation(m_text[ret])) { ++ret; }
+  return ret;
+}
+
+std::size_t Term::Model::previous(const std::size_t& position) const
+{
+  std::size_t ret{position - 1};
+  while(ret > 0 && continuation(m_text[ret])) { --ret; }
+  return ret;
+}
@@ -0,0 +1,93 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include "cpp-terminal/gap_buffer.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace Term
+{
+
+///
+/// @brief The state of a text editor (the prompt of \b prompt_multiline for example) in an abstract way, irrespective of where or how it is rendered: the text and the cursor.
+///
+/// The text is kept in a \b GapBuffer and edited at the cursor, so typing or pasting costs the size of what is inserted, whatever the size of the text.
+/// Rows and columns start at 1, columns count code points. The cursor never splits a UTF-8 sequence.
+///
+class Model
+{
+public:
+  Model() = default;
+  explicit Model(const std::string& text);
+
+  std::string prompt_string;  ///< The string to show as the prompt.
+
+  const Term::GapBuffer& text() const;
+  std::size_t            lines() const;
+  std::string            line(const std::size_t& row) const;
+
+  ///
+  /// @brief The text, each line followed by '\\n' (like \b concat ).
+  ///
+  std::string str() const;
+
+  ///
+  /// @brief Replace the text (a final '\\n' is dropped, like \b split does) and put the cursor at its end.
+  ///
+  void assign(const std::string& text);
+
+  std::size_t cursor_row() const;
+  std::size_t cursor_col() const;
+  ///
+  /// @brief Position of the cursor in the text, in bytes.
+  ///
+  std::size_t cursor() const;
+
+  ///
+  /// @brief Move the cursor, clamped to the text.
+  ///
+  void set_cursor(const std::size_t& row, const std::size_t& col);
+
+  ///
+  /// @brief Insert \b text at the cursor and move the cursor after it. \b text may contain '\\n'.
+  ///
+  void insert(const std::string& text);
+  void insert(const char& character);
+  ///
+  /// @brief Replace the text from \b position to the cursor by \b text (a completion of the word before the cursor for example) and move the cursor after it.
+  ///
+  void replace_before(const std::size_t& position, const std::string& text);
+  void new_line();
+  void erase_before();
+  void erase_after();
+
+  void move_left();
+  void move_right();
+  void move_home();
+  void move_end();
+  ///
+  /// @brief Move the cursor to the same column of the previous line, returns \b false on the first line.
+  ///
+  bool move_up();
+  ///
+  /// @brief Move the cursor to the same column of the next line, returns \b false on the last line.
+  ///
+  bool move_down();
+
+private:
+  std::size_t     next(const std::size_t& position) const;
+  std::size_t     previous(const std::size_t& position) const;
+  Term::GapBuffer m_text;
+  std::size_t     m_cursor{0};  ///< Position of the cursor in the text, in bytes.
+};
+
+}  // namespace Term
@@ -0,0 +1,282 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/pager.hpp"
+
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/private/grapheme.hpp"
+#include "cpp-terminal/private/line_index.hpp"
+#include "cpp-terminal/private/spooler.hpp"
+#include "cpp-terminal/window.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+
+const std::size_t npos{std::string::npos};
+// Lines are short: searches for a newline read a small block first, then larger ones
+const std::size_t first_block_size{4 * 1024};
+const std::size_t block_size{64 * 1024};
+
+}  // namespace
+
+Term::Pager::Pager(const std::string& path) : m_path(path), m_file(path, std::ios::binary)
+{
+  if(!m_file) { throw Term::Exception("Pager: cannot open " + path); }
+  m_index.reset(new Term::Private::LineIndex(path));
+  m_size = Term::Private::LineIndex::file_size(path);
+}
+
+Term::Pager::Pager(const int& fd, const std::string& spool) : m_path(spool), m_spooled(true), m_follow(true)
+{
+  if(!std::ofstream(spool, std::ios::binary | std::ios::trunc)) { throw Term::Exception("Pager: cannot create " + spool); }
+  m_file.open(spool, std::ios::binary);
+  m_index.reset(new Term::Private::LineIndex(spool));
+  m_spooler.reset(new Term::Private::Spooler(fd, spool));
+}
+
+Term::Pager::~Pager()
+{
+  m_spooler.reset();
+  m_index.reset();
+  m_file.close();
+  if(m_spooled) { std::remove(m_path.c_str()); }
+}
+
+void Term::Pager::update()
+{
+  m_index->update();
+  m_size = Term::Private::LineIndex::file_size(m_path);
+  if(m_follow) { set_top(last_top(), npos); }
+  resolve();
+}
+
+void Term::Pager::scroll(const long& rows)
+{
+  m_target = npos;
+  if(rows < 0)
+  {
+    m_follow = false;
+    for(long row = 0; row != rows && m_top != 0; --row)
+    {
+      m_top = line_start(m_top - 1);
+      if(m_top_line != npos) { --m_top_line; }
+    }
+    return;
+  }
+  const std::size_t last{last_top()};
+  for(long row = 0; row != rows && m_top < last; ++row)
+  {
+    const std::size_t next{next_line(m_top)};
+    if(next == npos) { break; }
+    m_top = next;
+    if(m_top_line != npos) { ++m_top_line; }
+  }
+}
+
+void Term::Pager::scroll_columns(const long& columns)
+{
+  if(columns < 0) { m_left -= std::min(m_left, static_cast<std::size_t>(-columns)); }
+  else { m_left += static_cast<std::size_t>(columns); }
+}
+
+void Term::Pager::jump_to_line(const std::size_t& line)
+{
+  m_follow = false;
+  m_target = line;
+  resolve();
+}
+
+void Term::Pager::jump_to_percent(const double& percent)
+{
+  m_follow = false;
+  m_target = npos;
+  const double      fraction{std::min(std::max(percent, 0.0), 100.0) / 100.0};
+  const std::size_t offset{static_cast<std::size_t>(fraction * static_cast<double>(m_size))};
+  set_top(std::min(line_start(offset), last_top()), npos);
+  resolve();
+}
+
+void Term::Pager::jump_to_end()
+{
+  m_target = npos;
+  set_top(last_top(), npos);
+  resolve();
+}
+
+void Term::Pager::set_follow(const bool& follow)
+{
+  m_follow = follow;
+  if(follow) { jump_to_end(); }
+}
+
+bool Term::Pager::follow() const { return m_follow; }
+
+std::size_t Term::Pager::size() const { return m_size; }
+
+std::size_t Term::Pager::top_offset() const { return m_top; }
+
+std::size_t Term::Pager::top_line() const { return m_top_line; }
+
+std::size_t Term::Pager::lines() const
+{
+  const std::size_t newlines{m_index->newlines()};
+  // The last line has no '\n' to count
+  if(m_size != 0 && !m_index->busy() && m_index->indexed() >= m_size && read(m_size - 1, 1) != "\n") { return newlines + 1; }
+  return newlines;
+}
+
+bool Term::Pager::indexing() const { return m_index->busy(); }
+
+double Term::Pager::percent() const { return m_size == 0 ? 100.0 : 100.0 * static_cast<double>(m_bottom) / static_cast<double>(m_size); }
+
+void Term::Pager::render(Term::Window& window, const std::size_t& column, const std::size_t& row, const std::size_t& width, const std::size_t& height)
+{
+  if(height != m_height)
+  {
+    m_height = std::max<std::size_t>(height, 1);
+    if(m_follow) { set_top(last_top(), npos); }
+  }
+  std::size_t offset{m_top < m_size ? m_top : npos};
+  m_bottom = m_top;
+  // Enough bytes for the columns shown, the rest of a long line is skipped. The rows are cut from blocks read at once.
+  const std::size_t needed{(m_left + width) * 4 + 256};
+  std::string       bytes;
+  std::size_t       base{0};
+  for(std::size_t y = row; y != row + height; ++y)
+  {
+    if(offset == npos)
+    {
+      window.print_str(column, y, "~");
+      continue;
+    }
+    std::size_t newline{bytes.find('\n', offset - base)};
+    if(offset + needed > base + bytes.size() && (newline == npos || newline - (offset - base) > needed) && base + bytes.size() < m_size)
+    {
+      base    = offset;
+      bytes   = read(offset, std::min(m_size - offset, std::max(needed, block_size)));
+      newline = bytes.find('\n');
+    }
+    const std::size_t begin{offset - base};
+    const std::size_t end{std::min(std::min(newline, bytes.size()), begin + needed)};
+    std::string       line{bytes.substr(begin, end - begin)};
+    if(!line.empty() && line.back() == '\r') { line.pop_back(); }
+    window.print_str(column, y, Term::Private::visible_columns(line, m_left, width));
+    if(newline != npos) { offset = base + newline + 1 < m_size ? base + newline + 1 : npos; }
+    else { offset = base + bytes.size() < m_size ? next_line(base + bytes.size()) : npos; }
+    m_bottom = offset == npos ? m_size : offset;
+  }
+}
+
+std::string Term::Pager::read(const std::size_t& offset, const std::size_t& count) const
+{
+  std::string ret(count, '\0');
+  m_file.clear();
+  m_file.seekg(static_cast<std::streamoff>(offset));
+  m_file.read(&ret[0], static_cast<std::streamsize>(count));
+  ret.resize(static_cast<std::size_t>(m_file.gcount()));
+  return ret;
+}
+
+std::size_t Term::Pager::find_newline(const std::size_t& begin) const
+{
+  for(std::size_t position = begin, size = first_block_size; position < m_size; position += size, size = block_size)
+  {
+    const std::string bytes{read(position, std::min(size, m_size - position))};
+    const std::size_t found{bytes.find('\n')};
+    if(found != npos) { return position + found; }
+    if(bytes.empty()) { break; }
+  }
+  return npos;
+}
+
+std::size_t Term::Pager::rfind_newline(const std::size_t& end) const
+{
+  for(std::size_t position = end, size = first_block_size; position != 0; size = block_size)
+  {
+    const std::size_t start{position > size ? position - size : 0};
+    const std::size_t found{read(start, position - start).rfind('\n')};
+    if(found != npos) { return start + found; }
+    position = start;
+  }
+  return npos;
+}
+
+std::size_t Term::Pager::next_line(const std::size_t& offset) const
+{
+  const std::size_t found{find_newline(offset)};
+  return found == npos || found + 1 >= m_size ? npos : found + 1;
+}
+
+std::size_t Term::Pager::line_start(const std::size_t& offset) const
+{
+  const std::size_t found{rfind_newline(offset)};
+  return found == npos ? 0 : found + 1;
+}
+
+// The top of the last page: the last line, not counting the empty one after a final '\n', at the bottom
+std::size_t Term::Pager::last_top() const
+{
+  if(m_size == 0) { return 0; }
+  // Only changes with the file and the height
+  if(m_size == m_last_top_size && m_height == m_last_top_height) { return m_last_top; }
+  std::size_t top{line_start(read(m_size - 1, 1) == "\n" ? m_size - 1 : m_size)};
+  for(std::size_t row = 1; row < m_height && top != 0; ++row) { top = line_start(top - 1); }
+  m_last_top        = top;
+  m_last_top_size   = m_size;
+  m_last_top_height = m_height;
+  return top;
+}
+
+void Term::Pager::set_top(const std::size_t& offset, const std::size_t& line)
+{
+  if(offset == m_top && line == npos) { return; }
+  m_top      = offset;
+  m_top_line = line;
+}
+
+// Go to the line jumped to, count the lines before the top, once the index got there
+void Term::Pager::resolve()
+{
+  const bool complete{!m_index->busy() && m_index->indexed() >= m_size};
+  if(m_target != npos && (complete || m_index->newlines() >= m_target))
+  {
+    const Term::Private::LineIndex::Checkpoint checkpoint{m_index->before_line(m_target)};
+    const std::size_t                          last{last_top()};
+    std::size_t                                offset{checkpoint.offset};
+    std::size_t                                line{checkpoint.line};
+    // The lines after the checkpoint, a block at a time
+    for(std::size_t position = offset; line < m_target && offset < last && position < m_size; position += block_size)
+    {
+      const std::string bytes{read(position, std::min(block_size, m_size - position))};
+      for(std::size_t found = bytes.find('\n'); found != npos && line < m_target && offset < last && position + found + 1 < m_size; found = bytes.find('\n', found + 1))
+      {
+        offset = position + found + 1;
+        ++line;
+      }
+      if(bytes.empty()) { break; }
+    }
+    m_top      = offset;
+    m_top_line = line;
+    m_target   = npos;
+  }
+  if(m_top_line == npos && m_index->indexed() >= m_top)
+  {
+    const Term::Private::LineIndex::Checkpoint checkpoint{m_index->before_offset(m_top)};
+    std::size_t                                line{checkpoint.line};
+    for(std::size_t position = checkpoint.offset; position < m_top; position += block_size)
+    {
+      const std::string bytes{read(position, std::min(block_size, m_top - position))};
+      line += static_cast<std::size_t>(std::count(bytes.begin(), bytes.end(), '\n'));
+    }
+    m_top_line = line;
+  }
+}
@@ -0,0 +1,149 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace Term
+{
+
+class Window;
+
+namespace Private
+{
+class LineIndex;
+class Spooler;
+}
+
+///
+/// @brief A viewer of a file, of any size, in the manner of \b less : only the rows shown are read, the file stays on disk.
+///
+/// The view is the byte offset of the line at its top. Scrolling reads the lines scrolled over, jumping to a percentage reads nothing but the line it lands in.
+/// The lines are indexed in the background (in chunks, on every core), one line in a thousand or so : jumping to a line reads at most that many lines, and the number of the top line is known once the index got there.
+/// Memory stays proportional to the screen and the index to the file over a thousand. In follow mode the view stays at the end of a file which grows, \b update picking up what was appended.
+///
+class Pager
+{
+public:
+  ///
+  /// @brief Page the file at \b path .
+  ///
+  explicit Pager(const std::string& path);
+
+  ///
+  /// @brief Page what is read from the descriptor \b fd (a pipe, a socket...), copied to the file \b spool as it arrives (removed by the destructor). Follow mode is on.
+  ///
+  /// \b fd is not closed. The copy waits for it with a timeout : the destructor returns promptly even if the writer keeps it open.
+  ///
+  Pager(const int& fd, const std::string& spool);
+  ~Pager();
+  Pager(const Pager&)            = delete;
+  Pager(Pager&&)                 = delete;
+  Pager& operator=(const Pager&) = delete;
+  Pager& operator=(Pager&&)      = delete;
+
+  ///
+  /// @brief Pick up what the index and the file got since : index the bytes appended, keep the view at the end in follow mode, go to the line jumped to if it is known now.
+  ///
+  /// To be called regularly, when waiting for events times out for example.
+  ///
+  void update();
+
+  ///
+  /// @brief Scroll down \b rows (up if negative), no further than the last page. Scrolling up leaves follow mode.
+  ///
+  void scroll(const long& rows);
+
+  ///
+  /// @brief Scroll right \b columns (left if negative), long lines are cut rather than wrapped.
+  ///
+  void scroll_columns(const long& columns);
+
+  ///
+  /// @brief Show \b line (from 0) at the top, or as close as the last page allows. Done by \b update if the index did not get there yet.
+  ///
+  void jump_to_line(const std::size_t& line);
+
+  ///
+  /// @brief Show the line at \b percent of the bytes at the top, without waiting for the index.
+  ///
+  void jump_to_percent(const double& percent);
+
+  void jump_to_end();
+
+  void set_follow(const bool& follow);
+  bool follow() const;
+
+  ///
+  /// @brief The bytes of the file, as of the last \b update .
+  ///
+  std::size_t size() const;
+
+  ///
+  /// @brief The byte offset of the top line.
+  ///
+  std::size_t top_offset() const;
+
+  ///
+  /// @brief The number, from 0, of the top line. \b std::string::npos until the index gets to it.
+  ///
+  std::size_t top_line() const;
+
+  ///
+  /// @brief The lines indexed so far.
+  ///
+  std::size_t lines() const;
+
+  ///
+  /// @brief Whether the index is being built.
+  ///
+  bool indexing() const;
+
+  ///
+  /// @brief How far in the file the bottom of the view is, 100 at the end.
+  ///
+  double percent() const;
+
+  ///
+  /// @brief Draw the view in the \b width x \b height cells of \b window from \b column , \b row (from 1). The rows after the end of the file are shown as '~'.
+  ///
+  void render(Term::Window& window, const std::size_t& column, const std::size_t& row, const std::size_t& width, const std::size_t& height);
+
+private:
+  std::string                         read(const std::size_t& offset, const std::size_t& count) const;
+  std::size_t                         find_newline(const std::size_t& begin) const;
+  std::size_t                         rfind_newline(const std::size_t& end) const;
+  std::size_t                         next_line(const std::size_t& offset) const;
+  std::size_t                         line_start(const std::size_t& offset) const;
+  std::size_t                         last_top() const;
+  void                                set_top(const std::size_t& offset, const std::size_t& line);
+  void                                resolve();
+  std::string                         m_path;
+  bool                                m_spooled{false};
+  std::unique_ptr<Private::Spooler>   m_spooler;
+  mutable std::ifstream               m_file;
+  std::unique_ptr<Private::LineIndex> m_index;
+  std::size_t                         m_size{0};
+  std::size_t                         m_top{0};
+  std::size_t                         m_top_line{0};
+  std::size_t                         m_target{static_cast<std::size_t>(-1)};  ///< The line jumped to, until it is indexed.
+  std::size_t                         m_left{0};
+  std::size_t                         m_height{1};
+  std::size_t                         m_bottom{0};                             ///< The offset after the last row rendered.
+  bool                                m_follow{false};
+  mutable std::size_t                 m_last_top{0};                           ///< \b last_top for \b m_last_top_size and \b m_last_top_height .
+  mutable std::size_t                 m_last_top_size{0};
+  mutable std::size_t                 m_last_top_height{0};
+};
+
+}  // namespace Term
@@ -9,11 +9,13 @@
 
 #include "cpp-terminal/private/blocking_queue.hpp"
 
+#include "cpp-terminal/private/instrumentation.hpp"
+
 Term::Event Term::Private::BlockingQueue::pop()
 {
   const std::lock_guard<std::mutex> lock(m_mutex);
-  Term::Event                       value = this->m_queue.front();
-  m_queue.pop();
+  Term::Event                       value = this->m_queue.front().event;
+  m_queue.pop_front();
   return value;
 }
 
@@ -22,7 +24,8 @@ void Term::Private::BlockingQueue::push(const Term::Event& value, const std::siz
   for(std::size_t i = 0; i != occurrence; ++i)
   {
     const std::lock_guard<std::mutex> lock(m_mutex);
-    m_queue.push(value);
+    m_queue.push_back({value, nullptr});
+    Term::Private::Instrumentation::event(value.type(), m_queue.size());
     m_cv.notify_all();
   }
 }
@@ -32,11 +35,32 @@ void Term::Private::BlockingQueue::push(const Term::Event&& value, const std::si
   for(std::size_t i = 0; i != occurrence; ++i)
   {
     const std::lock_guard<std::mutex> lock(m_mutex);
-    m_queue.push(value);
+    m_queue.push_back({value, nullptr});
+    Term::Private::Instrumentation::event(value.type(), m_queue.size());
     m_cv.notify_all();
   }
 }
 
+void Term::Private::BlockingQueue::push_wakeup(const void* owner)
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  m_queue.push_back({Term::Event(), owner});
+  Term::Private::Instrumentation::event(Term::Event::Type::Empty, m_queue.size());
+  m_cv.notify_all();
+}
+
+void Term::Private::BlockingQueue::discard(const void* owner)
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  // Copied rather than erased in place: the move assignment of Term::Event keeps the type of the event assigned to
+  std::deque<Entry>                 kept;
+  for(const Entry& entry: m_queue)
+  {
+    if(entry.owner != owner) { kept.push_back(entry); }
+  }
+  m_queue.swap(kept);
+}
+
 bool Term::Private::BlockingQueue::empty()
 {
   const std::lock_guard<std::mutex> lock(m_mutex);
@@ -49,4 +73,14 @@ std::size_t Term::Private::BlockingQueue::size()
   return m_queue.size();
 }
 
-void Term::Private::BlockingQueue::wait_for_events(std::unique_lock<std::mutex>& lock) { m_cv.wait(lock); }
+void Term::Private::BlockingQueue::wait_for_events()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_cv.wait(lock, [this]() { return !m_queue.empty(); });
+}
+
+bool Term::Private::BlockingQueue::wait_for_events(const std::chrono::milliseconds& timeout)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  return m_cv.wait_for(lock, timeout, [this]() { return !m_queue.empty(); });
+}
@@ -11,9 +11,10 @@
 
 #include "cpp-terminal/event.hpp"
 
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <mutex>
-#include <queue>
 
 namespace Term
 {
@@ -33,13 +34,33 @@ public:
   Term::Event    pop();
   void           push(const Term::Event& value, const std::size_t& occurrence = 1);
   void           push(const Term::Event&& value, const std::size_t& occurrence = 1);
+  ///
+  /// @brief Push an empty event on behalf of \b owner , to wake the reader waiting for events.
+  ///
+  void           push_wakeup(const void* owner);
+  ///
+  /// @brief Remove the wakeups of \b owner not popped yet, once it no longer expects them.
+  ///
+  void           discard(const void* owner);
   bool           empty();
   std::size_t    size();
-  void           wait_for_events(std::unique_lock<std::mutex>& lock);
+  ///
+  /// @brief Wait until the queue is not empty. The queue is checked under its own lock, so a push cannot slip between the check and the wait.
+  ///
+  void           wait_for_events();
+  ///
+  /// @brief Wait at most \b timeout until the queue is not empty, returns \b false if it is still empty.
+  ///
+  bool           wait_for_events(const std::chrono::milliseconds& timeout);
 
 private:
+  struct Entry
+  {
+    Term::Event event;
+    const void* owner;  ///< Of a wakeup, nullptr otherwise.
+  };
   std::mutex              m_mutex;
-  std::queue<Term::Event> m_queue;
+  std::deque<Entry>       m_queue;
   std::condition_variable m_cv;
 };
 
@@ -0,0 +1,96 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/private/completion_worker.hpp"
+
+#include <utility>
+
+Term::Private::CompletionWorker::CompletionWorker(const Term::Completer& completer, const std::function<void()>& ready) : m_completer(completer), m_ready(ready), m_thread(&CompletionWorker::run, this) {}
+
+Term::Private::CompletionWorker::~CompletionWorker()
+{
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop      = true;
+    m_cancelled = true;
+  }
+  m_condition.notify_one();
+  m_thread.join();
+}
+
+void Term::Private::CompletionWorker::request(const std::string& input)
+{
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_generation;
+    m_input     = input;
+    m_pending   = true;
+    m_done      = false;
+    m_cancelled = true;  // the running request, the worker lowers it before starting this one
+  }
+  m_condition.notify_one();
+}
+
+void Term::Private::CompletionWorker::cancel()
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  ++m_generation;
+  m_pending   = false;
+  m_done      = false;
+  m_cancelled = true;
+}
+
+bool Term::Private::CompletionWorker::take(Term::Completion& completion)
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  if(!m_done) { return false; }
+  m_done = false;
+  if(m_error)
+  {
+    std::exception_ptr error{nullptr};
+    std::swap(error, m_error);
+    std::rethrow_exception(error);
+  }
+  completion = std::move(m_result);
+  m_result   = Term::Completion();
+  return true;
+}
+
+void Term::Private::CompletionWorker::run()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while(true)
+  {
+    m_condition.wait(lock, [this]() { return m_stop || m_pending; });
+    if(m_stop) { return; }
+    const std::uint64_t generation{m_generation};
+    const std::string   input{std::move(m_input)};
+    m_pending   = false;
+    m_cancelled = false;
+    lock.unlock();
+    Term::Completion   result;
+    std::exception_ptr error{nullptr};
+    try
+    {
+      result = m_completer.complete(input, m_cancelled);
+    }
+    catch(...)
+    {
+      error = std::current_exception();
+    }
+    lock.lock();
+    if(generation != m_generation) { continue; }  // superseded while it ran
+    m_result = std::move(result);
+    m_error  = error;
+    m_done   = true;
+    lock.unlock();
+    m_ready();
+    lock.lock();
+  }
+}
@@ -0,0 +1,75 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include "cpp-terminal/completion.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace Term
+{
+
+namespace Private
+{
+
+///
+/// @brief Runs a \b Completer on its own thread so the prompt keeps reading keys while it works.
+///
+/// Only the last request matters : a new request or \b cancel() supersedes the running one (its \b cancelled flag is raised and its result dropped).
+/// \b ready is called from the worker thread when a result can be taken, to wake the thread waiting for events.
+///
+class CompletionWorker
+{
+public:
+  CompletionWorker(const Term::Completer& completer, const std::function<void()>& ready);
+  ///
+  /// @brief Cancels the running request and waits for the completer to return.
+  ///
+  ~CompletionWorker();
+  CompletionWorker(const CompletionWorker&)            = delete;
+  CompletionWorker(CompletionWorker&&)                 = delete;
+  CompletionWorker& operator=(const CompletionWorker&) = delete;
+  CompletionWorker& operator=(CompletionWorker&&)      = delete;
+
+  void request(const std::string& input);
+  void cancel();
+
+  ///
+  /// @brief Move the result of the last request to \b completion , if it is ready and was not already taken. Rethrows what the completer threw.
+  ///
+  bool take(Term::Completion& completion);
+
+private:
+  void                    run();
+  const Term::Completer&  m_completer;
+  std::function<void()>   m_ready;
+  std::mutex              m_mutex;
+  std::condition_variable m_condition;
+  std::string             m_input;
+  std::uint64_t           m_generation{0};  ///< Incremented by each request and cancel.
+  bool                    m_pending{false};  ///< A request waits for the worker.
+  bool                    m_done{false};     ///< m_result (or m_error) answers the last request.
+  bool                    m_stop{false};
+  Term::Completion        m_result;
+  std::exception_ptr      m_error;
+  std::atomic<bool>       m_cancelled{false};
+  std::thread             m_thread;  ///< Started last, once the rest is constructed.
+};
+
+}  // namespace Private
+
+}  // namespace Term
@@ -16,11 +16,13 @@
   #include <io.h>
   #include <windows.h>
 #else
-  #include <sys/ioctl.h>
+  #include <cerrno>
+  #include <poll.h>
   #include <unistd.h>
 #endif
 
 #include "cpp-terminal/private/exception.hpp"
+#include "cpp-terminal/private/instrumentation.hpp"
 #include "cpp-terminal/private/unicode.hpp"
 
 #include <array>
@@ -33,6 +35,34 @@ namespace
 {
 std::array<char, sizeof(Term::Private::InputFileHandler)>  stdin_buffer;   //NOLINT(fuchsia-statically-constructed-objects)
 std::array<char, sizeof(Term::Private::OutputFileHandler)> stdout_buffer;  //NOLINT(fuchsia-statically-constructed-objects)
+
+#if !defined(_WIN32)
+// The descriptor is non-blocking: finish short writes and wait for the terminal to drain on EAGAIN instead of dropping the rest of the buffer
+std::size_t write_all(const std::int32_t& fd, const char* data, const std::size_t& size)
+{
+  std::size_t written{0};
+  while(written != size)
+  {
+    const std::uint64_t start{Term::Private::Instrumentation::now()};
+    const ::ssize_t     ret{::write(fd, data + written, size - written)};
+    const int           error{errno};
+    Term::Private::Instrumentation::write(size - written, static_cast<long>(ret), start);
+    if(ret > 0) { written += static_cast<std::size_t>(ret); }
+    else if(ret == -1 && (error == EAGAIN || error == EWOULDBLOCK))
+    {
+      Term::Private::Instrumentation::stall();
+      ::pollfd output;
+      output.fd      = fd;
+      output.events  = POLLOUT;
+      output.revents = 0;
+      ::poll(&output, 1, -1);
+    }
+    else if(ret == -1 && error == EINTR) { continue; }
+    else { break; }
+  }
+  return written;
+}
+#endif
 }  // namespace
 
 Term::Private::InputFileHandler&  Term::Private::in  = reinterpret_cast<Term::Private::InputFileHandler&>(stdin_buffer);
@@ -95,12 +125,15 @@ std::size_t Term::Private::OutputFileHandler::write(const std::string& str)
   if(str.empty()) { return 0; }
   //std::lock_guard<std::mutex> lock(m_mut);
 #if defined(_WIN32)
-  DWORD dwCount{0};
-  if(WriteConsole(handle(), &str[0], static_cast<DWORD>(str.size()), &dwCount, nullptr) == 0) return -1;
+  DWORD               dwCount{0};
+  const std::uint64_t start{Term::Private::Instrumentation::now()};
+  const BOOL          success{WriteConsole(handle(), &str[0], static_cast<DWORD>(str.size()), &dwCount, nullptr)};
+  Term::Private::Instrumentation::write(str.size(), success == 0 ? -1 : static_cast<long>(dwCount), start);
+  if(success == 0) return -1;
   else
     return static_cast<int>(dwCount);
 #else
-  return ::write(fd(), &str[0], str.size());
+  return write_all(fd(), &str[0], str.size());
 #endif
 }
 
@@ -108,12 +141,15 @@ std::size_t Term::Private::OutputFileHandler::write(const char& ch)
 {
   //std::lock_guard<std::mutex> lock(m_mut);
 #if defined(_WIN32)
-  DWORD dwCount{0};
-  if(WriteConsole(handle(), &ch, 1, &dwCount, nullptr) == 0) return -1;
+  DWORD               dwCount{0};
+  const std::uint64_t start{Term::Private::Instrumentation::now()};
+  const BOOL          success{WriteConsole(handle(), &ch, 1, &dwCount, nullptr)};
+  Term::Private::Instrumentation::write(1, success == 0 ? -1 : static_cast<long>(dwCount), start);
+  if(success == 0) return -1;
   else
     return static_cast<int>(dwCount);
 #else
-  return ::write(fd(), &ch, 1);
+  return write_all(fd(), &ch, 1);
 #endif
 }
 
@@ -127,18 +163,19 @@ std::string Term::Private::InputFileHandler::read()
   ReadConsole(Private::in.handle(), &ret[0], static_cast<DWORD>(ret.size()), &nread, nullptr);
   return ret.c_str();
 #else
-  std::size_t nread{0};
-  ::ioctl(Private::in.fd(), FIONREAD, &nread);
-  if(nread != 0)
+  // The descriptor is non-blocking: read until it is drained instead of asking FIONREAD first (one syscall per keystroke instead of two)
+  std::array<char, 4096> buffer;
+  std::string            ret;
+  while(true)
   {
-    std::string ret(nread, '\0');
     errno = 0;
-    ::ssize_t nnread{::read(Private::in.fd(), &ret[0], ret.size())};
-    if(nnread == -1 && errno != EAGAIN) { throw Term::Exception("read() failed"); }
-    return ret.c_str();
+    const ::ssize_t nread{::read(Private::in.fd(), &buffer[0], buffer.size())};
+    if(nread == -1 && errno != EAGAIN) { throw Term::Exception("read() failed"); }
+    if(nread <= 0) { break; }
+    ret.append(&buffer[0], static_cast<std::size_t>(nread));
+    if(static_cast<std::size_t>(nread) < buffer.size()) { break; }
   }
-  else
-    return std::string();
+  return ret.c_str();
 #endif
 }
 
@@ -0,0 +1,199 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/private/grapheme.hpp"
+
+#include "cpp-terminal/private/grapheme_table.hpp"
+#include "cpp-terminal/private/unicode.hpp"
+#include "cpp-terminal/private/wcwidth.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+
+// 4 bits per code point
+constexpr std::uint8_t lookup(const std::uint32_t& codepoint) { return (Term::Private::Grapheme::stage2[Term::Private::Grapheme::stage1[codepoint / Term::Private::Grapheme::block_size] * (Term::Private::Grapheme::block_size / 2) + (codepoint % Term::Private::Grapheme::block_size) / 2] >> (4 * (codepoint % 2))) & 0xFU; }
+
+static_assert(lookup(U'a') == static_cast<std::uint8_t>(Term::Private::GraphemeBreak::Other), "ASCII letters are Other");
+static_assert(lookup(U'\r') == static_cast<std::uint8_t>(Term::Private::GraphemeBreak::CR), "CR");
+static_assert(lookup(U'\u0301') == static_cast<std::uint8_t>(Term::Private::GraphemeBreak::Extend), "Combining marks extend");
+static_assert(lookup(U'\u200D') == static_cast<std::uint8_t>(Term::Private::GraphemeBreak::ZWJ), "ZWJ");
+static_assert(lookup(U'\U0001F1EB') == static_cast<std::uint8_t>(Term::Private::GraphemeBreak::RegionalIndicator), "Regional indicators");
+static_assert(lookup(U'\U0001F600') == static_cast<std::uint8_t>(Term::Private::GraphemeBreak::ExtendedPictographic), "Emoji are pictographic");
+static_assert(lookup(U'\uAC00') == static_cast<std::uint8_t>(Term::Private::GraphemeBreak::LV), "Hangul LV syllable");
+
+const constexpr std::size_t tab_stop{8};
+
+// state: previous GraphemeBreak in the low 4 bits and
+const constexpr std::uint32_t emoji{0x10};          // the previous code points are ExtendedPictographic Extend* (ZWJ)
+const constexpr std::uint32_t odd_regional{0x20};  // the previous code point is an unpaired regional indicator
+
+bool is_control(const Term::Private::GraphemeBreak& property) { return property == Term::Private::GraphemeBreak::Control || property == Term::Private::GraphemeBreak::CR || property == Term::Private::GraphemeBreak::LF; }
+
+bool boundary(const Term::Private::GraphemeBreak& previous, const Term::Private::GraphemeBreak& current, const std::uint32_t& state)
+{
+  using Term::Private::GraphemeBreak;
+  if(previous == GraphemeBreak::CR && current == GraphemeBreak::LF) { return false; }                                  // GB3
+  if(is_control(previous) || is_control(current)) { return true; }                                                     // GB4, GB5
+  switch(current)
+  {
+    case GraphemeBreak::Extend:
+    case GraphemeBreak::ZWJ:
+    case GraphemeBreak::SpacingMark: return false;  // GB9, GB9a
+    default: break;
+  }
+  switch(previous)
+  {
+    case GraphemeBreak::Prepend: return false;  // GB9b
+    case GraphemeBreak::L: return !(current == GraphemeBreak::L || current == GraphemeBreak::V || current == GraphemeBreak::LV || current == GraphemeBreak::LVT);  // GB6
+    case GraphemeBreak::LV:
+    case GraphemeBreak::V: return !(current == GraphemeBreak::V || current == GraphemeBreak::T);  // GB7
+    case GraphemeBreak::LVT:
+    case GraphemeBreak::T: return current != GraphemeBreak::T;                                                                 // GB8
+    case GraphemeBreak::ZWJ: return !(current == GraphemeBreak::ExtendedPictographic && (state & emoji) != 0);                  // GB11
+    case GraphemeBreak::RegionalIndicator: return !(current == GraphemeBreak::RegionalIndicator && (state & odd_regional) != 0);  // GB12, GB13
+    default: return true;                                                                                                      // GB999
+  }
+}
+
+}  // namespace
+
+Term::Private::GraphemeBreak Term::Private::grapheme_break(const char32_t& codepoint) noexcept
+{
+  if(codepoint > 0x10FFFF) { return GraphemeBreak::Other; }
+  return static_cast<GraphemeBreak>(lookup(codepoint));
+}
+
+bool Term::Private::is_grapheme_boundary(std::uint32_t& state, const char32_t& codepoint) noexcept
+{
+  const GraphemeBreak previous{static_cast<GraphemeBreak>(state & 0xFU)};
+  const GraphemeBreak current{grapheme_break(codepoint)};
+  const bool          ret{boundary(previous, current, state)};
+  std::uint32_t       next{static_cast<std::uint32_t>(current)};
+  switch(current)
+  {
+    case GraphemeBreak::ExtendedPictographic: next |= emoji; break;
+    case GraphemeBreak::Extend:
+      if(previous != GraphemeBreak::ZWJ) { next |= state & emoji; }
+      break;
+    case GraphemeBreak::ZWJ: next |= state & emoji; break;
+    case GraphemeBreak::RegionalIndicator:
+      if(previous != GraphemeBreak::RegionalIndicator || (state & odd_regional) == 0) { next |= odd_regional; }
+      break;
+    default: break;
+  }
+  state = next;
+  return ret;
+}
+
+std::size_t Term::Private::grapheme_size(const char32_t* codepoints, const std::size_t& size) noexcept
+{
+  if(size < 2) { return size; }
+  // Two ASCII characters are always separate clusters, but CR LF
+  if(codepoints[0] < 0x7F && codepoints[1] < 0x7F && codepoints[0] != U'\r') { return 1; }
+  std::uint32_t state{0};
+  is_grapheme_boundary(state, codepoints[0]);
+  std::size_t ret{1};
+  while(ret != size && !is_grapheme_boundary(state, codepoints[ret])) { ++ret; }
+  return ret;
+}
+
+std::vector<std::u32string> Term::Private::graphemes(const std::u32string& str)
+{
+  std::vector<std::u32string> ret;
+  for(std::size_t i = 0; i != str.size();)
+  {
+    const std::size_t size{grapheme_size(&str[i], str.size() - i)};
+    ret.emplace_back(str, i, size);
+    i += size;
+  }
+  return ret;
+}
+
+int Term::Private::grapheme_width(const char32_t* codepoints, const std::size_t& size) noexcept
+{
+  if(size == 0) { return 0; }
+  int ret{wcwidth(codepoints[0])};
+  if(ret < 0 || size == 1) { return ret; }
+  if(grapheme_break(codepoints[0]) == GraphemeBreak::RegionalIndicator) { return 2; }  // Flag
+  for(std::size_t i = 1; i != size; ++i)
+  {
+    if(codepoints[i] == U'\uFE0F') { return 2; }  // Emoji presentation
+    const int width{wcwidth(codepoints[i])};
+    if(width > ret) { ret = width; }
+  }
+  return ret;
+}
+
+std::string Term::Private::visible_columns(const std::string& text, const std::size_t& left, const std::size_t& width)
+{
+  const std::u32string codepoints{utf8_to_utf32(text)};
+  const std::size_t    end{left + std::min(width, std::numeric_limits<std::size_t>::max() - left)};
+  std::string          ret;
+  std::size_t          column{0};
+  std::size_t          size{0};
+  const auto           cell = [&ret, &column, &left, &end](const char& character)
+  {
+    if(column >= left && column < end) { ret += character; }
+    ++column;
+  };
+  for(std::size_t i = 0; i < codepoints.size() && column < end; i += size)
+  {
+    size = 1;
+    if(codepoints[i] == U'\t')
+    {
+      do {
+        cell(' ');
+      } while(column % tab_stop != 0);
+      continue;
+    }
+    if(codepoints[i] < 0x20 || codepoints[i] == 0x7F)
+    {
+      cell('^');
+      cell(static_cast<char>(codepoints[i] ^ 0x40));
+      continue;
+    }
+    size = grapheme_size(&codepoints[i], codepoints.size() - i);
+    const int cluster_width{grapheme_width(&codepoints[i], size)};
+    if(cluster_width < 1) { continue; }
+    const std::size_t cells{static_cast<std::size_t>(cluster_width)};
+    if(column >= left && column + cells <= end) { append_utf8(ret, &codepoints[i], size); }
+    else
+    {
+      // A wide character cut by an edge
+      for(std::size_t j = column; j != column + cells; ++j)
+      {
+        if(j >= left && j < end) { ret += ' '; }
+      }
+    }
+    column += cells;
+  }
+  return ret;
+}
+
+std::size_t Term::Private::visible_width(const std::string& text)
+{
+  const std::u32string codepoints{utf8_to_utf32(text)};
+  std::size_t          ret{0};
+  std::size_t          size{0};
+  for(std::size_t i = 0; i < codepoints.size(); i += size)
+  {
+    size = 1;
+    if(codepoints[i] == U'\t') { ret += tab_stop - ret % tab_stop; }
+    else if(codepoints[i] < 0x20 || codepoints[i] == 0x7F) { ret += 2; }
+    else
+    {
+      size = grapheme_size(&codepoints[i], codepoints.size() - i);
+      ret += static_cast<std::size_t>(std::max(grapheme_width(&codepoints[i], size), 0));
+    }
+  }
+  return ret;
+}
@@ -0,0 +1,100 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///
+///@file grapheme.hpp
+///@brief Extended grapheme clusters (Unicode Standard Annex #29): what a user sees as one character.
+///@warning Internal use only.
+///
+
+namespace Term
+{
+namespace Private
+{
+
+///
+///@brief Grapheme_Cluster_Break property of the code points (same order as the table generated by grapheme.py).
+///@warning Internal use only.
+///
+enum class GraphemeBreak : std::uint8_t
+{
+  Control,
+  Other,
+  CR,
+  LF,
+  Extend,
+  ZWJ,
+  RegionalIndicator,
+  Prepend,
+  SpacingMark,
+  L,
+  V,
+  T,
+  LV,
+  LVT,
+  ExtendedPictographic
+};
+
+///
+///@brief Grapheme_Cluster_Break property of \b codepoint .
+///@note The table (grapheme_table.hpp) is generated by grapheme.py, the lookup is two array accesses.
+///@warning Internal use only.
+///
+GraphemeBreak grapheme_break(const char32_t& codepoint) noexcept;
+
+///
+///@brief Whether a grapheme cluster starts with \b codepoint , given the code points seen before.
+///
+///@param state What is known about the previous code points, \b 0 at the start of the text (a cluster always starts there). Updated.
+///@note Implements the rules GB3 to GB13 of UAX #29 (GB9c, the Indic conjunct rule of Unicode 15.1, is not).
+///@warning Internal use only.
+///
+bool is_grapheme_boundary(std::uint32_t& state, const char32_t& codepoint) noexcept;
+
+///
+///@brief Number of code points of the grapheme cluster starting at \b codepoints ( \b 0 if \b size is \b 0 ).
+///@warning Internal use only.
+///
+std::size_t grapheme_size(const char32_t* codepoints, const std::size_t& size) noexcept;
+
+///
+///@brief Split \b str into grapheme clusters.
+///@warning Internal use only.
+///
+std::vector<std::u32string> graphemes(const std::u32string& str);
+
+///
+///@brief Number of columns taken by a grapheme cluster in a terminal.
+///
+///@return The width of its widest code point, 2 for emoji presentation sequences (VS16) and flags, -1 for control characters.
+///@warning Internal use only.
+///
+int grapheme_width(const char32_t* codepoints, const std::size_t& size) noexcept;
+
+///
+///@brief The columns [ \b left , \b left + \b width ) of the UTF-8 \b text as shown in a terminal : tabs expanded to the next multiple of 8, control characters shown as ^X, a wide character cut by an edge replaced by spaces.
+///@warning Internal use only.
+///
+std::string visible_columns(const std::string& text, const std::size_t& left, const std::size_t& width);
+
+///
+///@brief Number of columns \b text takes as shown by \b visible_columns .
+///@warning Internal use only.
+///
+std::size_t visible_width(const std::string& text);
+
+}  // namespace Private
+}  // namespace Term
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+#
+# cpp-terminal
+# C++ library for writing multi-platform terminal applications.
+#
+# SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+#
+# SPDX-License-Identifier: MIT
+#
+# Generate grapheme_table.hpp, the two-stage Grapheme_Cluster_Break table used by grapheme.cpp (UAX #29), from the Unicode database of the Python running it:
+#   python3 grapheme.py > grapheme_table.hpp
+# The property is derived from the general categories and the exceptions listed in UAX #29; Extended_Pictographic comes from emoji-data.txt (ranges below).
+
+import sys
+import unicodedata
+
+BLOCK = 256  # code points per block of the second stage
+PER_BYTE = 2  # 4 bits per code point
+
+# Same order as Term::Private::GraphemeBreak
+CONTROL, OTHER, CR, LF, EXTEND, ZWJ, REGIONAL_INDICATOR, PREPEND, SPACING_MARK, L, V, T, LV, LVT, EXTENDED_PICTOGRAPHIC = range(15)
+
+# Other_Grapheme_Extend, emoji modifiers and tags
+EXTEND_RANGES = [(0x09BE, 0x09BE), (0x09D7, 0x09D7), (0x0B3E, 0x0B3E), (0x0B57, 0x0B57), (0x0BBE, 0x0BBE), (0x0BD7, 0x0BD7), (0x0CC2, 0x0CC2), (0x0CD5, 0x0CD6), (0x0D3E, 0x0D3E), (0x0D57, 0x0D57), (0x0DCF, 0x0DCF), (0x0DDF, 0x0DDF), (0x1B35, 0x1B35), (0x200C, 0x200C), (0x302E, 0x302F), (0xFF9E, 0xFF9F), (0x1133E, 0x1133E), (0x11357, 0x11357), (0x114B0, 0x114B0), (0x114BD, 0x114BD), (0x115AF, 0x115AF), (0x11930, 0x11930), (0x1D165, 0x1D165), (0x1D16E, 0x1D172), (0x1F3FB, 0x1F3FF), (0xE0020, 0xE007F)]
+PREPEND_RANGES = [(0x0600, 0x0605), (0x06DD, 0x06DD), (0x070F, 0x070F), (0x0890, 0x0891), (0x08E2, 0x08E2), (0x0D4E, 0x0D4E), (0x110BD, 0x110BD), (0x110CD, 0x110CD), (0x111C2, 0x111C3), (0x1193F, 0x1193F), (0x11941, 0x11941), (0x11A3A, 0x11A3A), (0x11A84, 0x11A89), (0x11D46, 0x11D46)]
+# Spacing combining marks that do not extend a cluster, and the two vowels that do
+NOT_SPACING_MARK = [(0x102B, 0x102C), (0x1038, 0x1038), (0x1062, 0x1064), (0x1067, 0x106D), (0x1083, 0x1083), (0x1087, 0x108C), (0x108F, 0x108F), (0x109A, 0x109C), (0x1A61, 0x1A61), (0x1A63, 0x1A64), (0xAA7B, 0xAA7B), (0xAA7D, 0xAA7D), (0x11720, 0x11721)]
+SPACING_MARK_RANGES = [(0x0E33, 0x0E33), (0x0EB3, 0x0EB3)]
+EXTENDED_PICTOGRAPHIC_RANGES = [
+  (0x00A9, 0x00A9), (0x00AE, 0x00AE), (0x203C, 0x203C), (0x2049, 0x2049), (0x2122, 0x2122), (0x2139, 0x2139), (0x2194, 0x2199), (0x21A9, 0x21AA), (0x231A, 0x231B), (0x2328, 0x2328), (0x2388, 0x2388), (0x23CF, 0x23CF), (0x23E9, 0x23F3),
+  (0x23F8, 0x23FA), (0x24C2, 0x24C2), (0x25AA, 0x25AB), (0x25B6, 0x25B6), (0x25C0, 0x25C0), (0x25FB, 0x25FE), (0x2600, 0x2605), (0x2607, 0x2612), (0x2614, 0x2685), (0x2690, 0x2705), (0x2708, 0x2712), (0x2714, 0x2714), (0x2716, 0x2716),
+  (0x271D, 0x271D), (0x2721, 0x2721), (0x2728, 0x2728), (0x2733, 0x2734), (0x2744, 0x2744), (0x2747, 0x2747), (0x274C, 0x274C), (0x274E, 0x274E), (0x2753, 0x2755), (0x2757, 0x2757), (0x2763, 0x2767), (0x2795, 0x2797), (0x27A1, 0x27A1),
+  (0x27B0, 0x27B0), (0x27BF, 0x27BF), (0x2934, 0x2935), (0x2B05, 0x2B07), (0x2B1B, 0x2B1C), (0x2B50, 0x2B50), (0x2B55, 0x2B55), (0x3030, 0x3030), (0x303D, 0x303D), (0x3297, 0x3297), (0x3299, 0x3299), (0x1F000, 0x1F0FF), (0x1F10D, 0x1F10F),
+  (0x1F12F, 0x1F12F), (0x1F16C, 0x1F171), (0x1F17E, 0x1F17F), (0x1F18E, 0x1F18E), (0x1F191, 0x1F19A), (0x1F1AD, 0x1F1E5), (0x1F201, 0x1F20F), (0x1F21A, 0x1F21A), (0x1F22F, 0x1F22F), (0x1F232, 0x1F23A), (0x1F23C, 0x1F23F), (0x1F249, 0x1F3FA),
+  (0x1F400, 0x1F53D), (0x1F546, 0x1F64F), (0x1F680, 0x1F6FF), (0x1F774, 0x1F77F), (0x1F7D5, 0x1F7FF), (0x1F80C, 0x1F80F), (0x1F848, 0x1F84F), (0x1F85A, 0x1F85F), (0x1F888, 0x1F88F), (0x1F8AE, 0x1F8FF), (0x1F90C, 0x1F93A), (0x1F93C, 0x1F945),
+  (0x1F947, 0x1FAFF), (0x1FC00, 0x1FFFD)]
+
+
+def within(codepoint, ranges):
+    return any(first <= codepoint <= last for first, last in ranges)
+
+
+def grapheme_break(codepoint):
+    if codepoint == 0x0D:
+        return CR
+    if codepoint == 0x0A:
+        return LF
+    if codepoint == 0x200D:
+        return ZWJ
+    if 0x1F1E6 <= codepoint <= 0x1F1FF:
+        return REGIONAL_INDICATOR
+    if 0x1100 <= codepoint <= 0x115F or 0xA960 <= codepoint <= 0xA97C:
+        return L
+    if 0x1160 <= codepoint <= 0x11A7 or 0xD7B0 <= codepoint <= 0xD7C6:
+        return V
+    if 0x11A8 <= codepoint <= 0x11FF or 0xD7CB <= codepoint <= 0xD7FB:
+        return T
+    if 0xAC00 <= codepoint <= 0xD7A3:
+        return LV if (codepoint - 0xAC00) % 28 == 0 else LVT
+    if within(codepoint, EXTENDED_PICTOGRAPHIC_RANGES):
+        return EXTENDED_PICTOGRAPHIC
+    if within(codepoint, PREPEND_RANGES):
+        return PREPEND
+    category = unicodedata.category(chr(codepoint))
+    if category in ("Mn", "Me") or within(codepoint, EXTEND_RANGES):
+        return EXTEND
+    if category in ("Cc", "Cf", "Cs", "Zl", "Zp"):
+        return CONTROL
+    if (category == "Mc" and not within(codepoint, NOT_SPACING_MARK)) or within(codepoint, SPACING_MARK_RANGES):
+        return SPACING_MARK
+    return OTHER
+
+
+def main():
+    values = [grapheme_break(codepoint) for codepoint in range(0x110000)]
+    blocks = []
+    index = {}
+    stage1 = []
+    for start in range(0, 0x110000, BLOCK):
+        packed = []
+        for byte in range(start, start + BLOCK, PER_BYTE):
+            packed.append(values[byte] | (values[byte + 1] << 4))
+        key = tuple(packed)
+        if key not in index:
+            index[key] = len(blocks)
+            blocks.append(key)
+        stage1.append(index[key])
+    assert len(blocks) <= 256
+
+    out = sys.stdout
+    out.write("/*\n* cpp-terminal\n* C++ library for writing multi-platform terminal applications.\n*\n* SPDX-FileCopyrightText: 2019-2023 cpp-terminal\n*\n* SPDX-License-Identifier: MIT\n*/\n\n")
+    out.write("// Generated by grapheme.py from Unicode %s, do not edit.\n\n#pragma once\n\n#include <cstdint>\n\nnamespace Term\n{\nnamespace Private\n{\nnamespace Grapheme\n{\n\n" % unicodedata.unidata_version)
+    out.write("static const constexpr char          unicode_version[]{\"%s\"};\n" % unicodedata.unidata_version)
+    out.write("static const constexpr std::uint32_t block_size{%d};\n\n" % BLOCK)
+    out.write("// Block of the second stage for each %d code points\n" % BLOCK)
+    out.write("static const constexpr std::uint8_t stage1[%d]{\n" % len(stage1))
+    for row in range(0, len(stage1), 32):
+        out.write("  " + ", ".join("%d" % value for value in stage1[row:row + 32]) + ",\n")
+    out.write("};\n\n")
+    out.write("// Grapheme_Cluster_Break of each code point in 4 bits, 2 per byte (Term::Private::GraphemeBreak)\n")
+    out.write("static const constexpr std::uint8_t stage2[%d]{\n" % (len(blocks) * BLOCK // PER_BYTE))
+    for block in blocks:
+        for row in range(0, len(block), 16):
+            out.write("  " + ", ".join("0x%02X" % value for value in block[row:row + 16]) + ",\n")
+    out.write("};\n\n}  // namespace Grapheme\n}  // namespace Private\n}  // namespace Term\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -8,8 +8,6 @@
 */
 
 #if defined(_WIN32)
-  #include "cpp-terminal/private/unicode.hpp"
-
   #include <vector>
   #include <windows.h>
 #elif defined(__APPLE__) || defined(__wasm__) || defined(__wasm) || defined(__EMSCRIPTEN__)
@@ -19,6 +17,9 @@
   #include <thread>
   #include <unistd.h>
 #else
+  #include "cpp-terminal/private/io_uring.hpp"
+
+  #include <cerrno>
   #include <memory>
   #include <sys/epoll.h>
 #endif
@@ -30,9 +31,11 @@
 #include "cpp-terminal/private/file.hpp"
 #include "cpp-terminal/private/input.hpp"
 #include "cpp-terminal/private/sigwinch.hpp"
+#include "cpp-terminal/private/unicode.hpp"
 
 #include <mutex>
 #include <string>
+#include <utility>
 
 #if defined(_WIN32)
 Term::Button::Action getAction(const std::int32_t& old_state, const std::int32_t& state, const std::int32_t& type)
@@ -75,25 +78,71 @@ void sendString(Term::Private::BlockingQueue& events, std::wstring& str)
 
 #endif
 
-std::thread Term::Private::Input::m_thread = std::thread(Term::Private::Input::read_event);
+#if defined(__linux__)
+namespace
+{
+// Used instead of epoll when the kernel lets us, must be constructed before m_thread starts.
+// Never destroyed: the detached input thread can still be waiting on it while the program exits.
+Term::Private::IoUring& ring{*new Term::Private::IoUring};  //NOLINT(fuchsia-statically-constructed-objects)
+bool                   multishot{true};
+std::uint64_t          downgraded{0};  // polls re-armed as one-shot
+enum : std::uint64_t
+{
+  RingInput    = 1,
+  RingSigwinch = 2
+};
 
-Term::Private::BlockingQueue Term::Private::Input::m_events;
+int fd_of(const std::uint64_t& user_data) { return user_data == RingSigwinch ? Term::Private::Sigwinch::get() : Term::Private::in.fd(); }
 
-int Term::Private::Input::m_poll{-1};
+bool init_ring()
+{
+  // Without a terminal the input is /dev/null: epoll refuses to watch it but io_uring would find it readable forever
+  const bool input{!Term::Private::in.null()};
+  if(!ring.init(4) || !ring.poll(Term::Private::Sigwinch::get(), RingSigwinch, multishot) || (input && !ring.poll(Term::Private::in.fd(), RingInput, multishot)) || ring.submit() != (input ? 2 : 1))
+  {
+    ring.close();
+    return false;
+  }
+  return true;
+}
 
-void Term::Private::Input::init_thread()
+int init_epoll()
 {
-  Term::Private::Sigwinch::unblockSigwinch();
-#if defined(__linux__)
-  m_poll = {::epoll_create1(EPOLL_CLOEXEC)};
+  int           poll{::epoll_create1(EPOLL_CLOEXEC)};
   ::epoll_event signal;
   signal.events  = {EPOLLIN};
   signal.data.fd = {Term::Private::Sigwinch::get()};
-  ::epoll_ctl(m_poll, EPOLL_CTL_ADD, Term::Private::Sigwinch::get(), &signal);
+  ::epoll_ctl(poll, EPOLL_CTL_ADD, Term::Private::Sigwinch::get(), &signal);
   ::epoll_event input;
   input.events  = {EPOLLIN};
   input.data.fd = {Term::Private::in.fd()};
-  ::epoll_ctl(m_poll, EPOLL_CTL_ADD, Term::Private::in.fd(), &input);
+  ::epoll_ctl(poll, EPOLL_CTL_ADD, Term::Private::in.fd(), &input);
+  return poll;
+}
+}  // namespace
+#endif
+
+namespace
+{
+// Detached as soon as it starts: a program exiting without ever reading must not destroy a joinable thread
+std::thread detached(std::thread&& thread)
+{
+  thread.detach();
+  return std::move(thread);
+}
+}  // namespace
+
+std::thread Term::Private::Input::m_thread = detached(std::thread(Term::Private::Input::read_event));
+
+Term::Private::BlockingQueue Term::Private::Input::m_events;
+
+int Term::Private::Input::m_poll{-1};
+
+void Term::Private::Input::init_thread()
+{
+  Term::Private::Sigwinch::unblockSigwinch();
+#if defined(__linux__)
+  if(!init_ring()) { m_poll = {init_epoll()}; }
 #endif
 }
 
@@ -109,6 +158,40 @@ void Term::Private::Input::read_event()
     if(Term::Private::Sigwinch::isSigwinch()) m_events.push(screen_size());
     read_raw();
 #else
+    if(ring.active())
+    {
+      // The multishot polls stay armed so waiting costs one io_uring_enter and nothing has to be re-registered
+      Term::Private::IoUring::Completion completion;
+      if(!ring.wait(completion))
+      {
+        ring.close();
+        m_poll = {init_epoll()};
+        continue;
+      }
+      if(completion.result == -EINVAL && (downgraded & completion.user_data) == 0)
+      {
+        // Kernel older than 5.13, no IORING_POLL_ADD_MULTI
+        downgraded |= completion.user_data;
+        multishot = false;
+        ring.poll(fd_of(completion.user_data), completion.user_data, multishot);
+        continue;
+      }
+      if(completion.result < 0 && completion.user_data == RingSigwinch) { continue; }  // No signalfd, no resize events (as with epoll)
+      if(completion.result < 0)
+      {
+        ring.close();
+        m_poll = {init_epoll()};
+        continue;
+      }
+      if(!completion.more()) { ring.poll(fd_of(completion.user_data), completion.user_data, multishot); }  // submitted with the next wait
+      if(completion.user_data == RingSigwinch)
+      {
+        if(Term::Private::Sigwinch::isSigwinch(Term::Private::Sigwinch::get())) m_events.push(Term::Screen(screen_size()));
+      }
+      else
+        read_raw();
+      continue;
+    }
     ::epoll_event ret;
     if(epoll_wait(m_poll, &ret, 1, -1) == 1)
     {
@@ -295,8 +378,10 @@ void Term::Private::Input::read_raw()
   sendString(m_events, ret);
   if(need_windows_size == true) { m_events.push(screen_size()); }
 #else
+  // A character can be split between two reads (long paste, slow link): keep its first bytes until the rest arrives so it is not parsed as two broken events
+  static Term::Private::Utf8Decoder decoder;
   Private::in.lockIO();
-  std::string ret = Term::Private::in.read();
+  std::string ret = decoder.complete(Term::Private::in.read());
   Private::in.unlockIO();
   if(!ret.empty()) m_events.push(Event(ret.c_str()));
 #endif
@@ -304,30 +389,29 @@ void Term::Private::Input::read_raw()
 
 Term::Private::Input::Input() {}
 
-void Term::Private::Input::startReading()
-{
-  static bool activated{false};
-  if(!activated)
-  {
-    m_thread.detach();
-    activated = true;
-  }
-}
-
 Term::Event Term::Private::Input::getEvent() { return m_events.pop(); }
 
 Term::Event Term::Private::Input::getEventBlocking()
 {
-  static std::mutex                   cv_m;
-  static std::unique_lock<std::mutex> lk(cv_m);
-  if(m_events.empty()) m_events.wait_for_events(lk);
+  m_events.wait_for_events();
   return m_events.pop();
 }
 
+Term::Event Term::Private::Input::getEventBlocking(const std::chrono::milliseconds& timeout)
+{
+  if(!m_events.wait_for_events(timeout)) { return Term::Event(); }
+  return m_events.pop();
+}
+
+void Term::Private::Input::wake(const void* owner) { m_events.push_wakeup(owner); }
+
+void Term::Private::Input::discard(const void* owner) { m_events.discard(owner); }
+
 static Term::Private::Input m_input;
 
 Term::Event Term::read_event()
 {
-  m_input.startReading();
   return m_input.getEventBlocking();
 }
+
+Term::Event Term::read_event(const std::chrono::milliseconds& timeout) { return m_input.getEventBlocking(timeout); }
@@ -11,6 +11,7 @@
 
 #include "cpp-terminal/event.hpp"
 
+#include <chrono>
 #include <cstdint>
 #include <thread>
 
@@ -26,9 +27,20 @@ class Input
 {
 public:
   Input();
-  static void        startReading();
   static Term::Event getEvent();
   static Term::Event getEventBlocking();
+  ///
+  /// @brief An empty event if none came within \b timeout .
+  ///
+  static Term::Event getEventBlocking(const std::chrono::milliseconds& timeout);
+  ///
+  /// @brief Queue an empty event after those read from the terminal, for another thread to wake a reader waiting for events on behalf of \b owner .
+  ///
+  static void wake(const void* owner);
+  ///
+  /// @brief Drop the wakeups of \b owner still queued : the reader must not see them once \b owner is done.
+  ///
+  static void discard(const void* owner);
 
 private:
   static void read_event();
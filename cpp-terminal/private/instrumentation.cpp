@@ -0,0 +1,160 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/private/instrumentation.hpp"
+
+#include "cpp-terminal/instrumentation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+
+std::size_t Term::LatencyHistogram::bucket(const std::uint64_t& nanoseconds)
+{
+  // Magnitude 0 holds 0 to sub_buckets - 1 exactly, magnitude m > 0 holds [2^(m+2), 2^(m+3)) in sub_buckets steps
+  if(nanoseconds < sub_buckets) { return static_cast<std::size_t>(nanoseconds); }
+#if defined(__GNUC__) || defined(__clang__)
+  const std::size_t msb{static_cast<std::size_t>(63 - __builtin_clzll(static_cast<unsigned long long>(nanoseconds)))};
+#else
+  std::size_t msb{0};
+  for(std::uint64_t value = nanoseconds; value > 1; value >>= 1) { ++msb; }
+#endif
+  const std::size_t magnitude{msb - 2};
+  if(magnitude >= magnitudes) { return buckets - 1; }
+  return magnitude * sub_buckets + static_cast<std::size_t>((nanoseconds >> (msb - 3)) & (sub_buckets - 1));
+}
+
+std::uint64_t Term::LatencyHistogram::lower_bound(const std::size_t& bucket)
+{
+  const std::size_t magnitude{bucket / sub_buckets};
+  const std::size_t sub{bucket % sub_buckets};
+  if(magnitude == 0) { return sub; }
+  return static_cast<std::uint64_t>(sub_buckets + sub) << (magnitude - 1);
+}
+
+void Term::LatencyHistogram::record(const std::uint64_t& nanoseconds, const std::uint64_t& count)
+{
+  if(count == 0) { return; }
+  m_counts[bucket(nanoseconds)] += count;
+  m_min = (m_count == 0) ? nanoseconds : std::min(m_min, nanoseconds);
+  m_max = std::max(m_max, nanoseconds);
+  m_count += count;
+  m_sum += nanoseconds * count;
+}
+
+void Term::LatencyHistogram::merge(const LatencyHistogram& histogram)
+{
+  if(histogram.m_count == 0) { return; }
+  for(std::size_t i = 0; i != buckets; ++i) { m_counts[i] += histogram.m_counts[i]; }
+  m_min = (m_count == 0) ? histogram.m_min : std::min(m_min, histogram.m_min);
+  m_max = std::max(m_max, histogram.m_max);
+  m_count += histogram.m_count;
+  m_sum += histogram.m_sum;
+}
+
+std::uint64_t Term::LatencyHistogram::count() const { return m_count; }
+
+std::uint64_t Term::LatencyHistogram::min() const { return m_min; }
+
+std::uint64_t Term::LatencyHistogram::max() const { return m_max; }
+
+double Term::LatencyHistogram::mean() const { return m_count == 0 ? 0 : static_cast<double>(m_sum) / static_cast<double>(m_count); }
+
+std::uint64_t Term::LatencyHistogram::percentile(const double& percentile) const
+{
+  if(m_count == 0) { return 0; }
+  const double        clamped{std::min(100.0, std::max(0.0, percentile))};
+  const std::uint64_t rank{std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(m_count))))};
+  std::uint64_t       seen{0};
+  for(std::size_t i = 0; i != buckets; ++i)
+  {
+    seen += m_counts[i];
+    // Highest value equivalent to the bucket, clamped to what was really recorded
+    if(seen >= rank) { return std::max(m_min, std::min(m_max, i + 1 == buckets ? m_max : lower_bound(i + 1) - 1)); }
+  }
+  return m_max;
+}
+
+const std::array<std::uint64_t, Term::LatencyHistogram::buckets>& Term::LatencyHistogram::counts() const { return m_counts; }
+
+static_assert(static_cast<std::size_t>(Term::Event::Type::CopyPaste) + 1 == std::tuple_size<decltype(Term::Instrumentation::Snapshot::events)>::value, "Snapshot::events must have one counter per Term::Event::Type");
+
+std::uint64_t Term::Instrumentation::Snapshot::events_of(const Term::Event::Type& type) const
+{
+  const std::size_t index{static_cast<std::size_t>(type)};
+  return index < events.size() ? events[index] : 0;
+}
+
+namespace
+{
+// One lock for everything: the recorded operations are system calls or already locked queue pushes, so contention is not a concern
+std::mutex& mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+Term::Instrumentation::Snapshot& counters()
+{
+  static Term::Instrumentation::Snapshot counters;
+  return counters;
+}
+}  // namespace
+
+#if defined(CPPTERMINAL_ENABLE_INSTRUMENTATION)
+bool Term::Instrumentation::enabled() noexcept { return true; }
+
+std::uint64_t Term::Private::Instrumentation::now() { return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()); }
+
+void Term::Private::Instrumentation::write(const std::size_t& requested, const long& result, const std::uint64_t& start)
+{
+  const std::uint64_t               duration{now() - start};
+  const std::lock_guard<std::mutex> lock(mutex());
+  Term::Instrumentation::Snapshot&  snapshot{counters()};
+  ++snapshot.write_calls;
+  snapshot.write_latency.record(duration);
+  if(result > 0)
+  {
+    snapshot.bytes_written += static_cast<std::uint64_t>(result);
+    if(static_cast<std::size_t>(result) < requested) { ++snapshot.short_writes; }
+  }
+}
+
+void Term::Private::Instrumentation::stall()
+{
+  const std::lock_guard<std::mutex> lock(mutex());
+  ++counters().eagain_stalls;
+}
+
+void Term::Private::Instrumentation::event(const Term::Event::Type& type, const std::size_t& depth)
+{
+  const std::lock_guard<std::mutex> lock(mutex());
+  Term::Instrumentation::Snapshot&  snapshot{counters()};
+  const std::size_t                 index{static_cast<std::size_t>(type)};
+  if(index < snapshot.events.size()) { ++snapshot.events[index]; }
+  snapshot.queue_high_water = std::max<std::uint64_t>(snapshot.queue_high_water, depth);
+}
+#else
+bool Term::Instrumentation::enabled() noexcept { return false; }
+#endif
+
+Term::Instrumentation::Snapshot Term::Instrumentation::snapshot()
+{
+  const std::lock_guard<std::mutex> lock(mutex());
+  Snapshot                          ret{counters()};
+  ret.enabled = enabled();
+  return ret;
+}
+
+void Term::Instrumentation::reset()
+{
+  const std::lock_guard<std::mutex> lock(mutex());
+  counters() = Snapshot();
+}
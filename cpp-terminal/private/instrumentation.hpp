@@ -0,0 +1,60 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include "cpp-terminal/event.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+///
+///@file instrumentation.hpp
+///@brief Recording side of \b Term::Instrumentation .
+///@warning Internal use only. Without \b CPPTERMINAL_ENABLE_INSTRUMENTATION every function is an empty inline function (and \b now() doesn't read the clock) so the calls compile away.
+///
+
+namespace Term
+{
+
+namespace Private
+{
+
+namespace Instrumentation
+{
+
+#if defined(CPPTERMINAL_ENABLE_INSTRUMENTATION)
+///
+///@brief Monotonic time in nanoseconds.
+///
+std::uint64_t now();
+///
+///@brief One \b write() system call asked to write \b requested bytes, returned \b result and started at \b start .
+///
+void          write(const std::size_t& requested, const long& result, const std::uint64_t& start);
+///
+///@brief The output returned \b EAGAIN .
+///
+void          stall();
+///
+///@brief An event of type \b type has been queued, the queue now holds \b depth events.
+///
+void          event(const Term::Event::Type& type, const std::size_t& depth);
+#else
+inline std::uint64_t now() { return 0; }
+inline void          write(const std::size_t&, const long&, const std::uint64_t&) {}
+inline void          stall() {}
+inline void          event(const Term::Event::Type&, const std::size_t&) {}
+#endif
+
+}  // namespace Instrumentation
+
+}  // namespace Private
+
+}  // namespace Term
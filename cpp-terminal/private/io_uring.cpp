@@ -0,0 +1,177 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/private/io_uring.hpp"
+
+#if defined(CPPTERMINAL_HAS_IO_URING)
+  #include <algorithm>
+  #include <cerrno>
+  #include <cstring>
+  #include <linux/io_uring.h>
+  #include <poll.h>
+  #include <sys/mman.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+Term::Private::IoUring::~IoUring() { close(); }
+
+bool Term::Private::IoUring::active() const { return m_fd != -1; }
+
+#if defined(CPPTERMINAL_HAS_IO_URING)
+
+bool Term::Private::IoUring::Completion::more() const { return (flags & IORING_CQE_F_MORE) != 0; }
+
+bool Term::Private::IoUring::init(const std::uint32_t& entries)
+{
+  if(active()) { return true; }
+  ::io_uring_params params;
+  std::memset(&params, 0, sizeof(params));
+  m_fd = {static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params))};
+  if(m_fd == -1) { return false; }  // ENOSYS, EPERM (seccomp, io_uring_disabled sysctl) ...
+  m_sq_ring_size = {params.sq_off.array + params.sq_entries * sizeof(std::uint32_t)};
+  m_cq_ring_size = {params.cq_off.cqes + params.cq_entries * sizeof(::io_uring_cqe)};
+  const bool single_mmap{(params.features & IORING_FEAT_SINGLE_MMAP) != 0};
+  if(single_mmap) { m_sq_ring_size = m_cq_ring_size = std::max(m_sq_ring_size, m_cq_ring_size); }
+  m_sq_ring = ::mmap(nullptr, m_sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+  if(m_sq_ring == MAP_FAILED)
+  {
+    m_sq_ring = nullptr;
+    close();
+    return false;
+  }
+  if(single_mmap) { m_cq_ring = m_sq_ring; }
+  else
+  {
+    m_cq_ring = ::mmap(nullptr, m_cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_CQ_RING);
+    if(m_cq_ring == MAP_FAILED)
+    {
+      m_cq_ring = nullptr;
+      close();
+      return false;
+    }
+  }
+  m_sqes_size = {params.sq_entries * sizeof(::io_uring_sqe)};
+  m_sqes      = ::mmap(nullptr, m_sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES);
+  if(m_sqes == MAP_FAILED)
+  {
+    m_sqes = nullptr;
+    close();
+    return false;
+  }
+  char* sq{static_cast<char*>(m_sq_ring)};
+  char* cq{static_cast<char*>(m_cq_ring)};
+  m_sq_head    = reinterpret_cast<std::uint32_t*>(sq + params.sq_off.head);
+  m_sq_tail    = reinterpret_cast<std::uint32_t*>(sq + params.sq_off.tail);
+  m_sq_array   = reinterpret_cast<std::uint32_t*>(sq + params.sq_off.array);
+  m_sq_mask    = *reinterpret_cast<std::uint32_t*>(sq + params.sq_off.ring_mask);
+  m_sq_entries = params.sq_entries;
+  m_cq_head    = reinterpret_cast<std::uint32_t*>(cq + params.cq_off.head);
+  m_cq_tail    = reinterpret_cast<std::uint32_t*>(cq + params.cq_off.tail);
+  m_cq_mask    = *reinterpret_cast<std::uint32_t*>(cq + params.cq_off.ring_mask);
+  m_cqes       = cq + params.cq_off.cqes;
+  m_to_submit  = 0;
+  return true;
+}
+
+void Term::Private::IoUring::close()
+{
+  if(m_sqes != nullptr) { ::munmap(m_sqes, m_sqes_size); }
+  if(m_cq_ring != nullptr && m_cq_ring != m_sq_ring) { ::munmap(m_cq_ring, m_cq_ring_size); }
+  if(m_sq_ring != nullptr) { ::munmap(m_sq_ring, m_sq_ring_size); }
+  if(m_fd != -1) { ::close(m_fd); }
+  m_sqes    = nullptr;
+  m_cq_ring = nullptr;
+  m_sq_ring = nullptr;
+  m_fd      = -1;
+}
+
+void* Term::Private::IoUring::get_sqe()
+{
+  const std::uint32_t head{__atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE)};
+  const std::uint32_t tail{*m_sq_tail + m_to_submit};
+  if(tail - head >= m_sq_entries) { return nullptr; }
+  const std::uint32_t index{tail & m_sq_mask};
+  ::io_uring_sqe*     sqe{static_cast<::io_uring_sqe*>(m_sqes) + index};
+  std::memset(sqe, 0, sizeof(::io_uring_sqe));
+  m_sq_array[index] = index;
+  ++m_to_submit;
+  return sqe;
+}
+
+bool Term::Private::IoUring::poll(const int& fd, const std::uint64_t& user_data, const bool& multishot)
+{
+  ::io_uring_sqe* sqe{static_cast<::io_uring_sqe*>(get_sqe())};
+  if(sqe == nullptr) { return false; }
+  sqe->opcode      = IORING_OP_POLL_ADD;
+  sqe->fd          = fd;
+  sqe->poll_events = POLLIN;  // the kernel reads the low half-word whatever the endianness
+  sqe->user_data   = user_data;
+  #if defined(IORING_POLL_ADD_MULTI)
+  if(multishot) { sqe->len = IORING_POLL_ADD_MULTI; }
+  #else
+  static_cast<void>(multishot);
+  #endif
+  return true;
+}
+
+int Term::Private::IoUring::submit(const std::uint32_t& wait_nr)
+{
+  if(m_to_submit != 0) { __atomic_store_n(m_sq_tail, *m_sq_tail + m_to_submit, __ATOMIC_RELEASE); }
+  const std::uint32_t to_submit{m_to_submit};
+  m_to_submit = 0;
+  while(true)
+  {
+    const long ret{::syscall(__NR_io_uring_enter, m_fd, to_submit, wait_nr, wait_nr != 0 ? IORING_ENTER_GETEVENTS : 0U, nullptr, 0)};
+    if(ret >= 0) { return static_cast<int>(ret); }
+    if(errno != EINTR) { return -1; }
+  }
+}
+
+bool Term::Private::IoUring::peek(Completion& completion)
+{
+  const std::uint32_t head{*m_cq_head};
+  if(head == __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE)) { return false; }
+  const ::io_uring_cqe* cqe{static_cast<const ::io_uring_cqe*>(m_cqes) + (head & m_cq_mask)};
+  completion.user_data = cqe->user_data;
+  completion.result    = cqe->res;
+  completion.flags     = cqe->flags;
+  __atomic_store_n(m_cq_head, head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool Term::Private::IoUring::wait(Completion& completion)
+{
+  if(m_to_submit == 0 && peek(completion)) { return true; }
+  while(true)
+  {
+    if(submit(1) == -1) { return false; }
+    if(peek(completion)) { return true; }
+  }
+}
+
+#else
+
+bool Term::Private::IoUring::Completion::more() const { return false; }
+
+bool Term::Private::IoUring::init(const std::uint32_t&) { return false; }
+
+void Term::Private::IoUring::close() {}
+
+void* Term::Private::IoUring::get_sqe() { return nullptr; }
+
+bool Term::Private::IoUring::poll(const int&, const std::uint64_t&, const bool&) { return false; }
+
+int Term::Private::IoUring::submit(const std::uint32_t&) { return -1; }
+
+bool Term::Private::IoUring::peek(Completion&) { return false; }
+
+bool Term::Private::IoUring::wait(Completion&) { return false; }
+
+#endif
@@ -0,0 +1,93 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+///
+///@file io_uring.hpp
+///@brief Minimal io_uring ring used by the Linux input thread.
+///@warning Internal use only.
+///
+
+namespace Term
+{
+
+namespace Private
+{
+
+///
+///@brief A single submission/completion ring driven by raw \b io_uring_setup and \b io_uring_enter syscalls (no liburing dependency).
+///
+/// The ring is owned by one thread. \b init() returns \b false when the kernel (or a seccomp filter) refuses io_uring so callers can fall back to epoll.
+///@warning Internal use only. \b Linux specific, only functional when built with \b CPPTERMINAL_HAS_IO_URING .
+///
+class IoUring
+{
+public:
+  struct Completion
+  {
+    std::uint64_t user_data{0};
+    std::int32_t  result{0};
+    std::uint32_t flags{0};
+    ///
+    ///@brief \b true if a multishot request will post more completions.
+    ///
+    bool          more() const;
+  };
+  IoUring() = default;
+  ~IoUring();
+  IoUring(const IoUring&)            = delete;
+  IoUring(IoUring&&)                 = delete;
+  IoUring& operator=(const IoUring&) = delete;
+  IoUring& operator=(IoUring&&)      = delete;
+  bool     init(const std::uint32_t& entries);
+  void     close();
+  bool     active() const;
+  ///
+  ///@brief Queue a poll on \b fd that stays armed across readiness notifications (falls back to one-shot on old kernels, see \b Completion::more()).
+  ///
+  bool     poll(const int& fd, const std::uint64_t& user_data, const bool& multishot = true);
+  ///
+  ///@brief Submit the queued requests and wait until at least \b wait_nr completions are available, in a single syscall.
+  ///@return The number of submitted requests or \b -1 on error.
+  ///
+  int      submit(const std::uint32_t& wait_nr = 0);
+  ///
+  ///@brief Pop a completion, blocking (and flushing pending submissions) if none is available.
+  ///
+  bool     wait(Completion& completion);
+
+private:
+  void*          get_sqe();
+  bool           peek(Completion& completion);
+  int            m_fd{-1};
+  void*          m_sq_ring{nullptr};
+  std::size_t    m_sq_ring_size{0};
+  void*          m_cq_ring{nullptr};
+  std::size_t    m_cq_ring_size{0};
+  void*          m_sqes{nullptr};
+  std::size_t    m_sqes_size{0};
+  std::uint32_t* m_sq_head{nullptr};
+  std::uint32_t* m_sq_tail{nullptr};
+  std::uint32_t* m_sq_array{nullptr};
+  std::uint32_t  m_sq_mask{0};
+  std::uint32_t  m_sq_entries{0};
+  std::uint32_t  m_to_submit{0};
+  std::uint32_t* m_cq_head{nullptr};
+  std::uint32_t* m_cq_tail{nullptr};
+  void*          m_cqes{nullptr};
+  std::uint32_t  m_cq_mask{0};
+};
+
+}  // namespace Private
+
+}  // namespace Term
@@ -0,0 +1,156 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/private/line_index.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+const std::size_t block_size{1024 * 1024};
+}
+
+Term::Private::LineIndex::LineIndex(const std::string& path, const std::size_t& spacing, const std::size_t& chunk) : m_path(path), m_spacing(std::max<std::size_t>(spacing, 1)), m_chunk(std::max<std::size_t>(chunk, 1))
+{
+  m_checkpoints.push_back({0, 0});
+  update();
+}
+
+Term::Private::LineIndex::~LineIndex()
+{
+  m_stop = true;
+  if(m_worker.joinable()) { m_worker.join(); }
+}
+
+void Term::Private::LineIndex::update()
+{
+  if(m_busy) { return; }
+  if(m_worker.joinable()) { m_worker.join(); }
+  const std::size_t size{file_size(m_path)};
+  const std::size_t begin{indexed()};
+  if(size <= begin) { return; }
+  m_busy   = true;
+  m_worker = std::thread(&LineIndex::run, this, begin, size);
+}
+
+bool Term::Private::LineIndex::busy() const { return m_busy; }
+
+std::size_t Term::Private::LineIndex::indexed() const
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  return m_indexed;
+}
+
+std::size_t Term::Private::LineIndex::newlines() const
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  return m_newlines;
+}
+
+Term::Private::LineIndex::Checkpoint Term::Private::LineIndex::before_line(const std::size_t& line) const
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  return *(std::upper_bound(m_checkpoints.begin(), m_checkpoints.end(), line, [](const std::size_t& value, const Checkpoint& checkpoint) { return value < checkpoint.line; }) - 1);
+}
+
+Term::Private::LineIndex::Checkpoint Term::Private::LineIndex::before_offset(const std::size_t& offset) const
+{
+  const std::lock_guard<std::mutex> lock(m_mutex);
+  return *(std::upper_bound(m_checkpoints.begin(), m_checkpoints.end(), offset, [](const std::size_t& value, const Checkpoint& checkpoint) { return value < checkpoint.offset; }) - 1);
+}
+
+std::size_t Term::Private::LineIndex::file_size(const std::string& path)
+{
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if(!file) { return 0; }
+  const std::streamoff size{file.tellg()};
+  return size > 0 ? static_cast<std::size_t>(size) : 0;
+}
+
+void Term::Private::LineIndex::run(const std::size_t& begin, const std::size_t& end)
+{
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_chunks.clear();
+    for(std::size_t start = begin; start < end; start += m_chunk)
+    {
+      Chunk chunk;
+      chunk.begin = start;
+      chunk.end   = std::min(end, start + m_chunk);
+      m_chunks.push_back(chunk);
+    }
+    m_current = 0;
+    m_base    = m_newlines;
+  }
+  m_next = 0;
+  // Each thread takes the next chunk to scan until there are none left
+  const std::size_t        threads{std::max<std::size_t>(1, std::min<std::size_t>(std::thread::hardware_concurrency(), m_chunks.size()))};
+  std::vector<std::thread> helpers;
+  const auto               work = [this]()
+  {
+    for(std::size_t chunk = m_next++; chunk < m_chunks.size() && !m_stop; chunk = m_next++) { scan(chunk); }
+  };
+  for(std::size_t thread = 1; thread < threads; ++thread) { helpers.emplace_back(work); }
+  work();
+  for(std::thread& helper: helpers) { helper.join(); }
+  m_busy = false;
+}
+
+void Term::Private::LineIndex::scan(const std::size_t& chunk)
+{
+  std::ifstream file(m_path, std::ios::binary);
+  std::size_t   position{0};
+  std::size_t   end{0};
+  std::size_t   newlines{0};
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    position = m_chunks[chunk].begin;
+    end      = m_chunks[chunk].end;
+  }
+  file.seekg(static_cast<std::streamoff>(position));
+  std::string              block(std::min(block_size, end - position), '\0');
+  std::vector<std::size_t> positions;
+  while(position < end && !m_stop)
+  {
+    file.read(&block[0], static_cast<std::streamsize>(std::min(block.size(), end - position)));
+    const std::size_t read{static_cast<std::size_t>(file.gcount())};
+    positions.clear();
+    for(const char* found = static_cast<const char*>(std::memchr(block.data(), '\n', read)); found != nullptr; found = static_cast<const char*>(std::memchr(found + 1, '\n', read - static_cast<std::size_t>(found + 1 - block.data()))))
+    {
+      if(newlines % m_spacing == 0) { positions.push_back(position + static_cast<std::size_t>(found - block.data())); }
+      ++newlines;
+    }
+    // A file truncated meanwhile ends the chunk
+    position = read == 0 ? end : position + read;
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    Chunk&                            done{m_chunks[chunk]};
+    done.positions.insert(done.positions.end(), positions.begin(), positions.end());
+    done.done     = position - done.begin;
+    done.newlines = newlines;
+    publish();
+  }
+}
+
+// Called locked: move the chunks done, in order, to the index, and what is done of the next one
+void Term::Private::LineIndex::publish()
+{
+  while(m_current < m_chunks.size())
+  {
+    Chunk& chunk{m_chunks[m_current]};
+    for(; chunk.merged < chunk.positions.size(); ++chunk.merged) { m_checkpoints.push_back({m_base + chunk.merged * m_spacing + 1, chunk.positions[chunk.merged] + 1}); }
+    m_indexed  = chunk.begin + chunk.done;
+    m_newlines = m_base + chunk.newlines;
+    if(chunk.begin + chunk.done != chunk.end) { return; }
+    std::vector<std::size_t>().swap(chunk.positions);
+    m_base += chunk.newlines;
+    ++m_current;
+  }
+}
@@ -0,0 +1,119 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Term
+{
+
+namespace Private
+{
+
+///
+/// @brief A sparse index of the lines of a file, built in the background : the start of one line every \b spacing lines or so, so that it is the size of the file over \b spacing rather than of the file.
+///
+/// The file is split in chunks indexed in parallel, by as many threads as cores, and the index grows as the chunks are done, in order. The file is read a block at a time, never held in memory.
+/// The lines are counted from 0, a line starts after each '\\n'. Every function but the constructor and \b update can be called while the index is built.
+///
+class LineIndex
+{
+public:
+  ///
+  /// @brief A line known to start at \b offset .
+  ///
+  struct Checkpoint
+  {
+    std::size_t line;
+    std::size_t offset;
+  };
+
+  ///
+  /// @brief Start indexing the file at \b path in chunks of \b chunk bytes.
+  ///
+  LineIndex(const std::string& path, const std::size_t& spacing = 1024, const std::size_t& chunk = 16 * 1024 * 1024);
+  ~LineIndex();
+  LineIndex(const LineIndex&)            = delete;
+  LineIndex(LineIndex&&)                 = delete;
+  LineIndex& operator=(const LineIndex&) = delete;
+  LineIndex& operator=(LineIndex&&)      = delete;
+
+  ///
+  /// @brief Start indexing what was appended to the file since, unless the index is still being built.
+  ///
+  void update();
+
+  ///
+  /// @brief Whether the index is being built.
+  ///
+  bool busy() const;
+
+  ///
+  /// @brief The bytes indexed, from the start of the file.
+  ///
+  std::size_t indexed() const;
+
+  ///
+  /// @brief The '\\n' in the bytes indexed.
+  ///
+  std::size_t newlines() const;
+
+  ///
+  /// @brief The last checkpoint at or before \b line .
+  ///
+  Checkpoint before_line(const std::size_t& line) const;
+
+  ///
+  /// @brief The last checkpoint at or before \b offset .
+  ///
+  Checkpoint before_offset(const std::size_t& offset) const;
+
+  ///
+  /// @brief The size of the file at \b path , 0 if it cannot be opened.
+  ///
+  static std::size_t file_size(const std::string& path);
+
+private:
+  struct Chunk
+  {
+    std::size_t              begin{0};
+    std::size_t              end{0};
+    std::size_t              done{0};      ///< Bytes indexed from begin.
+    std::size_t              newlines{0};  ///< In those bytes.
+    std::vector<std::size_t> positions;    ///< Of the '\\n' numbered 0, spacing, 2 spacing... in the chunk.
+    std::size_t              merged{0};    ///< The positions in the index.
+  };
+  void                     run(const std::size_t& begin, const std::size_t& end);
+  void                     scan(const std::size_t& chunk);
+  void                     publish();
+  std::string              m_path;
+  std::size_t              m_spacing{1024};
+  std::size_t              m_chunk{0};
+  mutable std::mutex       m_mutex;
+  std::vector<Checkpoint>  m_checkpoints;  ///< Increasing lines and offsets, starting with line 0.
+  std::size_t              m_indexed{0};
+  std::size_t              m_newlines{0};
+  std::vector<Chunk>       m_chunks;      ///< The ones being indexed.
+  std::size_t              m_current{0};  ///< The first chunk not fully in the index.
+  std::size_t              m_base{0};     ///< The '\\n' before it.
+  std::atomic<std::size_t> m_next{0};     ///< The next chunk to scan.
+  std::atomic<bool>        m_busy{false};
+  std::atomic<bool>        m_stop{false};
+  std::thread              m_worker;
+};
+
+}  // namespace Private
+
+}  // namespace Term
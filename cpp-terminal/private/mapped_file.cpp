@@ -0,0 +1,117 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/private/mapped_file.hpp"
+
+#include "cpp-terminal/private/exception.hpp"
+
+#include <utility>
+
+#if defined(_WIN32)
+  #include <fstream>
+#else
+  #include <cerrno>
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+Term::Private::MappedFile Term::Private::MappedFile::from_string(const std::string& text)
+{
+  MappedFile ret;
+  ret.m_copy = text;
+  ret.m_data = ret.m_copy.data();
+  ret.m_size = ret.m_copy.size();
+  return ret;
+}
+
+Term::Private::MappedFile::MappedFile(const std::string& path)
+{
+#if defined(_WIN32)
+  std::ifstream file(path, std::ios::binary);
+  if(!file) { throw Term::Exception("cannot open " + path); }
+  file.seekg(0, std::ios::end);
+  m_copy.resize(static_cast<std::size_t>(file.tellg()));
+  file.seekg(0);
+  file.read(&m_copy[0], static_cast<std::streamsize>(m_copy.size()));
+  m_copy.resize(static_cast<std::size_t>(file.gcount()));
+  m_data = m_copy.data();
+  m_size = m_copy.size();
+#else
+  const int fd{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+  Term::Private::Errno().check_if(fd == -1).throw_exception("open() failed for " + path);
+  struct ::stat        status;
+  Term::Private::Errno error;
+  const int            ret{::fstat(fd, &status)};
+  error.check_if(ret == -1);
+  if(ret == -1) { ::close(fd); }
+  error.throw_exception("fstat() failed for " + path);
+  m_size = static_cast<std::size_t>(status.st_size);
+  if(m_size != 0)
+  {
+    void* map{::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0)};
+    if(map != MAP_FAILED)
+    {
+      m_map  = map;
+      m_data = static_cast<const char*>(map);
+    }
+  }
+  if(m_map == nullptr)
+  {
+    // Not mappable (a pipe, /proc...): read it, its size may be wrong
+    std::string buffer(64 * 1024, '\0');
+    while(true)
+    {
+      Term::Private::Errno read_error;
+      const ::ssize_t      nread{::read(fd, &buffer[0], buffer.size())};
+      if(nread == -1 && errno == EINTR) { continue; }
+      read_error.check_if(nread == -1);
+      if(nread == -1) { ::close(fd); }
+      read_error.throw_exception("read() failed for " + path);
+      if(nread == 0) { break; }
+      m_copy.append(buffer.data(), static_cast<std::size_t>(nread));
+    }
+    m_data = m_copy.data();
+    m_size = m_copy.size();
+    ::close(fd);
+  }
+  else { m_fd = fd; }  // kept to check the size of the file later
+#endif
+}
+
+Term::Private::MappedFile::~MappedFile()
+{
+#if !defined(_WIN32)
+  if(m_map != nullptr) { ::munmap(m_map, m_size); }
+  if(m_fd != -1) { ::close(m_fd); }
+#endif
+}
+
+Term::Private::MappedFile::MappedFile(MappedFile&& other) noexcept : m_size(other.m_size), m_map(other.m_map), m_fd(other.m_fd), m_copy(std::move(other.m_copy))
+{
+  m_data       = m_map != nullptr ? other.m_data : m_copy.data();
+  other.m_map  = nullptr;
+  other.m_fd   = -1;
+  other.m_data = nullptr;
+  other.m_size = 0;
+}
+
+bool Term::Private::MappedFile::intact() const
+{
+#if !defined(_WIN32)
+  struct ::stat status;
+  if(m_fd != -1 && ::fstat(m_fd, &status) == 0) { return static_cast<std::size_t>(status.st_size) >= m_size; }
+#endif
+  return true;
+}
+
+const char* Term::Private::MappedFile::data() const { return m_data; }
+
+std::size_t Term::Private::MappedFile::size() const { return m_size; }
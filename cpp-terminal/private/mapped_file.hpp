@@ -0,0 +1,61 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace Term
+{
+
+namespace Private
+{
+
+///
+/// @brief The bytes of a file, read only and memory mapped so that opening it costs nothing whatever its size (read into memory where it cannot be mapped).
+///
+/// The mapping is private : replacing the file (by renaming another one over it) does not change it. Truncating the file while it is mapped does : reading the bytes past its new end raises SIGBUS.
+/// That cannot be caught at each read, \b intact() tells whether it happened before reading the whole file again.
+///
+class MappedFile
+{
+public:
+  ///
+  /// @brief \b text itself, for the buffers which do not come from a file.
+  ///
+  static MappedFile from_string(const std::string& text);
+
+  explicit MappedFile(const std::string& path);
+  ~MappedFile();
+  MappedFile(const MappedFile&)            = delete;
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&&)      = delete;
+
+  const char* data() const;
+  std::size_t size() const;
+
+  ///
+  /// @brief Whether the file still holds all the mapped bytes, false once another process truncated it. Always true when the bytes are not mapped.
+  ///
+  bool intact() const;
+
+private:
+  MappedFile() = default;
+  const char* m_data{nullptr};
+  std::size_t m_size{0};
+  void*       m_map{nullptr};  ///< The mapping to unmap, if any.
+  int         m_fd{-1};        ///< The mapped file, open as long as it is mapped.
+  std::string m_copy;          ///< The bytes when they are not mapped.
+};
+
+}  // namespace Private
+
+}  // namespace Term
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+#
+# cpp-terminal
+# C++ library for writing multi-platform terminal applications.
+#
+# SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+#
+# SPDX-License-Identifier: MIT
+#
+# Generate palette_table.hpp, the lookup tables used by Term::Color to downgrade colors (color.cpp):
+#   python3 palette.py > palette_table.hpp
+# A 24bit color goes to the nearest color of the 256 (or 16) color palette in the OKLab space, which is perceptually uniform.
+# For the 256 colors each channel is rounded to the nearest of the 30 levels used by the palette (so its colors map to themselves)
+# and the table holds the answer for each of the 30x30x30 cells. For the 16 colors the channels are truncated to 4 bits.
+
+import sys
+
+# xterm default palette
+BIT4 = [(0, 0, 0), (205, 0, 0), (0, 205, 0), (205, 205, 0), (0, 0, 238), (205, 0, 205), (0, 205, 205), (229, 229, 229), (127, 127, 127), (255, 0, 0), (0, 255, 0), (255, 255, 0), (92, 92, 255), (255, 0, 255), (0, 255, 255), (255, 255, 255)]
+LEVELS = [0, 95, 135, 175, 215, 255]
+PALETTE = BIT4 + [(LEVELS[i // 36], LEVELS[(i // 6) % 6], LEVELS[i % 6]) for i in range(216)] + [(8 + 10 * i,) * 3 for i in range(24)]
+# Term::Color::Name of the 16 colors
+NAMES = list(range(8)) + list(range(60, 68))
+
+
+def linear(channel):
+    channel /= 255.0
+    return channel / 12.92 if channel <= 0.04045 else ((channel + 0.055) / 1.055) ** 2.4
+
+
+def oklab(rgb):
+    r, g, b = (linear(channel) for channel in rgb)
+    l = (0.4122214708 * r + 0.5363325363 * g + 0.0514459929 * b) ** (1.0 / 3.0)
+    m = (0.2119034982 * r + 0.6806995451 * g + 0.1073969566 * b) ** (1.0 / 3.0)
+    s = (0.0883024619 * r + 0.2817188376 * g + 0.6299787005 * b) ** (1.0 / 3.0)
+    return (0.2104542553 * l + 0.7936177850 * m - 0.0040720468 * s, 1.9779984951 * l - 2.4285922050 * m + 0.4505937099 * s, 0.0259040371 * l + 0.7827717662 * m - 0.8086757660 * s)
+
+
+def nearest(rgb, candidates):
+    lab = oklab(rgb)
+    best = None
+    for index, candidate in candidates:
+        distance = sum((x - y) ** 2 for x, y in zip(lab, candidate))
+        if best is None or distance < best[0]:
+            best = (distance, index)
+    return best[1]
+
+
+# Levels of the channels of the 6x6x6 cube and of the grayscale ramp
+CHANNEL_LEVELS = sorted(set(LEVELS + [8 + 10 * i for i in range(24)]))
+
+
+def lut(values, candidates):
+    size = len(values)
+    return [nearest((values[r], values[g], values[b]), candidates) for r in range(size) for g in range(size) for b in range(size)]
+
+
+def table(out, declaration, values, per_line):
+    out.write("static const constexpr %s{\n" % declaration)
+    for row in range(0, len(values), per_line):
+        out.write("  " + ", ".join("%d" % value for value in values[row:row + per_line]) + ",\n")
+    out.write("};\n\n")
+
+
+def main():
+    # The 16 first colors can be changed by the user: 24bit colors only go to the fixed ones
+    fixed = [(index, oklab(PALETTE[index])) for index in range(16, 256)]
+    bit4 = [(NAMES[index], oklab(PALETTE[index])) for index in range(16)]
+    out = sys.stdout
+    out.write("/*\n* cpp-terminal\n* C++ library for writing multi-platform terminal applications.\n*\n* SPDX-FileCopyrightText: 2019-2023 cpp-terminal\n*\n* SPDX-License-Identifier: MIT\n*/\n\n")
+    out.write("// Generated by palette.py, do not edit.\n\n#pragma once\n\n#include <cstdint>\n\nnamespace Term\n{\nnamespace Private\n{\nnamespace Palette\n{\n\n")
+    out.write("static const constexpr std::uint32_t levels{%d};\n" % len(CHANNEL_LEVELS))
+    out.write("static const constexpr std::uint32_t bits4{4};\n\n")
+    out.write("// RGB values of the 256 colors (xterm)\n")
+    table(out, "std::uint8_t rgb[768]", [channel for color in PALETTE for channel in color], 48)
+    out.write("// Nearest 4bit color (Term::Color::Name) of each 8bit color\n")
+    table(out, "std::uint8_t bit8_to_bit4[256]", [NAMES[index] if index < 16 else nearest(PALETTE[index], bit4) for index in range(256)], 32)
+    out.write("// Nearest level of the palette of each channel value (%s)\n" % ", ".join("%d" % level for level in CHANNEL_LEVELS))
+    table(out, "std::uint8_t level[256]", [min(range(len(CHANNEL_LEVELS)), key=lambda index: abs(CHANNEL_LEVELS[index] - value)) for value in range(256)], 32)
+    out.write("// Nearest 8bit color (16-255) of each 24bit color, indexed by (level[r] * levels + level[g]) * levels + level[b]\n")
+    table(out, "std::uint8_t bit24_to_bit8[%d]" % len(CHANNEL_LEVELS) ** 3, lut(CHANNEL_LEVELS, fixed), 30)
+    out.write("// Nearest 4bit color (Term::Color::Name) of each 24bit color, indexed by r << 8 | g << 4 | b on 4 bits\n")
+    table(out, "std::uint8_t bit24_to_bit4[4096]", lut([17 * cell for cell in range(16)], bit4), 32)
+    out.write("}  // namespace Palette\n}  // namespace Private\n}  // namespace Term\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,323 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/private/shared_file.hpp"
+
+#include "cpp-terminal/private/exception.hpp"
+
+#if defined(_WIN32)
+  #include "cpp-terminal/private/unicode.hpp"
+
+  #include <algorithm>
+  #include <windows.h>
+#else
+  #include <cerrno>
+  #include <cstdio>
+  #include <fcntl.h>
+  #include <sys/file.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace
+{
+
+// Nobody else holds the lock: bytes after the last '\0' are a record torn for good, ended so that nothing is merged into it
+bool end_torn(std::string& tail)
+{
+  if(tail.empty() || tail.back() == '\0') { return false; }
+  tail.push_back('\0');
+  return true;
+}
+
+#if defined(_WIN32)
+// Closes the handle (and so releases its lock) whatever happens
+class Handle
+{
+public:
+  explicit Handle(const HANDLE& handle) : m_handle(handle) {}
+  Handle(const Handle&)            = delete;
+  Handle(Handle&&)                 = delete;
+  Handle& operator=(const Handle&) = delete;
+  Handle& operator=(Handle&&)      = delete;
+  ~Handle()
+  {
+    if(m_handle != INVALID_HANDLE_VALUE) { CloseHandle(m_handle); }
+  }
+  HANDLE get() const { return m_handle; }
+  HANDLE release()
+  {
+    const HANDLE ret{m_handle};
+    m_handle = INVALID_HANDLE_VALUE;
+    return ret;
+  }
+
+private:
+  HANDLE m_handle{INVALID_HANDLE_VALUE};
+};
+
+// Shared with everything, deletion included, so that the file can be replaced while it is open
+HANDLE open_shared(const std::string& path, const DWORD& access, const DWORD& disposition) { return CreateFileW(Term::Private::to_wide(path).c_str(), access, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, disposition, FILE_ATTRIBUTE_NORMAL, nullptr); }
+
+Term::Private::FileId file_id(const HANDLE& handle)
+{
+  BY_HANDLE_FILE_INFORMATION information;
+  Term::Private::WindowsError().check_if(GetFileInformationByHandle(handle, &information) == FALSE).throw_exception("GetFileInformationByHandle() failed");
+  return {{static_cast<std::uint64_t>(information.dwVolumeSerialNumber), (static_cast<std::uint64_t>(information.nFileIndexHigh) << 32) | information.nFileIndexLow}};
+}
+
+std::string read_from(const HANDLE& handle, const std::size_t& offset)
+{
+  LARGE_INTEGER size;
+  Term::Private::WindowsError().check_if(GetFileSizeEx(handle, &size) == FALSE).throw_exception("GetFileSizeEx() failed");
+  if(static_cast<std::size_t>(size.QuadPart) <= offset) { return {}; }
+  std::string ret(static_cast<std::size_t>(size.QuadPart) - offset, '\0');
+  std::size_t done{0};
+  while(done != ret.size())
+  {
+    // The offset of a synchronous read is given by its OVERLAPPED
+    const std::uint64_t position{offset + done};
+    OVERLAPPED          overlapped{};
+    overlapped.Offset     = static_cast<DWORD>(position);
+    overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+    DWORD nread{0};
+    if(ReadFile(handle, &ret[done], static_cast<DWORD>(std::min<std::size_t>(ret.size() - done, MAXDWORD)), &nread, &overlapped) == FALSE && GetLastError() != ERROR_HANDLE_EOF) { Term::Private::WindowsError().check_if(true).throw_exception("ReadFile() failed"); }
+    if(nread == 0) { break; }
+    done += nread;
+  }
+  ret.resize(done);
+  return ret;
+}
+
+void write_all(const HANDLE& handle, const std::string& bytes, const std::string& path)
+{
+  std::size_t written{0};
+  while(written != bytes.size())
+  {
+    DWORD done{0};
+    Term::Private::WindowsError().check_if(WriteFile(handle, bytes.data() + written, static_cast<DWORD>(std::min<std::size_t>(bytes.size() - written, MAXDWORD)), &done, nullptr) == FALSE).throw_exception("WriteFile() failed for " + path);
+    written += done;
+  }
+}
+
+// Locks are mandatory on Windows: a byte far past the end of the file is locked, never the records, so readers are not blocked
+void lock(const HANDLE& handle, const std::string& path)
+{
+  OVERLAPPED overlapped{};
+  overlapped.Offset     = MAXDWORD;
+  overlapped.OffsetHigh = 0x7FFFFFFF;
+  Term::Private::WindowsError().check_if(LockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &overlapped) == FALSE).throw_exception("LockFileEx() failed for " + path);
+}
+
+// Open path (created if needed) and lock it, again if it was replaced while waiting for the lock: the lock of a replaced file protects nothing
+HANDLE open_locked(const std::string& path)
+{
+  while(true)
+  {
+    Handle file(open_shared(path, GENERIC_READ | FILE_APPEND_DATA, OPEN_ALWAYS));
+    Term::Private::WindowsError().check_if(file.get() == INVALID_HANDLE_VALUE).throw_exception("CreateFileW() failed for " + path);
+    lock(file.get(), path);
+    const Handle named(open_shared(path, FILE_READ_ATTRIBUTES, OPEN_EXISTING));
+    if(named.get() != INVALID_HANDLE_VALUE && file_id(named.get()) == file_id(file.get())) { return file.release(); }
+  }
+}
+#else
+// Closes the descriptor (and so releases its lock) whatever happens
+class Descriptor
+{
+public:
+  explicit Descriptor(const int& fd) : m_fd(fd) {}
+  Descriptor(const Descriptor&)            = delete;
+  Descriptor(Descriptor&&)                 = delete;
+  Descriptor& operator=(const Descriptor&) = delete;
+  Descriptor& operator=(Descriptor&&)      = delete;
+  ~Descriptor()
+  {
+    if(m_fd != -1) { ::close(m_fd); }
+  }
+  int get() const { return m_fd; }
+  int release()
+  {
+    const int ret{m_fd};
+    m_fd = -1;
+    return ret;
+  }
+
+private:
+  int m_fd{-1};
+};
+
+Term::Private::FileId file_id(const struct ::stat& status) { return {{static_cast<std::uint64_t>(status.st_dev), static_cast<std::uint64_t>(status.st_ino)}}; }
+
+struct ::stat file_status(const int& fd)
+{
+  struct ::stat status;
+  const int     ret{::fstat(fd, &status)};
+  Term::Private::Errno().check_if(ret == -1).throw_exception("fstat() failed");
+  return status;
+}
+
+Term::Private::FileId file_id(const int& fd) { return file_id(file_status(fd)); }
+
+// The bytes from offset to the end of the file, mapped instead of read: loading a large history is one copy
+std::string read_from(const int& fd, const std::size_t& offset)
+{
+  const std::size_t size{static_cast<std::size_t>(file_status(fd).st_size)};
+  if(size <= offset) { return {}; }
+  void* map{::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0)};
+  if(map != MAP_FAILED)
+  {
+    const std::string ret(static_cast<const char*>(map) + offset, size - offset);
+    ::munmap(map, size);
+    return ret;
+  }
+  std::string ret(size - offset, '\0');
+  std::size_t done{0};
+  while(done != ret.size())
+  {
+    const ::ssize_t nread{::pread(fd, &ret[done], ret.size() - done, static_cast<::off_t>(offset + done))};
+    if(nread == -1 && errno == EINTR) { continue; }
+    Term::Private::Errno().check_if(nread == -1).throw_exception("pread() failed");
+    if(nread == 0) { break; }
+    done += static_cast<std::size_t>(nread);
+  }
+  ret.resize(done);
+  return ret;
+}
+
+void write_all(const int& fd, const std::string& bytes, const std::string& path)
+{
+  std::size_t written{0};
+  while(written != bytes.size())
+  {
+    const ::ssize_t ret{::write(fd, bytes.data() + written, bytes.size() - written)};
+    if(ret == -1 && errno == EINTR) { continue; }
+    Term::Private::Errno().check_if(ret == -1).throw_exception("write() failed for " + path);
+    written += static_cast<std::size_t>(ret);
+  }
+}
+
+// Open path (created if needed) and lock it, again if it was replaced while waiting for the lock: the lock of a replaced file protects nothing
+int open_locked(const std::string& path)
+{
+  while(true)
+  {
+    const int fd{::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0600)};
+    Term::Private::Errno().check_if(fd == -1).throw_exception("open() failed for " + path);
+    Descriptor file(fd);
+    int        locked{-1};
+    do {
+      locked = ::flock(file.get(), LOCK_EX);
+    } while(locked == -1 && errno == EINTR);
+    Term::Private::Errno().check_if(locked == -1).throw_exception("flock() failed for " + path);
+    struct ::stat named;
+    if(::stat(path.c_str(), &named) == 0 && file_id(named) == file_id(file.get())) { return file.release(); }
+  }
+}
+#endif
+
+#if defined(_WIN32)
+using Locked = Handle;
+#else
+using Locked = Descriptor;
+#endif
+
+}  // namespace
+
+std::string Term::Private::read_file(const std::string& path, const std::size_t& offset, FileId& id)
+{
+#if defined(_WIN32)
+  const Handle file(open_shared(path, GENERIC_READ, OPEN_EXISTING));
+  if(file.get() == INVALID_HANDLE_VALUE && (GetLastError() == ERROR_FILE_NOT_FOUND || GetLastError() == ERROR_PATH_NOT_FOUND)) { return {}; }
+  Term::Private::WindowsError().check_if(file.get() == INVALID_HANDLE_VALUE).throw_exception("CreateFileW() failed for " + path);
+  const FileId current{file_id(file.get())};
+#else
+  const int fd{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+  if(fd == -1 && errno == ENOENT) { return {}; }
+  Term::Private::Errno().check_if(fd == -1).throw_exception("open() failed for " + path);
+  const Descriptor file(fd);
+  const FileId     current{file_id(file.get())};
+#endif
+  const std::size_t from{current == id ? offset : 0};
+  id = current;
+  return read_from(file.get(), from);
+}
+
+std::string Term::Private::append_file(const std::string& path, const std::size_t& offset, const std::string& record, FileId& id)
+{
+  const Locked file(open_locked(path));
+  const FileId current{file_id(file.get())};
+  std::string  ret{read_from(file.get(), current == id ? offset : 0)};
+  id = current;
+  std::string bytes{record};
+  if(end_torn(ret)) { bytes.insert(bytes.begin(), '\0'); }
+  write_all(file.get(), bytes, path);
+  return ret;  // the lock goes with the file
+}
+
+std::string Term::Private::replace_file(const std::string& path, const std::size_t& offset, const std::string& bytes, FileId& id)
+{
+  const Locked file(open_locked(path));
+  if(file_id(file.get()) != id) { return {}; }
+  std::string ret{read_from(file.get(), offset)};
+  end_torn(ret);
+  const std::string temporary{path + ".tmp"};
+  FileId            replaced{};
+#if defined(_WIN32)
+  {
+    const Handle replacement(open_shared(temporary, GENERIC_WRITE, CREATE_ALWAYS));
+    Term::Private::WindowsError().check_if(replacement.get() == INVALID_HANDLE_VALUE).throw_exception("CreateFileW() failed for " + temporary);
+    try
+    {
+      write_all(replacement.get(), bytes, temporary);
+      write_all(replacement.get(), ret, temporary);
+      Term::Private::WindowsError().check_if(FlushFileBuffers(replacement.get()) == FALSE).throw_exception("FlushFileBuffers() failed for " + temporary);
+      replaced = file_id(replacement.get());
+    }
+    catch(...)
+    {
+      DeleteFileW(Term::Private::to_wide(temporary).c_str());
+      throw;
+    }
+  }
+  if(MoveFileExW(Term::Private::to_wide(temporary).c_str(), Term::Private::to_wide(path).c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) == FALSE)
+  {
+    // Open somewhere without sharing its deletion: replaced another time
+    DeleteFileW(Term::Private::to_wide(temporary).c_str());
+    return {};
+  }
+#else
+  {
+    const int fd{::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600)};
+    Term::Private::Errno().check_if(fd == -1).throw_exception("open() failed for " + temporary);
+    const Descriptor replacement(fd);
+    try
+    {
+      write_all(replacement.get(), bytes, temporary);
+      write_all(replacement.get(), ret, temporary);
+      // On the disk before it replaces the file, a crash leaves one or the other
+      Term::Private::Errno().check_if(::fsync(replacement.get()) == -1).throw_exception("fsync() failed for " + temporary);
+      replaced = file_id(replacement.get());
+    }
+    catch(...)
+    {
+      ::unlink(temporary.c_str());
+      throw;
+    }
+  }
+  Term::Private::Errno error;
+  const int            renamed{::rename(temporary.c_str(), path.c_str())};
+  error.check_if(renamed == -1);
+  if(renamed == -1) { ::unlink(temporary.c_str()); }
+  error.throw_exception("rename() failed for " + path);
+#endif
+  id = replaced;
+  return ret;  // the processes waiting for the lock of the old file open the new one
+}
@@ -0,0 +1,56 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Term
+{
+
+namespace Private
+{
+
+///
+/// @brief The device and the index of a file : a file replacing another one at the same path (\b replace_file) has another one.
+///
+using FileId = std::array<std::uint64_t, 2>;
+
+///
+/// @brief The bytes of the file \b path from \b offset to its end, empty if the file does not exist. The file is memory mapped when the system allows it.
+///
+/// \b offset is in the file \b id . If the file at \b path is another one (it was replaced since), it is read from its start instead and \b id is set to it.
+///
+std::string read_file(const std::string& path, const std::size_t& offset, FileId& id);
+
+///
+/// @brief Append \b record to the file \b path (created if needed) while holding an exclusive lock on it, so records of concurrent processes never interleave.
+///
+/// Records end with '\0' and \b offset is the end of one, in the file \b id (read from the start of another one, as by \b read_file). Bytes after the last '\0' are a record torn by a writer that died :
+/// nobody else holds the lock, so a '\0' is written first to end it and \b record is not merged into it.
+///
+/// @return What was appended after \b offset by other processes, with the '\0' ending a torn record, read under the same lock before \b record is written.
+///
+std::string append_file(const std::string& path, const std::size_t& offset, const std::string& record, FileId& id);
+
+///
+/// @brief Replace the file \b path by \b bytes followed by what other processes appended after \b offset , under the same lock as \b append_file . The new file is written aside, then renamed over the old one.
+///
+/// Nothing is done if the file at \b path is no longer \b id , or (on Windows) if it is open somewhere without sharing its deletion. Otherwise \b id is set to the new file.
+///
+/// @return What was appended after \b offset by other processes, as by \b append_file , empty if nothing was done.
+///
+std::string replace_file(const std::string& path, const std::size_t& offset, const std::string& bytes, FileId& id);
+
+}  // namespace Private
+
+}  // namespace Term
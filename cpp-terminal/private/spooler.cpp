@@ -0,0 +1,94 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/private/spooler.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <vector>
+
+#if defined(_WIN32)
+  #include <io.h>
+  #include <windows.h>
+#else
+  #include <cerrno>
+  #include <poll.h>
+  #include <unistd.h>
+#endif
+
+namespace
+{
+
+const std::size_t block_size{64 * 1024};
+// How long the destructor can wait for the thread to notice it is stopped
+const int         timeout_ms{100};
+
+enum class Wait
+{
+  Ready,
+  Timeout,
+  End
+};
+
+// Wait at most timeout_ms for fd to have something to read (or to end)
+Wait wait_readable(const int& fd)
+{
+#if defined(_WIN32)
+  const HANDLE handle{reinterpret_cast<HANDLE>(::_get_osfhandle(fd))};
+  if(handle == INVALID_HANDLE_VALUE) { return Wait::End; }
+  // Only pipes can block forever, files end and there is no way to wait on a console without reading it
+  if(::GetFileType(handle) != FILE_TYPE_PIPE) { return Wait::Ready; }
+  DWORD available{0};
+  if(::PeekNamedPipe(handle, nullptr, 0, nullptr, &available, nullptr) == FALSE) { return Wait::End; }  // the writer closed it
+  if(available != 0) { return Wait::Ready; }
+  std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms / 4));
+  return Wait::Timeout;
+#else
+  ::pollfd descriptor{fd, POLLIN, 0};
+  const int ret{::poll(&descriptor, 1, timeout_ms)};
+  if(ret == 0 || (ret == -1 && errno == EINTR)) { return Wait::Timeout; }
+  if(ret == -1 || (descriptor.revents & POLLNVAL) != 0) { return Wait::End; }
+  return Wait::Ready;  // POLLHUP too: what is left is read, then the end
+#endif
+}
+
+}  // namespace
+
+Term::Private::Spooler::Spooler(const int& fd, const std::string& path) : m_fd(fd), m_path(path) { m_thread = std::thread(&Spooler::run, this); }
+
+Term::Private::Spooler::~Spooler()
+{
+  m_stop = true;
+  if(m_thread.joinable()) { m_thread.join(); }
+}
+
+bool Term::Private::Spooler::done() const { return m_done; }
+
+void Term::Private::Spooler::run()
+{
+  std::ofstream     out(m_path, std::ios::binary | std::ios::app);
+  std::vector<char> buffer(block_size);
+  while(!m_stop && out)
+  {
+    const Wait wait{wait_readable(m_fd)};
+    if(wait == Wait::Timeout) { continue; }
+    if(wait == Wait::End) { break; }
+#if defined(_WIN32)
+    const int nread{::_read(m_fd, buffer.data(), static_cast<unsigned int>(buffer.size()))};
+#else
+    const ::ssize_t nread{::read(m_fd, buffer.data(), buffer.size())};
+    if(nread == -1 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK)) { continue; }
+#endif
+    if(nread <= 0) { break; }
+    out.write(buffer.data(), static_cast<std::streamsize>(nread));
+    out.flush();
+  }
+  m_done = true;
+}
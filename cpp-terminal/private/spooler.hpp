@@ -0,0 +1,57 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace Term
+{
+
+namespace Private
+{
+
+///
+/// @brief Copies what is read from a descriptor to the end of a file, in the background, until the descriptor ends or the spooler is destroyed.
+///
+/// The descriptor is waited on with a timeout, never read while it has nothing to give : the destructor returns within that timeout even if the writer keeps the descriptor open.
+/// The file is flushed after each read.
+///
+class Spooler
+{
+public:
+  ///
+  /// @brief Start copying what is read from \b fd to the end of the file at \b path . \b fd is not closed.
+  ///
+  Spooler(const int& fd, const std::string& path);
+  ~Spooler();
+  Spooler(const Spooler&)            = delete;
+  Spooler(Spooler&&)                 = delete;
+  Spooler& operator=(const Spooler&) = delete;
+  Spooler& operator=(Spooler&&)      = delete;
+
+  ///
+  /// @brief Whether the descriptor ended (or failed) and everything read from it is in the file.
+  ///
+  bool done() const;
+
+private:
+  void              run();
+  int               m_fd{-1};
+  std::string       m_path;
+  std::atomic<bool> m_stop{false};
+  std::atomic<bool> m_done{false};
+  std::thread       m_thread;
+};
+
+}  // namespace Private
+
+}  // namespace Term
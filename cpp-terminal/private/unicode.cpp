@@ -13,6 +13,8 @@
 #include "cpp-terminal/private/exception.hpp"
 
 #include <array>
+#include <atomic>
+#include <cstring>
 #include <limits>
 #include <string>
 
@@ -21,6 +23,289 @@
   #include <windows.h>
 #endif
 
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__)) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define CPPTERMINAL_UTF8_SSE2
+  #include <emmintrin.h>
+  #if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5) || defined(_MSC_VER)
+    #define CPPTERMINAL_UTF8_AVX2
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+      #include <intrin.h>
+    #endif
+  #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  #define CPPTERMINAL_UTF8_NEON
+  #include <arm_neon.h>
+#endif
+
+#if defined(CPPTERMINAL_UTF8_AVX2) && !defined(_MSC_VER)
+  #define CPPTERMINAL_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+  #define CPPTERMINAL_TARGET_AVX2
+#endif
+
+namespace
+{
+
+// The ASCII kernels check and widen the leading ASCII bytes of in[0,size) and return how many there are.
+// When write is true, out must have room for size code points: a whole block is widened before its first non-ASCII byte is known, the code points after it are overwritten by the caller.
+
+template<bool write> std::size_t ascii_scalar(const std::uint8_t* in, const std::size_t& size, char32_t* out) noexcept
+{
+  static const constexpr std::uint64_t high_bits{0x8080808080808080ULL};
+  std::uint64_t                        word{0};
+  std::size_t                          done{0};
+  for(; size - done >= sizeof(word); done += sizeof(word))
+  {
+    std::memcpy(&word, in + done, sizeof(word));
+    if((word & high_bits) != 0) { break; }
+    if(write)
+    {
+      for(std::size_t i = 0; i != sizeof(word); ++i) { out[done + i] = in[done + i]; }
+    }
+  }
+  for(; done != size && in[done] < 0x80; ++done)
+  {
+    if(write) { out[done] = in[done]; }
+  }
+  return done;
+}
+
+#if defined(CPPTERMINAL_UTF8_SSE2) || defined(CPPTERMINAL_UTF8_AVX2)
+std::size_t count_trailing_zeros(const std::uint32_t& mask) noexcept
+{
+  #if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index{0};
+  _BitScanForward(&index, mask);
+  return index;
+  #else
+  return static_cast<std::size_t>(__builtin_ctz(mask));
+  #endif
+}
+#endif
+
+#if defined(CPPTERMINAL_UTF8_SSE2)
+template<bool write> std::size_t ascii_sse2(const std::uint8_t* in, const std::size_t& size, char32_t* out) noexcept
+{
+  static const constexpr std::size_t block{16};
+  const __m128i                      zero{_mm_setzero_si128()};
+  std::size_t                        done{0};
+  for(; size - done >= block; done += block)
+  {
+    const __m128i       bytes{_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + done))};
+    const std::uint32_t mask{static_cast<std::uint32_t>(_mm_movemask_epi8(bytes))};
+    if(write)
+    {
+      const __m128i low{_mm_unpacklo_epi8(bytes, zero)};
+      const __m128i high{_mm_unpackhi_epi8(bytes, zero)};
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + done), _mm_unpacklo_epi16(low, zero));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + done + 4), _mm_unpackhi_epi16(low, zero));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + done + 8), _mm_unpacklo_epi16(high, zero));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + done + 12), _mm_unpackhi_epi16(high, zero));
+    }
+    if(mask != 0) { return done + count_trailing_zeros(mask); }
+  }
+  return done + ascii_scalar<write>(in + done, size - done, out + done);
+}
+#endif
+
+#if defined(CPPTERMINAL_UTF8_AVX2)
+template<bool write> CPPTERMINAL_TARGET_AVX2 std::size_t ascii_avx2(const std::uint8_t* in, const std::size_t& size, char32_t* out) noexcept
+{
+  static const constexpr std::size_t block{32};
+  std::size_t                        done{0};
+  for(; size - done >= block; done += block)
+  {
+    const __m256i       bytes{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + done))};
+    const std::uint32_t mask{static_cast<std::uint32_t>(_mm256_movemask_epi8(bytes))};
+    if(write)
+    {
+      for(std::size_t i = 0; i != block; i += 8) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + done + i), _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + done + i)))); }
+    }
+    if(mask != 0) { return done + count_trailing_zeros(mask); }
+  }
+  return done + ascii_sse2<write>(in + done, size - done, out + done);
+}
+
+bool has_avx2() noexcept
+{
+  #if defined(_MSC_VER) && !defined(__clang__)
+  std::array<int, 4> info{};
+  __cpuid(info.data(), 0);
+  if(info[0] < 7) { return false; }
+  __cpuid(info.data(), 1);
+  // OSXSAVE and AVX, then the OS must save the YMM registers
+  if((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 6) != 6) { return false; }
+  __cpuidex(info.data(), 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+  #else
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") != 0;
+  #endif
+}
+#endif
+
+#if defined(CPPTERMINAL_UTF8_NEON)
+template<bool write> std::size_t ascii_neon(const std::uint8_t* in, const std::size_t& size, char32_t* out) noexcept
+{
+  static const constexpr std::size_t block{16};
+  std::size_t                        done{0};
+  for(; size - done >= block; done += block)
+  {
+    const uint8x16_t bytes{vld1q_u8(in + done)};
+    if(vmaxvq_u8(bytes) >= 0x80) { break; }
+    if(write)
+    {
+      const uint16x8_t low{vmovl_u8(vget_low_u8(bytes))};
+      const uint16x8_t high{vmovl_u8(vget_high_u8(bytes))};
+      vst1q_u32(reinterpret_cast<std::uint32_t*>(out + done), vmovl_u16(vget_low_u16(low)));
+      vst1q_u32(reinterpret_cast<std::uint32_t*>(out + done + 4), vmovl_u16(vget_high_u16(low)));
+      vst1q_u32(reinterpret_cast<std::uint32_t*>(out + done + 8), vmovl_u16(vget_low_u16(high)));
+      vst1q_u32(reinterpret_cast<std::uint32_t*>(out + done + 12), vmovl_u16(vget_high_u16(high)));
+    }
+  }
+  return done + ascii_scalar<write>(in + done, size - done, out + done);
+}
+#endif
+
+struct Kernel
+{
+  Term::Private::Utf8Kernel kernel;
+  std::size_t (*widen)(const std::uint8_t*, const std::size_t&, char32_t*);
+  std::size_t (*count)(const std::uint8_t*, const std::size_t&, char32_t*);
+};
+
+const Kernel scalar_kernel{Term::Private::Utf8Kernel::Scalar, &ascii_scalar<true>, &ascii_scalar<false>};
+#if defined(CPPTERMINAL_UTF8_SSE2)
+const Kernel sse2_kernel{Term::Private::Utf8Kernel::Sse2, &ascii_sse2<true>, &ascii_sse2<false>};
+#endif
+#if defined(CPPTERMINAL_UTF8_AVX2)
+const Kernel avx2_kernel{Term::Private::Utf8Kernel::Avx2, &ascii_avx2<true>, &ascii_avx2<false>};
+#endif
+#if defined(CPPTERMINAL_UTF8_NEON)
+const Kernel neon_kernel{Term::Private::Utf8Kernel::Neon, &ascii_neon<true>, &ascii_neon<false>};
+#endif
+
+const Kernel* find_kernel(const Term::Private::Utf8Kernel& kernel) noexcept
+{
+  switch(kernel)
+  {
+    case Term::Private::Utf8Kernel::Scalar: return &scalar_kernel;
+#if defined(CPPTERMINAL_UTF8_SSE2)
+    case Term::Private::Utf8Kernel::Sse2: return &sse2_kernel;
+#endif
+#if defined(CPPTERMINAL_UTF8_AVX2)
+    case Term::Private::Utf8Kernel::Avx2: return has_avx2() ? &avx2_kernel : nullptr;
+#endif
+#if defined(CPPTERMINAL_UTF8_NEON)
+    case Term::Private::Utf8Kernel::Neon: return &neon_kernel;
+#endif
+    default: return nullptr;
+  }
+}
+
+const Kernel* detect_kernel() noexcept
+{
+  const std::array<Term::Private::Utf8Kernel, 3> preferred{Term::Private::Utf8Kernel::Avx2, Term::Private::Utf8Kernel::Sse2, Term::Private::Utf8Kernel::Neon};
+  for(std::size_t i = 0; i != preferred.size(); ++i)
+  {
+    const Kernel* kernel{find_kernel(preferred[i])};
+    if(kernel != nullptr) { return kernel; }
+  }
+  return &scalar_kernel;
+}
+
+std::atomic<const Kernel*>& current_kernel() noexcept
+{
+  static std::atomic<const Kernel*> kernel{detect_kernel()};
+  return kernel;
+}
+
+// Decode the sequence starting with the non-ASCII byte in[0] and return its size. An ill-formed sequence (overlong form, surrogate, value above 0x10FFFF, bad or missing continuation byte)
+// gives U+FFFD and the size of its maximal subpart, so the decoding resumes on the first byte that can not belong to it (Unicode 3.9, "U+FFFD Substitution of Maximal Subparts").
+std::size_t decode_sequence(const std::uint8_t* in, const std::size_t& size, char32_t& codepoint, bool& valid) noexcept
+{
+  static const constexpr char32_t replacement{U'\U0000FFFD'};
+  const std::uint8_t              lead{in[0]};
+  std::size_t                     length{0};
+  std::uint8_t                    lower{0x80};
+  std::uint8_t                    upper{0xBF};
+  valid = false;
+  if(lead < 0xC2 || lead > 0xF4)
+  {
+    codepoint = replacement;
+    return 1;
+  }
+  if(lead < 0xE0)
+  {
+    length    = 2;
+    codepoint = lead & 0x1FU;
+  }
+  else if(lead < 0xF0)
+  {
+    length    = 3;
+    codepoint = lead & 0x0FU;
+    if(lead == 0xE0) { lower = 0xA0; }       // Overlong
+    else if(lead == 0xED) { upper = 0x9F; }  // Surrogates
+  }
+  else
+  {
+    length    = 4;
+    codepoint = lead & 0x07U;
+    if(lead == 0xF0) { lower = 0x90; }       // Overlong
+    else if(lead == 0xF4) { upper = 0x8F; }  // Above 0x10FFFF
+  }
+  for(std::size_t byte = 1; byte != length; ++byte)
+  {
+    if(byte == size || in[byte] < lower || in[byte] > upper)
+    {
+      codepoint = replacement;
+      return byte;
+    }
+    codepoint = (codepoint << 6U) | (in[byte] & 0x3FU);
+    lower     = 0x80;
+    upper     = 0xBF;
+  }
+  valid = true;
+  return length;
+}
+
+// Decode in[0,size) to out, which must have room for size code points, and return the end of the code points written
+char32_t* decode_utf8(const std::uint8_t* in, const std::size_t& size, char32_t* out, const bool& exception)
+{
+  const Kernel& kernel{*current_kernel().load(std::memory_order_relaxed)};
+  for(std::size_t byte = 0; byte != size;)
+  {
+    const std::size_t ascii{kernel.widen(in + byte, size - byte, out)};
+    byte += ascii;
+    out += ascii;
+    for(bool valid{true}; byte != size && in[byte] >= 0x80; ++out)
+    {
+      byte += decode_sequence(in + byte, size - byte, *out, valid);
+      if(!valid && exception) { throw Term::Exception("Bad UTF-8 sequence."); }
+    }
+  }
+  return out;
+}
+
+// Size of the sequence at the end of in[0,size) that is well-formed so far but misses bytes (0 if there is none). Only the last 3 bytes are looked at.
+std::size_t unfinished_size(const std::uint8_t* in, const std::size_t& size) noexcept
+{
+  for(std::size_t back = 1; back <= 3 && back <= size; ++back)
+  {
+    const std::uint8_t byte{in[size - back]};
+    if(byte >= 0x80 && byte < 0xC0) { continue; }  // Continuation byte, look further back
+    if(byte < 0xC2 || byte > 0xF4 || Term::Private::utf8_codepoint_size(byte) <= back) { return 0; }
+    char32_t    codepoint{0};
+    bool        valid{false};
+    // The prefix is well-formed if the decoder stops because the input is exhausted
+    return decode_sequence(in + size - back, back, codepoint, valid) == back ? back : 0;
+  }
+  return 0;
+}
+
+}  // namespace
+
 #if defined(_WIN32)
 std::string Term::Private::to_narrow(const std::wstring& in)
 {
@@ -51,30 +336,97 @@ std::wstring Term::Private::to_wide(const std::string& in)
 }
 #endif
 
+std::size_t Term::Private::utf8_size(const char32_t& codepoint) noexcept
+{
+  if(codepoint < 0x80) { return 1; }
+  if(codepoint < 0x800) { return 2; }
+  if(codepoint < 0x10000) { return 3; }
+  if(codepoint <= 0x10FFFF) { return 4; }
+  return 3;  // "replacement character"
+}
+
+std::size_t Term::Private::utf8_size(const char32_t* codepoints, const std::size_t& size) noexcept
+{
+  std::size_t ret{size};
+  for(std::size_t i = 0; i != size; ++i)
+  {
+    if(codepoints[i] >= 0x80) { ret += utf8_size(codepoints[i]) - 1; }
+  }
+  return ret;
+}
+
+std::size_t Term::Private::encode_utf8(const char32_t& codepoint, char* out, const bool& exception)
+{
+  static const constexpr std::uint8_t continuation{0x80};
+  static const constexpr std::uint8_t payload{0x3F};
+  if(codepoint < 0x80)  // Plain ASCII
+  {
+    out[0] = static_cast<char>(codepoint);
+    return 1;
+  }
+  if(codepoint < 0x800)
+  {
+    out[0] = static_cast<char>(0xC0 | (codepoint >> 6));
+    out[1] = static_cast<char>(continuation | (codepoint & payload));
+    return 2;
+  }
+  if(codepoint < 0x10000)
+  {
+    out[0] = static_cast<char>(0xE0 | (codepoint >> 12));
+    out[1] = static_cast<char>(continuation | ((codepoint >> 6) & payload));
+    out[2] = static_cast<char>(continuation | (codepoint & payload));
+    return 3;
+  }
+  if(codepoint <= 0x10FFFF)
+  {
+    out[0] = static_cast<char>(0xF0 | (codepoint >> 18));
+    out[1] = static_cast<char>(continuation | ((codepoint >> 12) & payload));
+    out[2] = static_cast<char>(continuation | ((codepoint >> 6) & payload));
+    out[3] = static_cast<char>(continuation | (codepoint & payload));
+    return 4;
+  }
+  if(exception) { throw Term::Exception("Invalid UTF32 codepoint."); }
+  return encode_utf8(U'\U0000FFFD', out);
+}
+
+void Term::Private::append_utf8(std::string& out, const char32_t& codepoint, const bool& exception)
+{
+  std::array<char, 4> buffer{};
+  out.append(buffer.data(), encode_utf8(codepoint, buffer.data(), exception));
+}
+
+void Term::Private::append_utf8(std::string& out, const char32_t* codepoints, const std::size_t& size, const bool& exception)
+{
+  if(size == 0) { return; }
+  const std::size_t start{out.size()};
+  out.resize(start + utf8_size(codepoints, size));
+  char* write{&out[start]};
+  try
+  {
+    for(std::size_t i = 0; i != size; ++i)
+    {
+      if(codepoints[i] < 0x80) { *write++ = static_cast<char>(codepoints[i]); }
+      else { write += encode_utf8(codepoints[i], write, exception); }
+    }
+  }
+  catch(...)
+  {
+    out.resize(start);
+    throw;
+  }
+}
+
 std::string Term::Private::utf32_to_utf8(const char32_t& codepoint, const bool& exception)
 {
-  static const constexpr std::array<std::uint32_t, 4> size{0x7F, 0x07FF, 0xFFFF, 0x10FFFF};
-  static const constexpr std::uint8_t                 mask{0x80};
-  static const constexpr std::uint8_t                 add{0x3F};
-  static const constexpr std::array<std::uint8_t, 3>  mask_first{0x1F, 0x0F, 0x07};
-  static const constexpr std::array<std::uint8_t, 3>  add_first{0xC0, 0xE0, 0xF0};
-  static const constexpr std::array<std::uint8_t, 4>  shift{0, 6, 12, 18};
-  static const constexpr std::uint8_t                 max_size{4};
-  std::string                                         ret;
-  ret.reserve(max_size);
-  if(codepoint <= size[0]) { ret = {static_cast<char>(codepoint)}; }  // Plain ASCII
-  else if(codepoint <= size[1]) { ret = {static_cast<char>(((codepoint >> shift[1]) & mask_first[0]) | add_first[0]), static_cast<char>(((codepoint >> shift[0]) & add) | mask)}; }
-  else if(codepoint <= size[2]) { ret = {static_cast<char>(((codepoint >> shift[2]) & mask_first[1]) | add_first[1]), static_cast<char>(((codepoint >> shift[1]) & add) | mask), static_cast<char>(((codepoint >> shift[0]) & add) | mask)}; }
-  else if(codepoint <= size[3]) { ret = {static_cast<char>(((codepoint >> shift[3]) & mask_first[2]) | add_first[2]), static_cast<char>(((codepoint >> shift[2]) & add) | mask), static_cast<char>(((codepoint >> shift[1]) & add) | mask), static_cast<char>(((codepoint >> shift[0]) & add) | mask)}; }
-  else if(exception) { throw Term::Exception("Invalid UTF32 codepoint."); }
-  else { ret = "\xEF\xBF\xBD"; }
+  std::string ret;
+  append_utf8(ret, codepoint, exception);
   return ret;
 }
 
 std::string Term::Private::utf32_to_utf8(const std::u32string& str, const bool& exception)
 {
   std::string ret;
-  for(const char32_t codepoint: str) { ret.append(utf32_to_utf8(codepoint, exception)); }
+  append_utf8(ret, str.data(), str.size(), exception);
   return ret;
 }
 
@@ -106,55 +458,22 @@ std::size_t Term::Private::utf8_codepoint_size(const std::uint8_t& str) noexcept
   return 0;
 }
 
+Term::Private::Utf8Kernel Term::Private::utf8_kernel() noexcept { return current_kernel().load(std::memory_order_relaxed)->kernel; }
+
+bool Term::Private::set_utf8_kernel(const Utf8Kernel& kernel) noexcept
+{
+  const Kernel* found{find_kernel(kernel)};
+  if(found == nullptr) { return false; }
+  current_kernel().store(found, std::memory_order_relaxed);
+  return true;
+}
+
 std::u32string Term::Private::utf8_to_utf32(const std::string& str, const bool& exception)
 {
-  static const constexpr std::array<std::uint8_t, 5> mask{63, 127, 31, 15, 7};
-  static const constexpr std::array<std::uint8_t, 4> shift{0U, 6U, 12U, 18U};
   if(str.empty()) { return {}; }
-  std::u32string ret;
-  for(std::size_t byte = 0; byte < str.size();)
-  {
-    bool        error{false};
-    std::size_t byte_count{utf8_codepoint_size(static_cast<std::uint8_t>(str[byte]))};
-    switch(byte_count)
-    {
-      case 1:
-      {
-        if(is_valid_utf8(str.begin() + byte, str.begin() + byte + 1)) { ret.push_back(static_cast<std::uint8_t>(str[byte] & mask[1]) << shift[0]); }
-        else { error = true; }
-        break;
-      }
-      case 2:
-      {
-        if(is_valid_utf8(str.begin() + byte, str.begin() + byte + 2)) { ret.push_back((static_cast<std::uint8_t>(str[byte] & mask[2]) << shift[1]) | (static_cast<std::uint8_t>(str[byte + 1] & mask[0]) << shift[0])); }
-        else { error = true; }
-        break;
-      }
-      case 3:
-      {
-        if(is_valid_utf8(str.begin() + byte, str.begin() + byte + 3)) { ret.push_back((static_cast<std::uint8_t>(str[byte] & mask[3]) << shift[2]) | (static_cast<std::uint8_t>(str[byte + 1] & mask[0]) << shift[1]) | (static_cast<std::uint8_t>(str[byte + 2] & mask[0]) << shift[0])); }
-        else { error = true; }
-        break;
-      }
-      case 4:
-      {
-        if(is_valid_utf8(str.begin() + byte, str.begin() + byte + 4)) { ret.push_back((static_cast<std::uint8_t>(str[byte] & mask[4]) << shift[3]) | (static_cast<std::uint8_t>(str[byte + 1] & mask[0]) << shift[2]) | (static_cast<std::uint8_t>(str[byte + 2] & mask[0]) << shift[1]) | (static_cast<std::uint8_t>(str[byte + 3] & mask[0]) << shift[0])); }
-        else { error = true; }
-        break;
-      }
-      default:
-      {
-        ++byte;
-        error = true;
-      }
-    }
-    if(error)
-    {
-      if(exception) { throw Term::Exception("Bad UTF-8 sequence."); }
-      ret.push_back(U'\U0000FFFD');
-    }
-    byte += byte_count;
-  }
+  // A byte gives at most one code point: allocate once and shrink to what was decoded.
+  std::u32string ret(str.size(), U'\0');
+  ret.resize(static_cast<std::size_t>(decode_utf8(reinterpret_cast<const std::uint8_t*>(str.data()), str.size(), &ret[0], exception) - &ret[0]));
   return ret;
 }
 
@@ -162,41 +481,74 @@ bool Term::Private::is_valid_utf8_code_unit(const std::string& str) { return utf
 
 bool Term::Private::is_valid_utf8(const std::string::const_iterator& begin, const std::string::const_iterator& end)
 {
-  static const constexpr std::uint8_t b1OOOOOOO{128};
-  static const constexpr std::uint8_t b11OOOOOO{192};
-  static const constexpr std::uint8_t b111OOOOO{224};
-  static const constexpr std::uint8_t b1111OOOO{240};
-  static const constexpr std::uint8_t b11111OOO{248};
   if(begin > end) { return false; }
-  for(std::string::const_iterator it = begin; it != end;)
+  if(begin == end) { return true; }
+  const Kernel&       kernel{*current_kernel().load(std::memory_order_relaxed)};
+  const std::uint8_t* in{reinterpret_cast<const std::uint8_t*>(&*begin)};
+  const std::size_t   size{static_cast<std::size_t>(end - begin)};
+  for(std::size_t byte = 0; byte != size;)
   {
-    std::size_t byte_count{utf8_codepoint_size(*it)};
-    if(it + byte_count > end) { return false; }
-    switch(byte_count)
+    byte += kernel.count(in + byte, size - byte, nullptr);
+    while(byte != size && in[byte] >= 0x80)
     {
-      case 1:
-      {
-        if((static_cast<std::uint8_t>(*it) & b1OOOOOOO) != 0) return false;
-        break;
-      }
-      case 2:
-      {
-        if(((static_cast<std::uint8_t>(*it) & b111OOOOO) != b11OOOOOO) || ((static_cast<std::uint8_t>(*(it + 1)) & b11OOOOOO) != b1OOOOOOO)) return false;
-        break;
-      }
-      case 3:
-      {
-        if(((static_cast<std::uint8_t>(*it) & b1111OOOO) != b111OOOOO) || ((static_cast<std::uint8_t>(*(it + 1)) & b11OOOOOO) != b1OOOOOOO) || ((static_cast<std::uint8_t>(*(it + 2)) & b11OOOOOO) != b1OOOOOOO)) return false;
-        break;
-      }
-      case 4:
-      {
-        if(((static_cast<std::uint8_t>(*it) & b11111OOO) != b1111OOOO) || ((static_cast<std::uint8_t>(*(it + 1)) & b11OOOOOO) != b1OOOOOOO) || ((static_cast<std::uint8_t>(*(it + 2)) & b11OOOOOO) != b1OOOOOOO) || ((static_cast<std::uint8_t>(*(it + 3)) & b11OOOOOO) != b1OOOOOOO)) return false;
-        break;
-      }
-      default: return false;
+      char32_t codepoint{0};
+      bool     valid{false};
+      byte += decode_sequence(in + byte, size - byte, codepoint, valid);
+      if(!valid) { return false; }
     }
-    it += byte_count;
   }
   return true;
 }
+
+std::string Term::Private::Utf8Decoder::complete(const std::string& bytes)
+{
+  std::string ret(reinterpret_cast<const char*>(m_pending.data()), m_size);
+  ret.append(bytes);
+  m_size = 0;
+  const std::size_t unfinished{unfinished_size(reinterpret_cast<const std::uint8_t*>(ret.data()), ret.size())};
+  keep(ret.data() + ret.size() - unfinished, unfinished);
+  ret.resize(ret.size() - unfinished);
+  return ret;
+}
+
+void Term::Private::Utf8Decoder::decode(const char* data, const std::size_t& size, std::u32string& out)
+{
+  const std::uint8_t* in{reinterpret_cast<const std::uint8_t*>(data)};
+  std::size_t         used{0};
+  if(m_size != 0)
+  {
+    // Finish the kept sequence with the continuation bytes at the start of data
+    std::array<std::uint8_t, 4> head{};
+    std::size_t                 head_size{m_size};
+    const std::size_t           length{utf8_codepoint_size(m_pending[0])};
+    for(std::size_t i = 0; i != m_size; ++i) { head[i] = m_pending[i]; }
+    while(head_size != length && used != size && in[used] >= 0x80 && in[used] < 0xC0) { head[head_size++] = in[used++]; }
+    if(head_size != length && used == size)
+    {
+      keep(reinterpret_cast<const char*>(head.data()), head_size);
+      return;
+    }
+    m_size = 0;
+    const std::size_t start{out.size()};
+    out.resize(start + head_size);
+    out.resize(static_cast<std::size_t>(decode_utf8(head.data(), head_size, &out[start], false) - &out[0]));
+  }
+  const std::size_t unfinished{unfinished_size(in + used, size - used)};
+  if(size - used != unfinished)
+  {
+    const std::size_t start{out.size()};
+    out.resize(start + size - used - unfinished);
+    out.resize(static_cast<std::size_t>(decode_utf8(in + used, size - used - unfinished, &out[start], false) - &out[0]));
+  }
+  keep(data + size - unfinished, unfinished);
+}
+
+bool Term::Private::Utf8Decoder::pending() const noexcept { return m_size != 0; }
+
+void Term::Private::Utf8Decoder::reset() noexcept { m_size = 0; }
+
+void Term::Private::Utf8Decoder::keep(const char* data, const std::size_t& size) noexcept
+{
+  for(std::size_t i = 0; i != size; ++i) { m_pending[i] = static_cast<std::uint8_t>(data[i]); }
+  m_size = size;
+}
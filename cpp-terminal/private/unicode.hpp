@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -65,6 +66,39 @@ std::string utf32_to_utf8(const char32_t& codepoint, const bool& exception = fal
 ///
 std::string utf32_to_utf8(const std::u32string& str, const bool& exception = false);
 
+///
+///@brief Number of bytes of the UTF-8 encoding of \b codepoint (the size of "replacement character" \b � if it is out of range).
+///@warning Internal use only.
+///
+std::size_t utf8_size(const char32_t& codepoint) noexcept;
+
+///
+///@brief Number of bytes of the UTF-8 encoding of \b size code points.
+///@warning Internal use only.
+///
+std::size_t utf8_size(const char32_t* codepoints, const std::size_t& size) noexcept;
+
+///
+///@brief Encode \b codepoint in UTF-8 to \b out , which must have room for 4 bytes.
+///
+///@param exception If \b true throw exception on error, otherwise write "replacement character" \b � .
+///@return The number of bytes written.
+///@warning Internal use only.
+///
+std::size_t encode_utf8(const char32_t& codepoint, char* out, const bool& exception = false);
+
+///
+///@brief Append \b codepoint encoded in UTF-8 to \b out .
+///@warning Internal use only.
+///
+void append_utf8(std::string& out, const char32_t& codepoint, const bool& exception = false);
+
+///
+///@brief Append \b size code points encoded in UTF-8 to \b out , growing it once to the exact size.
+///@warning Internal use only.
+///
+void append_utf8(std::string& out, const char32_t* codepoints, const std::size_t& size, const bool& exception = false);
+
 ///
 ///@brief Encode a UTF-8 \b char to \b std::u32string .
 ///
@@ -81,6 +115,7 @@ std::u32string utf8_to_utf32(const char& character, const bool& exception = fals
 ///@param str The UTF-8 \b std::string to convert.
 ///@param exception If \b true throw exception on error, otherwise change the \b char not into UTF-8 sequence to "replacement character" \b � .
 ///@return \b std::u32string the UTF-32 string.
+///@note Overlong forms, surrogates and values above 0x10FFFF are errors. Each maximal subpart of an ill-formed sequence is replaced by one \b � .
 ///@warning Internal use only.
 ///
 std::u32string utf8_to_utf32(const std::string& str, const bool& exception = false);
@@ -106,6 +141,32 @@ bool is_valid_utf8_code_unit(const std::string& str);
 ///
 bool is_valid_utf8(const std::string::const_iterator& begin, const std::string::const_iterator& end);
 
+///
+///@brief Implementation of the ASCII fast path of \b utf8_to_utf32 and \b is_valid_utf8 .
+///@warning Internal use only.
+///
+enum class Utf8Kernel : std::uint8_t
+{
+  Scalar,  ///< 8 bytes per step in a 64 bits word.
+  Sse2,    ///< 16 bytes per step.
+  Avx2,    ///< 32 bytes per step.
+  Neon,    ///< 16 bytes per step.
+};
+
+///
+///@brief The kernel in use: the fastest one supported by the CPU, chosen at the first call.
+///@warning Internal use only.
+///
+Utf8Kernel utf8_kernel() noexcept;
+
+///
+///@brief Use \b kernel instead of the one detected (for tests and benchmarks).
+///
+///@return false if \b kernel is not compiled in or not supported by the CPU, the kernel in use is unchanged.
+///@warning Internal use only.
+///
+bool set_utf8_kernel(const Utf8Kernel& kernel) noexcept;
+
 ///
 ///@brief The size of the UTF-8 codepoint.
 ///
@@ -116,5 +177,40 @@ bool is_valid_utf8(const std::string::const_iterator& begin, const std::string::
 ///
 std::size_t utf8_codepoint_size(const std::uint8_t& begin) noexcept;
 
+///
+///@brief Resumable UTF-8 decoder: a sequence cut between two reads is kept (at most 3 bytes) and finished by the next one.
+///@warning Internal use only.
+///
+class Utf8Decoder
+{
+public:
+  ///
+  ///@brief Prepend the bytes kept from the previous call to \b bytes and keep back an unfinished sequence at its end.
+  ///
+  ///@return The bytes up to the last complete sequence. Ill-formed sequences are returned as they are.
+  ///
+  std::string complete(const std::string& bytes);
+
+  ///
+  ///@brief Decode \b size bytes of \b data and append the code points to \b out (like \b utf8_to_utf32 ), an unfinished sequence at the end is kept for the next call.
+  ///
+  void decode(const char* data, const std::size_t& size, std::u32string& out);
+
+  ///
+  ///@brief A sequence is waiting for its next bytes.
+  ///
+  bool pending() const noexcept;
+
+  ///
+  ///@brief Drop the unfinished sequence.
+  ///
+  void reset() noexcept;
+
+private:
+  void                        keep(const char* data, const std::size_t& size) noexcept;
+  std::array<std::uint8_t, 3> m_pending{};
+  std::size_t                 m_size{0};
+};
+
 }  // namespace Private
 }  // namespace Term
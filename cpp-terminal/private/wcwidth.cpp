@@ -0,0 +1,47 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/private/wcwidth.hpp"
+
+#include "cpp-terminal/private/unicode.hpp"
+#include "cpp-terminal/private/wcwidth_table.hpp"
+
+namespace
+{
+
+// 2 bits per code point: 0 zero width, 1 narrow, 2 wide, 3 non printable
+constexpr std::uint8_t lookup(const std::uint32_t& codepoint) { return (Term::Private::WcWidth::stage2[Term::Private::WcWidth::stage1[codepoint / Term::Private::WcWidth::block_size] * (Term::Private::WcWidth::block_size / 4) + (codepoint % Term::Private::WcWidth::block_size) / 4] >> (2 * (codepoint % 4))) & 3U; }
+
+static_assert(lookup(U'a') == 1, "ASCII is narrow");
+static_assert(lookup(U'\u0301') == 0, "Combining marks have no width");
+static_assert(lookup(U'你') == 2, "CJK ideographs are wide");
+static_assert(lookup(U'\U0001F600') == 2, "Emoji are wide");
+static_assert(lookup(U'\u001B') == 3, "Controls are not printable");
+
+}  // namespace
+
+int Term::Private::wcwidth(const char32_t& codepoint) noexcept
+{
+  if(codepoint > 0x10FFFF) { return 1; }  // Displayed as "replacement character"
+  const std::uint8_t width{lookup(codepoint)};
+  return width == 3 ? -1 : width;
+}
+
+std::size_t Term::Private::wcswidth(const std::u32string& str) noexcept
+{
+  std::size_t ret{0};
+  for(const char32_t codepoint: str)
+  {
+    const int width{wcwidth(codepoint)};
+    if(width > 0) { ret += static_cast<std::size_t>(width); }
+  }
+  return ret;
+}
+
+std::size_t Term::Private::wcswidth(const std::string& str) { return wcswidth(utf8_to_utf32(str)); }
@@ -0,0 +1,48 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+///
+///@file wcwidth.hpp
+///@brief Number of terminal columns taken by the characters.
+///@warning Internal use only.
+///
+
+namespace Term
+{
+namespace Private
+{
+
+///
+///@brief Number of columns taken by \b codepoint in a terminal.
+///
+///@return 2 for East Asian wide and fullwidth characters (CJK, most emoji), 0 for combining marks and other zero width characters, -1 for control characters, 1 otherwise.
+///@note The table (wcwidth_table.hpp) is generated by wcwidth.py, the lookup is two array accesses.
+///@warning Internal use only.
+///
+int wcwidth(const char32_t& codepoint) noexcept;
+
+///
+///@brief Number of columns taken by \b str , control characters count as 0.
+///@warning Internal use only.
+///
+std::size_t wcswidth(const std::u32string& str) noexcept;
+
+///
+///@brief Number of columns taken by the UTF-8 encoded \b str , control characters count as 0.
+///@warning Internal use only.
+///
+std::size_t wcswidth(const std::string& str);
+
+}  // namespace Private
+}  // namespace Term
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+#
+# cpp-terminal
+# C++ library for writing multi-platform terminal applications.
+#
+# SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+#
+# SPDX-License-Identifier: MIT
+#
+# Generate wcwidth_table.hpp, the two-stage display width table used by wcwidth.cpp, from the Unicode database of the Python running it:
+#   python3 wcwidth.py > wcwidth_table.hpp
+
+import sys
+import unicodedata
+
+BLOCK = 256  # code points per block of the second stage
+PER_BYTE = 4  # 2 bits per code point
+
+NON_PRINTABLE, ZERO, NARROW, WIDE = 3, 0, 1, 2
+
+# Format characters that are displayed (Prepended_Concatenation_Mark)
+PREPENDED = [(0x0600, 0x0605), (0x06DD, 0x06DD), (0x070F, 0x070F), (0x0890, 0x0891), (0x08E2, 0x08E2), (0x110BD, 0x110BD), (0x110CD, 0x110CD)]
+
+# Unassigned code points of these ranges are reserved for wide ideographs
+WIDE_RANGES = [(0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF), (0x20000, 0x2FFFD), (0x30000, 0x3FFFD)]
+
+
+def width(codepoint):
+    if codepoint == 0:
+        return ZERO
+    if codepoint < 0x20 or 0x7F <= codepoint < 0xA0:
+        return NON_PRINTABLE
+    if codepoint == 0x00AD or any(first <= codepoint <= last for first, last in PREPENDED):  # SOFT HYPHEN is displayed too
+        return NARROW
+    character = chr(codepoint)
+    category = unicodedata.category(character)
+    if category in ("Mn", "Me") or category == "Cf" or 0x1160 <= codepoint <= 0x11FF or codepoint == 0x200B:
+        return ZERO  # combining marks, format characters, Hangul medial vowels and final consonants
+    if category != "Cn" and unicodedata.east_asian_width(character) in ("W", "F"):
+        return WIDE
+    if category == "Cn" and any(first <= codepoint <= last for first, last in WIDE_RANGES):
+        return WIDE
+    return NARROW
+
+
+def main():
+    widths = [width(codepoint) for codepoint in range(0x110000)]
+    blocks = []
+    index = {}
+    stage1 = []
+    for start in range(0, 0x110000, BLOCK):
+        packed = []
+        for byte in range(start, start + BLOCK, PER_BYTE):
+            packed.append(sum(widths[byte + i] << (2 * i) for i in range(PER_BYTE)))
+        key = tuple(packed)
+        if key not in index:
+            index[key] = len(blocks)
+            blocks.append(key)
+        stage1.append(index[key])
+    assert len(blocks) <= 256
+
+    out = sys.stdout
+    out.write("/*\n* cpp-terminal\n* C++ library for writing multi-platform terminal applications.\n*\n* SPDX-FileCopyrightText: 2019-2023 cpp-terminal\n*\n* SPDX-License-Identifier: MIT\n*/\n\n")
+    out.write("// Generated by wcwidth.py from Unicode %s, do not edit.\n\n#pragma once\n\n#include <cstdint>\n\nnamespace Term\n{\nnamespace Private\n{\nnamespace WcWidth\n{\n\n" % unicodedata.unidata_version)
+    out.write("static const constexpr char          unicode_version[]{\"%s\"};\n" % unicodedata.unidata_version)
+    out.write("static const constexpr std::uint32_t block_size{%d};\n\n" % BLOCK)
+    out.write("// Block of the second stage for each %d code points\n" % BLOCK)
+    out.write("static const constexpr std::uint8_t stage1[%d]{\n" % len(stage1))
+    for row in range(0, len(stage1), 32):
+        out.write("  " + ", ".join("%d" % value for value in stage1[row:row + 32]) + ",\n")
+    out.write("};\n\n")
+    out.write("// Width of each code point in 2 bits, 4 per byte: 0 zero width, 1 narrow, 2 wide, 3 non printable\n")
+    out.write("static const constexpr std::uint8_t stage2[%d]{\n" % (len(blocks) * BLOCK // PER_BYTE))
+    for block in blocks:
+        for row in range(0, len(block), 16):
+            out.write("  " + ", ".join("0x%02X" % value for value in block[row:row + 16]) + ",\n")
+    out.write("};\n\n}  // namespace WcWidth\n}  // namespace Private\n}  // namespace Term\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -15,13 +15,61 @@
 #include "cpp-terminal/input.hpp"
 #include "cpp-terminal/iostream.hpp"
 #include "cpp-terminal/key.hpp"
-#include "cpp-terminal/private/macros.hpp"
+#include "cpp-terminal/private/completion_worker.hpp"
+#include "cpp-terminal/private/grapheme.hpp"
+#include "cpp-terminal/private/input.hpp"
 #include "cpp-terminal/private/unicode.hpp"
+#include "cpp-terminal/private/wcwidth.hpp"
 #include "cpp-terminal/screen.hpp"
 #include "cpp-terminal/terminal.hpp"
 #include "cpp-terminal/tty.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <utility>
+
+namespace
+{
+
+// Candidates shown at once by the completion popup
+const constexpr std::size_t popup_rows{8};
+
+// The rows of the popup: the candidates and, when they do not all fit, the position of the selected one
+std::size_t completion_rows(const Term::Completion& completion) { return std::min(completion.size(), popup_rows) + (completion.size() > popup_rows ? 1 : 0); }
+
+void render_model(Term::Window& scr, const Term::Model& m, const std::size_t& column, const std::size_t& row, const std::size_t& columns);
+
+std::string run(Term::MultilinePrompt& prompt);
+
+// Bytes of the UTF-8 encoding of a codepoint
+std::size_t utf8_size(const char32_t& codepoint) { return codepoint < 0x80 ? 1 : (codepoint < 0x800 ? 2 : (codepoint < 0x10000 ? 3 : 4)); }
+
+// Color the cells print_str drew line in from column, row, with the highlighting of the first byte of each character
+void color_line(Term::Window& scr, const std::size_t& column, const std::size_t& row, const std::string& line, const std::vector<Term::Highlight>& highlights)
+{
+  const std::u32string codepoints{Term::Private::utf8_to_utf32(line)};
+  std::size_t          x{column};
+  std::size_t          byte{0};
+  std::size_t          size{0};
+  for(std::size_t i = 0; i < codepoints.size(); i += size)
+  {
+    size = Term::Private::grapheme_size(&codepoints[i], codepoints.size() - i);
+    const int         width{Term::Private::grapheme_width(&codepoints[i], size)};
+    const std::size_t first{byte};
+    for(std::size_t j = i; j != i + size; ++j) { byte += utf8_size(codepoints[j]); }
+    if(width < 1) { continue; }
+    if(!scr.insideWindow(x + static_cast<std::size_t>(width) - 1, row)) { return; }
+    if(first < highlights.size() && highlights[first] != Term::Highlight::Normal)
+    {
+      for(std::size_t cell = 0; cell != static_cast<std::size_t>(width); ++cell) { scr.set_fg(x + cell, row, Term::highlight_color(highlights[first])); }
+    }
+    x += static_cast<std::size_t>(width);
+  }
+}
+
+}  // namespace
 
 Term::Result Term::prompt(const std::string& message, const std::string& first_option, const std::string& second_option, const std::string& prompt_indicator, bool immediate)
 {
@@ -34,96 +82,88 @@ Term::Result Term::prompt(const std::string& message, const std::string& first_o
     return Result::Error;
   }
 
-  Term::Key key;
-
-  if(immediate)
+  Term::ChoicePrompt choice(message, first_option, second_option, prompt_indicator, immediate);
+  while(true)
   {
-    while(true)
+    const std::size_t  typed{choice.input().size()};
+    const Term::Status status{choice.feed(Term::read_event())};
+    if(status == Term::Status::Done)
     {
-      key = Term::read_event();
-      if(key == Term::Key::NoKey) continue;
-      if(key == Term::Key::y || key == Term::Key::Y)
-      {
-        std::cout << '\n' << std::flush;
-        return Result::Yes;
-      }
-      else if(key == Term::Key::n || key == Term::Key::N)
-      {
-        std::cout << '\n' << std::flush;
-        return Result::No;
-      }
-      else if(key == Term::Key::Ctrl_C || key == Term::Key::Ctrl_D)
-      {
-        std::cout << '\n' << std::flush;
-        return Result::Abort;
-      }
-      else if(key == Term::Key::Enter)
-      {
-        std::cout << '\n' << std::flush;
-        return Result::None;
-      }
-      else
-      {
-        std::cout << '\n' << std::flush;
-        return Result::Invalid;
-      }
+      std::cout << '\n' << std::flush;
+      return choice.result();
     }
+    if(choice.input().size() > typed) { std::cout << choice.input().back() << std::flush; }
+    else if(choice.input().size() < typed) { std::cout << "\u001b[D \u001b[D" << std::flush; }  // erase the last character and move the cursor back
   }
-  else
+}
+
+Term::ChoicePrompt::ChoicePrompt(const std::string& message, const std::string& first_option, const std::string& second_option, const std::string& prompt_indicator, const bool& immediate)
+  : m_message(message), m_first_option(first_option), m_second_option(second_option), m_prompt_indicator(prompt_indicator), m_immediate(immediate)
+{
+}
+
+Term::Status Term::ChoicePrompt::feed(const Term::Event& event)
+{
+  if(event.type() != Term::Event::Type::Key) { return Status::Unchanged; }
+  const Term::Key key{event};
+  if(key == Term::Key::NoKey) { return Status::Unchanged; }
+  if(m_immediate)
   {
-    std::string input;
-    while(true)
-    {
-      key = Term::read_event();
-      if(key == Term::Key::NoKey) continue;
-      if(key >= 'a' && key <= 'z')
-      {
-        std::cout << (char)key << std::flush;
-        input.push_back(static_cast<char>(key));
-      }
-      else if(key >= 'A' && key <= 'Z')
-      {
-        std::cout << (char)key << std::flush;
-        input.push_back(static_cast<char>(key.tolower()));  // convert upper case to lowercase
-      }
-      else if(key == Term::Key::Ctrl_C || key == Term::Key::Ctrl_D)
-      {
-        std::cout << '\n';
-        return Result::Abort;
-      }
-      else if(key == Term::Key::Backspace)
-      {
-        if(input.empty() != 0)
-        {
-          std::cout << "\u001b[D \u001b[D" << std::flush;  // erase last line and move the cursor back
-          input.pop_back();
-        }
-      }
-      else if(key == Term::Key::Enter)
-      {
-        if(input == "y" || input == "yes")
-        {
-          std::cout << '\n' << std::flush;
-          return Result::Yes;
-        }
-        else if(input == "n" || input == "no")
-        {
-          std::cout << '\n' << std::flush;
-          return Result::No;
-        }
-        else if(input.empty())
-        {
-          std::cout << '\n' << std::flush;
-          return Result::None;
-        }
-        else
-        {
-          std::cout << '\n' << std::flush;
-          return Result::Invalid;
-        }
-      }
-    }
+    if(key == Term::Key::y || key == Term::Key::Y) { m_result = Result::Yes; }
+    else if(key == Term::Key::n || key == Term::Key::N) { m_result = Result::No; }
+    else if(key == Term::Key::Ctrl_C || key == Term::Key::Ctrl_D) { m_result = Result::Abort; }
+    else if(key == Term::Key::Enter) { m_result = Result::None; }
+    else { m_result = Result::Invalid; }
+    return Status::Done;
+  }
+  if((key >= 'a' && key <= 'z') || (key >= 'A' && key <= 'Z'))
+  {
+    m_input.push_back(static_cast<char>(key.tolower()));  // convert upper case to lowercase
+    return Status::Changed;
+  }
+  if(key == Term::Key::Ctrl_C || key == Term::Key::Ctrl_D)
+  {
+    m_result = Result::Abort;
+    return Status::Done;
+  }
+  if(key == Term::Key::Backspace)
+  {
+    if(m_input.empty()) { return Status::Unchanged; }
+    m_input.pop_back();
+    return Status::Changed;
+  }
+  if(key == Term::Key::Enter)
+  {
+    if(m_input == "y" || m_input == "yes") { m_result = Result::Yes; }
+    else if(m_input == "n" || m_input == "no") { m_result = Result::No; }
+    else if(m_input.empty()) { m_result = Result::None; }
+    else { m_result = Result::Invalid; }
+    return Status::Done;
   }
+  return Status::Unchanged;
+}
+
+Term::Result Term::ChoicePrompt::result() const { return m_result; }
+
+const std::string& Term::ChoicePrompt::input() const { return m_input; }
+
+std::string Term::ChoicePrompt::line() const { return m_message + " [" + m_first_option + '/' + m_second_option + ']' + m_prompt_indicator + ' ' + m_input; }
+
+void Term::ChoicePrompt::render(Term::Window& window, const std::size_t& column, const std::size_t& row, const std::size_t& columns) const
+{
+  // Cut to the region, whole characters only
+  const std::u32string text{Term::Private::utf8_to_utf32(line())};
+  std::size_t          width{0};
+  std::size_t          size{0};
+  while(size != text.size())
+  {
+    const int character{Term::Private::wcwidth(text[size])};
+    if(character > 0 && width + static_cast<std::size_t>(character) > columns) { break; }
+    if(character > 0) { width += static_cast<std::size_t>(character); }
+    ++size;
+  }
+  window.print_str(column, row, Term::Private::utf32_to_utf8(text.substr(0, size)));
+  window.set_cursor_pos(column + std::min(width, columns - 1), row);
 }
 
 Term::Result_simple Term::prompt_simple(const std::string& message)
@@ -187,183 +227,379 @@ void Term::print_left_curly_bracket(Term::Window& scr, const std::size_t& x, con
 void Term::render(Term::Window& scr, const Model& m, const std::size_t& cols)
 {
   scr.clear();
-  print_left_curly_bracket(scr, cols, 1, m.lines.size());
-  scr.print_str(cols - 6, m.lines.size(), std::to_string(m.cursor_row) + "," + std::to_string(m.cursor_col));
-  for(std::size_t j = 0; j < m.lines.size(); j++)
+  render_model(scr, m, 1, 1, cols);
+}
+
+void Term::render_completion(Term::Window& scr, const Term::Completion& completion, const std::size_t& selected, const std::size_t& column, const std::size_t& row)
+{
+  if(completion.empty()) { return; }
+  const std::size_t        shown{std::min(completion.size(), popup_rows)};
+  const std::size_t        first{selected < shown ? 0 : selected + 1 - shown};
+  std::vector<std::string> candidates;
+  std::size_t              width{0};
+  for(std::size_t i = first; i != first + shown; ++i)
+  {
+    candidates.push_back(completion[i]);
+    width = std::max(width, Term::Private::wcswidth(candidates.back()));
+  }
+  const std::string position{completion.size() > shown ? std::to_string(selected + 1) + "/" + std::to_string(completion.size()) : std::string()};
+  width = std::min(std::max(width, position.size()) + 2, scr.get_w());  // a blank on each side
+  const std::size_t x{std::min(column, scr.get_w() - width + 1)};
+  for(std::size_t i = 0; i != candidates.size() + (position.empty() ? 0 : 1); ++i)
+  {
+    const std::size_t y{row + i};
+    if(y > scr.get_h()) { break; }
+    scr.print_str(x, y, std::string(width, ' '));
+    scr.print_str(x + 1, y, i == candidates.size() ? position : candidates[i]);
+    scr.fill_bg(x, y, x + width - 1, y, Term::Color::Name::Gray);
+    if(i == candidates.size()) { scr.fill_style(x, y, x + width - 1, y, Term::Style::Dim); }
+    else if(first + i == selected) { scr.fill_style(x, y, x + width - 1, y, Term::Style::Reversed); }
+  }
+}
+
+std::string Term::prompt_multiline(const std::string& prompt_string, std::vector<std::string>& m_history, std::function<bool(std::string)>& iscomplete)
+{
+  Term::History history;
+  for(const std::string& entry: m_history) { history.add(entry); }
+  const std::string ret{prompt_multiline(prompt_string, history, iscomplete)};
+  m_history.push_back(ret);
+  return ret;
+}
+
+std::string Term::prompt_multiline(const std::string& prompt_string, Term::History& history, std::function<bool(std::string)>& iscomplete)
+{
+  Term::MultilinePrompt prompt(prompt_string, history, iscomplete);
+  return run(prompt);
+}
+
+std::string Term::prompt_multiline(const std::string& prompt_string, Term::History& history, std::function<bool(std::string)>& iscomplete, const Term::Completer& completer)
+{
+  Term::MultilinePrompt prompt(prompt_string, history, iscomplete, completer);
+  return run(prompt);
+}
+
+Term::MultilinePrompt::MultilinePrompt(const std::string& prompt_string, Term::History& history, const std::function<bool(std::string)>& iscomplete) : m_history(history), m_iscomplete(iscomplete)
+{
+  m_model.prompt_string = prompt_string;
+  m_history.sync();  // what other processes added since the last prompt
+  m_history_position = m_history.size();
+}
+
+Term::MultilinePrompt::MultilinePrompt(const std::string& prompt_string, Term::History& history, const std::function<bool(std::string)>& iscomplete, const Term::Completer& completer) : MultilinePrompt(prompt_string, history, iscomplete)
+{
+  // The worker wakes read_event() with an empty event when the candidates are ready
+  m_worker.reset(new Term::Private::CompletionWorker(completer, [this]() { Term::Private::Input::wake(this); }));
+}
+
+Term::MultilinePrompt::~MultilinePrompt() { stop_worker(); }
+
+Term::Status Term::MultilinePrompt::feed(const Term::Event& event)
+{
+  if(m_done) { return Status::Done; }
+  const Term::Key key{event.type() == Term::Event::Type::Key ? static_cast<Term::Key>(event) : Term::Key(Term::Key::NoKey)};
+  const bool      completed{m_worker && m_worker->take(m_completion)};
+  if(completed)
+  {
+    m_selected = 0;
+    if(m_completion.empty()) { m_completing = false; }
+    else if(m_insert_single && m_completion.size() == 1) { accept(0); }
+  }
+  if(event.type() != Term::Event::Type::CopyPaste && key == Term::Key::NoKey) { return completed ? Status::Changed : Status::Unchanged; }
+  // While searching the keys edit the query, any other key ends the search keeping the match and is then handled as usual
+  if(m_searching && search(event, key)) { return Status::Changed; }
+  if(m_completing && !m_completion.empty() && choose(key)) { return Status::Changed; }
+  edit(event, key);
+  if(!m_done) { return Status::Changed; }
+  stop_worker();
+  return Status::Done;
+}
+
+const std::string& Term::MultilinePrompt::result() const { return m_result; }
+
+const Term::Model& Term::MultilinePrompt::model() const { return m_model; }
+
+std::size_t Term::MultilinePrompt::rows() const
+{
+  const std::size_t popup{m_completing ? completion_rows(m_completion) : 0};
+  return std::max(m_model.lines() + (m_searching ? 1 : 0), m_model.cursor_row() + popup);
+}
+
+void Term::MultilinePrompt::set_syntax(const Term::Syntax& syntax)
+{
+  m_highlighter.set_syntax(syntax);
+  m_highlighted = true;
+}
+
+void Term::MultilinePrompt::render(Term::Window& window, const std::size_t& column, const std::size_t& row, const std::size_t& columns) const
+{
+  render_model(window, m_model, column, row, columns);
+  if(m_highlighted)
+  {
+    std::vector<std::string> lines;
+    for(std::size_t line = 1; line <= m_model.lines(); ++line) { lines.push_back(m_model.line(line)); }
+    m_highlighter.assign(lines);
+    m_highlighter.update();
+    for(std::size_t line = 0; line != lines.size(); ++line) { color_line(window, column + m_model.prompt_string.size(), row + line, lines[line], m_highlighter.highlights(line)); }
+  }
+  if(m_searching) { window.print_str(column, row + m_model.lines(), std::string(m_failed ? "(failed reverse-i-search)`" : "(reverse-i-search)`") + m_query + "': "); }
+  if(m_completing && !m_completion.empty())
+  {
+    // Below the word being completed
+    std::size_t x{m_model.prompt_string.size() + m_model.cursor_col()};
+    for(std::size_t position = std::min(m_completion.start(), m_model.cursor()); position != m_model.cursor() && x > m_model.prompt_string.size() + 1; ++position)
+    {
+      if((static_cast<unsigned char>(m_model.text()[position]) & 0xC0U) != 0x80U) { --x; }
+    }
+    render_completion(window, m_completion, m_selected, column + x - 1, row + m_model.cursor_row());
+  }
+}
+
+void Term::MultilinePrompt::browse(const std::size_t& position)
+{
+  m_edited[m_history_position] = m_model.str();
+  m_history_position           = position;
+  const std::map<std::size_t, std::string>::const_iterator found{m_edited.find(position)};
+  m_model.assign(found != m_edited.end() ? found->second : m_history[position]);
+}
+
+// Returns false when the key ends the search, to be handled as usual
+bool Term::MultilinePrompt::search(const Term::Event& event, const Term::Key& key)
+{
+  std::size_t found{std::string::npos};
+  if(event.type() == Term::Event::Type::CopyPaste || key.isprint())
+  {
+    m_query += event.type() == Term::Event::Type::CopyPaste ? *event.get_if_copy_paste() : std::string(1, static_cast<char>(key));
+    found = m_history.search(m_query, m_match == std::string::npos ? m_history.size() : m_match + 1);
+  }
+  else if(key == Key::Ctrl_R) { found = m_history.search(m_query, m_match == std::string::npos ? m_history.size() : m_match); }
+  else if(key == Key::Backspace)
+  {
+    while(!m_query.empty() && (static_cast<unsigned char>(m_query.back()) & 0xC0U) == 0x80U) { m_query.pop_back(); }
+    if(!m_query.empty()) { m_query.pop_back(); }
+    found = m_history.search(m_query, m_history.size());
+  }
+  else if(key == Key::Esc || key == Key::Ctrl_G)
+  {
+    m_model.assign(m_before_search);
+    m_searching = false;
+    return true;
+  }
+  else
+  {
+    m_searching = false;
+    return false;
+  }
+  m_failed = found == std::string::npos;
+  if(!m_failed)
+  {
+    m_match = found;
+    m_model.assign(m_history[m_match]);
+  }
+  return true;
+}
+
+// The popup takes the keys choosing a candidate, returns false for the others
+bool Term::MultilinePrompt::choose(const Term::Key& key)
+{
+  switch(key)
+  {
+    case Key::Tab:
+    case Key::ArrowDown: m_selected = (m_selected + 1) % m_completion.size(); return true;
+    case Key::ArrowUp: m_selected = (m_selected + m_completion.size() - 1) % m_completion.size(); return true;
+    case Key::PageDown: m_selected = std::min(m_selected + popup_rows, m_completion.size() - 1); return true;
+    case Key::PageUp: m_selected = m_selected > popup_rows ? m_selected - popup_rows : 0; return true;
+    case Key::Enter: accept(m_selected); return true;
+    case Key::Esc: close_completion(); return true;
+    default: return false;
+  }
+}
+
+void Term::MultilinePrompt::edit(const Term::Event& event, const Term::Key& key)
+{
+  if(event.type() == Term::Event::Type::CopyPaste)
+  {
+    // Inserted at once, line endings of the clipboard normalized
+    const std::string& pasted{*event.get_if_copy_paste()};
+    std::string        text;
+    text.reserve(pasted.size());
+    for(std::size_t i = 0; i != pasted.size(); ++i)
+    {
+      if(pasted[i] != '\r') { text.push_back(pasted[i]); }
+      else if(i + 1 == pasted.size() || pasted[i + 1] != '\n') { text.push_back('\n'); }
+    }
+    m_model.insert(text);
+  }
+  else if(key.isprint()) { m_model.insert(static_cast<char>(key)); }
+  else if(key == Key::Ctrl_D)
+  {
+    if(m_model.lines() == 1 && m_model.line(1).empty())
+    {
+      m_result = std::string(1, static_cast<char>(Key::Ctrl_D));
+      m_done   = true;
+    }
+  }
+  else
+  {
+    switch(key)
+    {
+      case Key::Enter:
+        if(m_iscomplete(m_model.str()))
+        {
+          m_result = m_model.str();
+          m_done   = true;
+          m_history.add(m_result);
+        }
+        else { m_model.new_line(); }
+        break;
+      case Key::Backspace: m_model.erase_before(); break;
+      case Key::Del: m_model.erase_after(); break;
+      case Key::ArrowLeft: m_model.move_left(); break;
+      case Key::ArrowRight: m_model.move_right(); break;
+      case Key::Home: m_model.move_home(); break;
+      case Key::End: m_model.move_end(); break;
+      case Key::ArrowUp:
+        if(!m_model.move_up() && m_history_position > 0)
+        {
+          const std::size_t col{m_model.cursor_col()};
+          browse(m_history_position - 1);
+          m_model.set_cursor(m_model.lines(), col);
+        }
+        break;
+      case Key::ArrowDown:
+        if(!m_model.move_down() && m_history_position < m_history.size())
+        {
+          const std::size_t col{m_model.cursor_col()};
+          browse(m_history_position + 1);
+          m_model.set_cursor(1, col);
+        }
+        break;
+      case Key::Ctrl_N: m_model.new_line(); break;
+      case Key::Tab:
+        if(m_worker) { complete(true); }
+        break;
+      case Key::Ctrl_R:
+        m_searching = true;
+        m_failed    = false;
+        m_query.clear();
+        m_match         = std::string::npos;
+        m_before_search = m_model.str();
+        break;
+      default: break;
+    }
+  }
+  // Typing in the popup completes the new word, other keys close it
+  if(m_completing && key != Key::Tab)
+  {
+    if(event.type() == Term::Event::Type::CopyPaste || key.isprint() || key == Key::Backspace || key == Key::Del) { complete(false); }
+    else { close_completion(); }
+  }
+}
+
+void Term::MultilinePrompt::complete(const bool& tab)
+{
+  m_completing    = true;
+  m_insert_single = tab;
+  m_worker->request(m_model.text().substr(0, m_model.cursor()));
+}
+
+void Term::MultilinePrompt::close_completion()
+{
+  m_completing = false;
+  m_completion = Term::Completion();
+  if(m_worker) { m_worker->cancel(); }
+}
+
+// The application reads the next events itself once the prompt is done: no wakeup may be left for it
+void Term::MultilinePrompt::stop_worker()
+{
+  if(!m_worker) { return; }
+  m_worker.reset();
+  Term::Private::Input::discard(this);
+}
+
+// The result of a request made before the last edits replaces what the user typed since, up to the cursor
+void Term::MultilinePrompt::accept(const std::size_t& index)
+{
+  m_model.replace_before(std::min(m_completion.start(), m_model.cursor()), m_completion[index]);
+  close_completion();
+}
+
+namespace
+{
+
+void render_model(Term::Window& scr, const Term::Model& m, const std::size_t& column, const std::size_t& row, const std::size_t& columns)
+{
+  const std::size_t x{column - 1};
+  const std::size_t y{row - 1};
+  Term::print_left_curly_bracket(scr, x + columns, y + 1, y + m.lines());
+  scr.print_str(x + columns - 6, y + m.lines(), std::to_string(m.cursor_row()) + "," + std::to_string(m.cursor_col()));
+  for(std::size_t j = 0; j < m.lines(); j++)
   {
     if(j == 0)
     {
-      scr.fill_fg(1, j + 1, m.prompt_string.size(), m.lines.size(), Term::Color::Name::Green);
-      scr.fill_style(1, j + 1, m.prompt_string.size(), m.lines.size(), Term::Style::Bold);
-      scr.print_str(1, j + 1, m.prompt_string);
+      scr.fill_fg(x + 1, y + j + 1, x + m.prompt_string.size(), y + m.lines(), Term::Color::Name::Green);
+      scr.fill_style(x + 1, y + j + 1, x + m.prompt_string.size(), y + m.lines(), Term::Style::Bold);
+      scr.print_str(x + 1, y + j + 1, m.prompt_string);
     }
     else
     {
-      for(std::size_t i = 0; i < m.prompt_string.size() - 1; i++) { scr.set_char(i + 1, j + 1, '.'); }
+      for(std::size_t i = 0; i < m.prompt_string.size() - 1; i++) { scr.set_char(x + i + 1, y + j + 1, '.'); }
     }
-    scr.print_str(m.prompt_string.size() + 1, j + 1, m.lines[j]);
+    scr.print_str(x + m.prompt_string.size() + 1, y + j + 1, m.line(j + 1));
   }
-  scr.set_cursor_pos(m.prompt_string.size() + m.cursor_col, m.cursor_row);
+  scr.set_cursor_pos(x + m.prompt_string.size() + m.cursor_col(), y + m.cursor_row());
 }
 
-std::string Term::prompt_multiline(const std::string& prompt_string, std::vector<std::string>& m_history, std::function<bool(std::string)>& iscomplete)
+std::string run(Term::MultilinePrompt& prompt)
 {
   Term::Cursor cursor;
   Term::Screen screen(25, 80);
   bool         term_attached = Term::is_stdin_a_tty();
-  if(is_stdin_a_tty())
+  if(Term::is_stdin_a_tty())
   {
-    cursor = cursor_position();
-    screen = screen_size();
+    cursor = Term::cursor_position();
+    screen = Term::screen_size();
   }
 
-  Model m;
-  m.prompt_string = prompt_string;
-
-  // Make a local copy of history that can be modified by the user. All
-  // changes will be forgotten once a command is submitted.
-  std::vector<std::string> history     = m_history;
-  std::size_t              history_pos = history.size();
-  history.push_back(concat(m.lines));  // Push back empty input
-
-  Term::Window scr(screen.columns(), 1);
-  Term::Key    key;
-  render(scr, m, screen.columns());
+  // scr is the frame being built, previous the one on the screen: only the difference is written
+  Term::Window scr(screen.columns(), prompt.rows());
+  Term::Window previous(screen.columns(), 1);
+  prompt.render(scr, 1, 1, screen.columns());
   std::cout << scr.render(1, cursor.row(), term_attached) << std::flush;
-  bool not_complete = true;
-  while(not_complete)
+  while(true)
   {
-    key = Term::read_event();
-    if(key == Term::Key::NoKey) continue;
-    if(key.isprint())
-    {
-      std::string before = m.lines[m.cursor_row - 1].substr(0, m.cursor_col - 1);
-      std::string newchar;
-      newchar.push_back(static_cast<char>(key));
-      std::string after         = m.lines[m.cursor_row - 1].substr(m.cursor_col - 1);
-      m.lines[m.cursor_row - 1] = before += newchar += after;
-      m.cursor_col++;
-    }
-    else if(key == Key::Ctrl_D)
-    {
-      if(m.lines.size() == 1 && m.lines[m.cursor_row - 1].empty())
-      {
-        m.lines[m.cursor_row - 1].push_back(static_cast<char>(Key::Ctrl_D));
-        std::cout << "\n" << std::flush;
-        m_history.push_back(m.lines[0]);
-        return m.lines[0];
-      }
-    }
-    else
+    const Term::Status status{prompt.feed(Term::read_event())};
+    if(status == Term::Status::Unchanged) { continue; }
+    if(status == Term::Status::Done && prompt.result().size() == 1 && prompt.result()[0] == Term::Key::Ctrl_D)
     {
-      switch(key)
-      {
-        case Key::Enter:
-          not_complete = !iscomplete(concat(m.lines));
-          if(not_complete) key = Key(static_cast<Term::Key>(Term::MetaKey::Value::Alt + Term::Key::Enter));
-          else
-            break;
-          CPP_TERMINAL_FALLTHROUGH;
-        case Key::Backspace:
-          if(m.cursor_col > 1)
-          {
-            std::string before        = m.lines[m.cursor_row - 1].substr(0, m.cursor_col - 2);
-            std::string after         = m.lines[m.cursor_row - 1].substr(m.cursor_col - 1);
-            m.lines[m.cursor_row - 1] = before + after;
-            m.cursor_col--;
-          }
-          else if(m.cursor_col == 1 && m.cursor_row > 1)
-          {
-            m.cursor_col = m.lines[m.cursor_row - 2].size() + 1;
-            m.lines[m.cursor_row - 2] += m.lines[m.cursor_row - 1];
-            m.lines.erase(m.lines.begin() + static_cast<long>(m.cursor_row) - 1);
-            m.cursor_row--;
-          }
-          break;
-        case Key::Del:
-          if(m.cursor_col <= m.lines[m.cursor_row - 1].size())
-          {
-            std::string before        = m.lines[m.cursor_row - 1].substr(0, m.cursor_col - 1);
-            std::string after         = m.lines[m.cursor_row - 1].substr(m.cursor_col);
-            m.lines[m.cursor_row - 1] = before + after;
-          }
-          break;
-        case Key::ArrowLeft:
-          if(m.cursor_col > 1) { m.cursor_col--; }
-          break;
-        case Key::ArrowRight:
-          if(m.cursor_col <= m.lines[m.cursor_row - 1].size()) { m.cursor_col++; }
-          break;
-        case Key::Home: m.cursor_col = 1; break;
-        case Key::End: m.cursor_col = m.lines[m.cursor_row - 1].size() + 1; break;
-        case Key::ArrowUp:
-          if(m.cursor_row == 1)
-          {
-            if(history_pos > 0)
-            {
-              history[history_pos] = concat(m.lines);
-              history_pos--;
-              m.lines      = split(history[history_pos]);
-              m.cursor_row = m.lines.size();
-              if(m.cursor_col > m.lines[m.cursor_row - 1].size() + 1) { m.cursor_col = m.lines[m.cursor_row - 1].size() + 1; }
-              if(m.lines.size() > scr.get_h()) { scr.set_h(m.lines.size()); }
-            }
-          }
-          else
-          {
-            m.cursor_row--;
-            if(m.cursor_col > m.lines[m.cursor_row - 1].size() + 1) { m.cursor_col = m.lines[m.cursor_row - 1].size() + 1; }
-          }
-          break;
-        case Key::ArrowDown:
-          if(m.cursor_row == m.lines.size())
-          {
-            if(history_pos < history.size() - 1)
-            {
-              history[history_pos] = concat(m.lines);
-              history_pos++;
-              m.lines      = split(history[history_pos]);
-              m.cursor_row = 1;
-              if(m.cursor_col > m.lines[m.cursor_row - 1].size() + 1) { m.cursor_col = m.lines[m.cursor_row - 1].size() + 1; }
-              if(m.lines.size() > scr.get_h()) { scr.set_h(m.lines.size()); }
-            }
-          }
-          else
-          {
-            m.cursor_row++;
-            if(m.cursor_col > m.lines[m.cursor_row - 1].size() + 1) { m.cursor_col = m.lines[m.cursor_row - 1].size() + 1; }
-          }
-          break;
-        case Key::Ctrl_N:
-        {
-          std::string before        = m.lines[m.cursor_row - 1].substr(0, m.cursor_col - 1);
-          std::string after         = m.lines[m.cursor_row - 1].substr(m.cursor_col - 1);
-          m.lines[m.cursor_row - 1] = before;
-          if(m.cursor_row < m.lines.size())
-          {
-            // Not at the bottom row, can't push back
-            m.lines.insert(m.lines.begin() + static_cast<long>(m.cursor_row), after);
-          }
-          else { m.lines.push_back(after); }
-          m.cursor_col = 1;
-          m.cursor_row++;
-          if(m.lines.size() > scr.get_h()) { scr.set_h(m.lines.size()); }
-          break;
-        }
-        default: break;
-      }
+      std::cout << "\n" << std::flush;
+      return prompt.result();
     }
-    render(scr, m, screen.columns());
-    std::cout << scr.render(1, cursor.row(), term_attached) << std::flush;
-    if(cursor.row() + (int)scr.get_h() - 1 > screen.rows())
+    std::swap(scr, previous);
+    // The window never shrinks, the rows left by a shorter input are cleared
+    const std::size_t rows{std::max(prompt.rows(), previous.get_h())};
+    if(rows > scr.get_h()) { scr.set_h(rows); }
+    scr.clear();
+    prompt.render(scr, 1, 1, screen.columns());
+    std::string       out;
+    const std::size_t bottom{cursor.row() + scr.get_h() - 1};
+    if(term_attached && bottom > screen.rows() && cursor.row() > 1)
     {
-      cursor.setRow(static_cast<std::uint16_t>(static_cast<long>(screen.rows()) - (static_cast<long>(scr.get_h()) - 1)));
-      std::cout << scr.render(1, cursor.row(), term_attached) << std::flush;
+      // Scroll the terminal up to make room below, what is drawn moves up with it
+      const std::size_t scroll{std::min(bottom - screen.rows(), cursor.row() - std::size_t{1})};
+      out.append(Term::cursor_move(screen.rows(), 1));
+      out.append(scroll, '\n');
+      cursor.setRow(static_cast<std::uint16_t>(cursor.row() - scroll));
     }
+    if(term_attached) { out.append(scr.render(1, cursor.row(), previous)); }
+    else { out.append(scr.render(1, cursor.row(), false)); }
+    std::cout << out << std::flush;
+    if(status == Term::Status::Done) { break; }
   }
   std::string line_skips;
-  for(std::size_t i = 0; i <= m.lines.size() - m.cursor_row; i++) { line_skips += "\n"; }
+  for(std::size_t i = 0; i <= prompt.model().lines() - prompt.model().cursor_row(); i++) { line_skips += "\n"; }
   std::cout << line_skips << std::flush;
-  m_history.push_back(concat(m.lines));
-  return concat(m.lines);
+  return prompt.result();
 }
+
+}  // namespace
@@ -9,14 +9,29 @@
 
 #pragma once
 
+#include "cpp-terminal/completion.hpp"
+#include "cpp-terminal/event.hpp"
+#include "cpp-terminal/highlight.hpp"
+#include "cpp-terminal/history.hpp"
+#include "cpp-terminal/model.hpp"
 #include "cpp-terminal/terminal.hpp"
 #include "cpp-terminal/window.hpp"
 
+#include <cstddef>
 #include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace Term
 {
 
+namespace Private
+{
+class CompletionWorker;
+}
+
 // indicates the results of prompt_blocking() and prompt_non_blocking
 enum class Result
 {
@@ -40,6 +55,59 @@ enum class Result
  */
 Result prompt(const std::string& message, const std::string& first_option, const std::string& second_option, const std::string& prompt_indicator, bool);
 
+///
+/// @brief What feeding an event did to a prompt.
+///
+enum class Status
+{
+  Unchanged,  ///< The event was ignored, nothing to render again.
+  Changed,    ///< The prompt has to be rendered again.
+  Done        ///< The prompt is finished, its result is ready.
+};
+
+///
+/// @brief The state machine of \b prompt : it is fed events by the caller, which keeps control of its loop (to update a live display meanwhile for example), and rendered on demand.
+///
+class ChoicePrompt
+{
+public:
+  ///
+  /// @brief Shown as 1 [2/3]4 <user Input>. When \b immediate the first key decides, otherwise the answer is typed and submitted with Enter.
+  ///
+  ChoicePrompt(const std::string& message, const std::string& first_option, const std::string& second_option, const std::string& prompt_indicator, const bool& immediate);
+
+  Status feed(const Term::Event& event);
+
+  ///
+  /// @brief The answer, valid once \b feed returned \b Status::Done .
+  ///
+  Result result() const;
+
+  ///
+  /// @brief What was typed so far, in lower case.
+  ///
+  const std::string& input() const;
+
+  ///
+  /// @brief The prompt as one line : message, options and input.
+  ///
+  std::string line() const;
+
+  ///
+  /// @brief Draw the prompt on \b row of \b window , from \b column and at most \b columns wide, and put the cursor after the input.
+  ///
+  void render(Term::Window& window, const std::size_t& column, const std::size_t& row, const std::size_t& columns) const;
+
+private:
+  std::string m_message;
+  std::string m_first_option;
+  std::string m_second_option;
+  std::string m_prompt_indicator;
+  bool        m_immediate{false};
+  std::string m_input;
+  Result      m_result{Result::None};
+};
+
 // indicates the results of prompt_simple()
 enum class Result_simple
 {
@@ -60,18 +128,6 @@ Result_simple prompt_simple(const std::string& message);
 
 /* Multiline prompt */
 
-// This model contains all the information about the state of the prompt in an
-// abstract way, irrespective of where or how it is rendered.
-class Model
-{
-public:
-  std::string              prompt_string;  // The string to show as the prompt
-  std::vector<std::string> lines{""};      // The current input string in the prompt as a vector of lines, without '\n' at the end.
-  // The current cursor position in the "input" string, starting from (1,1)
-  std::size_t              cursor_col{1};
-  std::size_t              cursor_row{1};
-};
-
 std::string concat(const std::vector<std::string>&);
 
 std::vector<std::string> split(const std::string&);
@@ -80,5 +136,107 @@ void print_left_curly_bracket(Term::Window&, const std::size_t&, const std::size
 
 void render(Term::Window&, const Model&, const std::size_t&);
 
+///
+/// @brief Print the popup of \b completion with its top left corner at \b column , \b row (moved left if it does not fit) : at most 8 candidates around \b selected , which is highlighted, followed by its position when they do not all fit.
+/// Only the candidates shown are produced.
+///
+void render_completion(Term::Window& scr, const Term::Completion& completion, const std::size_t& selected, const std::size_t& column, const std::size_t& row);
+
+///
+/// @brief The state machine of \b prompt_multiline : it is fed events by the caller, which keeps control of its loop, and rendered on demand into a region of a \b Window .
+///
+/// The completions asked with Tab arrive asynchronously : the worker wakes \b read_event() with an empty event, and any event fed (empty ones included) picks them up.
+/// Once the prompt is done (or destroyed) the worker is stopped and its wakeups not read yet are dropped, \b read_event() returns the events of the application only.
+///
+class MultilinePrompt
+{
+public:
+  MultilinePrompt(const std::string& prompt_string, Term::History& history, const std::function<bool(std::string)>& iscomplete);
+  ///
+  /// @brief A prompt completed by \b completer , which must outlive it.
+  ///
+  MultilinePrompt(const std::string& prompt_string, Term::History& history, const std::function<bool(std::string)>& iscomplete, const Term::Completer& completer);
+  ///
+  /// @brief Cancels the completion in progress and waits for the completer to return.
+  ///
+  ~MultilinePrompt();
+  MultilinePrompt(const MultilinePrompt&)            = delete;
+  MultilinePrompt(MultilinePrompt&&)                 = delete;
+  MultilinePrompt& operator=(const MultilinePrompt&) = delete;
+  MultilinePrompt& operator=(MultilinePrompt&&)      = delete;
+
+  ///
+  /// @brief Handle \b event . The input is added to the history when it is submitted.
+  ///
+  Status feed(const Term::Event& event);
+
+  ///
+  /// @brief The submitted input, or Ctrl-D (as a one character string) if Ctrl-D was pressed on an empty input. Valid once \b feed returned \b Status::Done .
+  ///
+  const std::string& result() const;
+
+  const Term::Model& model() const;
+
+  ///
+  /// @brief Highlight the input with \b syntax . Only the lines changed since the last rendering are highlighted again.
+  ///
+  void set_syntax(const Term::Syntax& syntax);
+
+  ///
+  /// @brief The rows \b render needs : the input, the search line and the completion popup.
+  ///
+  std::size_t rows() const;
+
+  ///
+  /// @brief Draw the prompt in \b window from \b column , \b row , \b columns wide and \b rows() high, and put the cursor in it. The region is drawn over, it should be blank.
+  ///
+  void render(Term::Window& window, const std::size_t& column, const std::size_t& row, const std::size_t& columns) const;
+
+private:
+  void                                             browse(const std::size_t& position);
+  bool                                             search(const Term::Event& event, const Term::Key& key);
+  bool                                             choose(const Term::Key& key);
+  void                                             edit(const Term::Event& event, const Term::Key& key);
+  void                                             complete(const bool& tab);
+  void                                             close_completion();
+  void                                             stop_worker();
+  void                                             accept(const std::size_t& index);
+  Term::Model                                      m_model;
+  Term::History&                                   m_history;
+  std::function<bool(std::string)>                 m_iscomplete;
+  std::map<std::size_t, std::string>               m_edited;  ///< Entries changed while browsing the history, forgotten once the input is submitted.
+  std::size_t                                      m_history_position{0};
+  bool                                             m_searching{false};  ///< Incremental reverse search (Ctrl-R), the input shows the match.
+  bool                                             m_failed{false};
+  std::string                                      m_query;
+  std::size_t                                      m_match{std::string::npos};
+  std::string                                      m_before_search;
+  std::unique_ptr<Term::Private::CompletionWorker> m_worker;
+  bool                                             m_completing{false};     ///< The popup is open, or waits for the candidates of a Tab.
+  bool                                             m_insert_single{false};  ///< A Tab inserts a lone candidate at once, typing in the popup does not.
+  Term::Completion                                 m_completion;
+  std::size_t                                      m_selected{0};
+  bool                                             m_done{false};
+  std::string                                      m_result;
+  bool                                             m_highlighted{false};
+  mutable Term::Highlighter                        m_highlighter;  ///< A cache of the highlighting of the lines, brought up to date when rendering.
+};
+
 std::string prompt_multiline(const std::string&, std::vector<std::string>&, std::function<bool(std::string)>&);
+
+///
+/// @brief A multiline prompt, the input is submitted on Enter once \b iscomplete accepts it.
+///
+/// Up and down browse \b history (changes made while browsing are forgotten once the input is submitted), Ctrl-R searches it backwards as you type, Ctrl-R again finds older matches and Esc cancels the search.
+/// The submitted input is added to \b history .
+///
+std::string prompt_multiline(const std::string& prompt_string, Term::History& history, std::function<bool(std::string)>& iscomplete);
+
+///
+/// @brief A multiline prompt with a \b history , completed by \b completer .
+///
+/// Tab asks \b completer to complete the word before the cursor, on a worker thread : keys are handled while it works, typing supersedes the request.
+/// A single candidate is inserted at once, several open a popup below the cursor which follows the typing. In the popup Tab, up and down select a candidate, page up and down scroll, Enter inserts it and Esc closes the popup.
+///
+std::string prompt_multiline(const std::string& prompt_string, Term::History& history, std::function<bool(std::string)>& iscomplete, const Term::Completer& completer);
 }  // namespace Term
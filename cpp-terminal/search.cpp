@@ -0,0 +1,339 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/search.hpp"
+
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/textbuffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__)) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define CPPTERMINAL_SEARCH_SSE2
+  #include <emmintrin.h>
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+  #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  #define CPPTERMINAL_SEARCH_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace
+{
+
+const std::size_t npos{static_cast<std::size_t>(-1)};
+// A text larger than a chunk is searched on several threads, a chunk each
+const std::size_t chunk_size{4 * 1024 * 1024};
+
+#if defined(CPPTERMINAL_SEARCH_SSE2)
+std::size_t count_trailing_zeros(const std::uint32_t& mask) noexcept
+{
+  #if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index{0};
+  _BitScanForward(&index, mask);
+  return index;
+  #else
+  return static_cast<std::size_t>(__builtin_ctz(mask));
+  #endif
+}
+#endif
+
+// Whether the bytes [begin, end) of text match those of the folded pattern
+bool equal(const char* text, const std::string& folded, const std::string& masks, const std::size_t& begin, const std::size_t& end) noexcept
+{
+  for(std::size_t i = begin; i != end; ++i)
+  {
+    if(static_cast<char>(text[i] | masks[i]) != folded[i]) { return false; }
+  }
+  return true;
+}
+
+// The longest run of plain characters every match of the regular expression holds, empty if it is not simple enough to tell
+std::string required_literal(const std::string& pattern)
+{
+  if(pattern.find('|') != npos) { return {}; }
+  std::string ret;
+  std::string run;
+  std::size_t depth{0};  // In groups and brackets
+  const auto  end_run = [&ret, &run]()
+  {
+    if(run.size() > ret.size()) { ret = run; }
+    run.clear();
+  };
+  for(std::size_t i = 0; i < pattern.size(); ++i)
+  {
+    const char character{pattern[i]};
+    if(character == '\\')
+    {
+      end_run();
+      ++i;
+    }
+    else if(character == '(' || character == '[')
+    {
+      end_run();
+      ++depth;
+    }
+    else if(character == ')' || character == ']')
+    {
+      end_run();
+      if(depth != 0) { --depth; }
+    }
+    else if(character == '?' || character == '*' || character == '{')
+    {
+      // The character before may not be there
+      if(!run.empty()) { run.pop_back(); }
+      end_run();
+      if(character == '{') { i = std::min(pattern.find('}', i), pattern.size()); }
+    }
+    else if(depth == 0 && ((character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') || (character >= '0' && character <= '9') || character == ' ' || character == '_' || character == '-' || character == ':' || character == '/')) { run += character; }
+    else { end_run(); }
+  }
+  end_run();
+  return ret;
+}
+
+}  // namespace
+
+bool Term::Search::Match::found() const { return position != npos; }
+
+Term::Search::Search(const std::string& pattern, const Syntax& syntax, const bool& ignore_case) : m_pattern(pattern), m_syntax(syntax), m_ignore_case(ignore_case)
+{
+  if(m_syntax == Syntax::Regex)
+  {
+    if(pattern.empty()) { return; }
+    std::regex::flag_type flags{std::regex::ECMAScript | std::regex::optimize};
+    if(ignore_case) { flags |= std::regex::icase; }
+    try
+    {
+      m_regex = std::make_shared<const std::regex>(pattern, flags);
+    }
+    catch(const std::regex_error& error)
+    {
+      throw Term::Exception("Search: invalid regular expression " + pattern + " (" + error.what() + ")");
+    }
+  }
+  else if(pattern.find('\n') != npos) { return; }
+  for(const char& character: m_syntax == Syntax::Regex ? required_literal(pattern) : pattern)
+  {
+    const bool letter{(character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z')};
+    m_folded += (ignore_case && letter) ? static_cast<char>(character | 0x20) : character;
+    m_masks += (ignore_case && letter) ? static_cast<char>(0x20) : static_cast<char>(0);
+  }
+}
+
+const std::string& Term::Search::pattern() const { return m_pattern; }
+
+Term::Search::Syntax Term::Search::syntax() const { return m_syntax; }
+
+bool Term::Search::ignore_case() const { return m_ignore_case; }
+
+bool Term::Search::empty() const { return m_syntax == Syntax::Regex ? m_regex == nullptr : m_folded.empty(); }
+
+bool Term::Search::refines(const Search& search) const
+{
+  if(m_syntax != Syntax::Literal || search.m_syntax != Syntax::Literal || m_ignore_case != search.m_ignore_case || empty() || search.empty()) { return false; }
+  return m_folded.compare(0, search.m_folded.size(), search.m_folded) == 0;
+}
+
+Term::Search::Match Term::Search::find(const char* data, const std::size_t& size, const std::size_t& from, const std::size_t& limit) const
+{
+  // An empty match may be at the end of the text
+  const std::size_t end{std::min(limit, size + 1)};
+  if(empty() || from >= end) { return {}; }
+  const std::size_t chunks{(end - from + chunk_size - 1) / chunk_size};
+  const std::size_t threads{std::min<std::size_t>(std::thread::hardware_concurrency(), chunks)};
+  if(threads < 2) { return find_chunk(data, size, from, end); }
+  // Each thread takes the next chunk until there are none left, or a chunk before it has a match
+  std::vector<Match>       matches(chunks);
+  std::atomic<std::size_t> next{0};
+  std::atomic<std::size_t> first{chunks};  // The first chunk found to have a match: the chunks before it have all been searched
+  const auto               work = [this, &data, &size, &from, &end, &matches, &next, &first]()
+  {
+    for(std::size_t chunk = next++; chunk < first; chunk = next++)
+    {
+      const std::size_t begin{from + chunk * chunk_size};
+      matches[chunk] = find_chunk(data, size, begin, std::min(end, begin + chunk_size));
+      if(!matches[chunk].found()) { continue; }
+      std::size_t current{first.load()};
+      while(chunk < current && !first.compare_exchange_weak(current, chunk)) {}
+    }
+  };
+  std::vector<std::thread> helpers;
+  for(std::size_t thread = 1; thread < threads; ++thread) { helpers.emplace_back(work); }
+  work();
+  for(std::thread& helper: helpers) { helper.join(); }
+  return first < chunks ? matches[first] : Match();
+}
+
+Term::Search::Match Term::Search::find(const std::string& text, const std::size_t& from) const { return find(text.data(), text.size(), from, npos); }
+
+Term::Search::Match Term::Search::find_chunk(const char* data, const std::size_t& size, const std::size_t& from, const std::size_t& limit) const
+{
+  return m_syntax == Syntax::Regex ? find_regex(data, size, from, limit) : find_literal(data, size, from, limit);
+}
+
+// The bytes where the first and the last character of the pattern are both found are compared to it, 16 of them at a time
+Term::Search::Match Term::Search::find_literal(const char* data, const std::size_t& size, const std::size_t& from, const std::size_t& limit) const
+{
+  const std::size_t length{m_folded.size()};
+  if(size < length) { return {}; }
+  const std::size_t end{std::min(limit, size - length + 1)};
+  std::size_t       position{from};
+#if defined(CPPTERMINAL_SEARCH_SSE2)
+  static const constexpr std::size_t block{16};
+  const __m128i                      first{_mm_set1_epi8(m_folded.front())};
+  const __m128i                      last{_mm_set1_epi8(m_folded.back())};
+  const __m128i                      first_mask{_mm_set1_epi8(m_masks.front())};
+  const __m128i                      last_mask{_mm_set1_epi8(m_masks.back())};
+  for(; position + block <= end; position += block)
+  {
+    const __m128i firsts{_mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position)), first_mask)};
+    const __m128i lasts{_mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position + length - 1)), last_mask)};
+    std::uint32_t mask{static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(firsts, first), _mm_cmpeq_epi8(lasts, last))))};
+    for(; mask != 0; mask &= mask - 1)
+    {
+      const std::size_t found{position + count_trailing_zeros(mask)};
+      if(equal(data + found, m_folded, m_masks, 1, length)) { return {found, length}; }
+    }
+  }
+#elif defined(CPPTERMINAL_SEARCH_NEON)
+  static const constexpr std::size_t block{16};
+  const uint8x16_t                   first{vdupq_n_u8(static_cast<std::uint8_t>(m_folded.front()))};
+  const uint8x16_t                   last{vdupq_n_u8(static_cast<std::uint8_t>(m_folded.back()))};
+  const uint8x16_t                   first_mask{vdupq_n_u8(static_cast<std::uint8_t>(m_masks.front()))};
+  const uint8x16_t                   last_mask{vdupq_n_u8(static_cast<std::uint8_t>(m_masks.back()))};
+  for(; position + block <= end; position += block)
+  {
+    const uint8x16_t firsts{vorrq_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(data + position)), first_mask)};
+    const uint8x16_t lasts{vorrq_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(data + position + length - 1)), last_mask)};
+    if(vmaxvq_u8(vandq_u8(vceqq_u8(firsts, first), vceqq_u8(lasts, last))) == 0) { continue; }
+    for(std::size_t found = position; found != position + block; ++found)
+    {
+      if(equal(data + found, m_folded, m_masks, 0, length)) { return {found, length}; }
+    }
+  }
+#endif
+  // The rest, or all of it without SIMD: memchr finds the first character when it has a single case
+  while(position < end)
+  {
+    if(m_masks.front() == 0)
+    {
+      const void* found{std::memchr(data + position, m_folded.front(), end - position)};
+      if(found == nullptr) { break; }
+      position = static_cast<std::size_t>(static_cast<const char*>(found) - data);
+    }
+    if(equal(data + position, m_folded, m_masks, length - 1, length) && equal(data + position, m_folded, m_masks, 0, length - 1)) { return {position, length}; }
+    ++position;
+  }
+  return {};
+}
+
+// Line by line, the regular expression knowing whether a line is searched from its start. The lines without the literal it requires are skipped.
+Term::Search::Match Term::Search::find_regex(const char* data, const std::size_t& size, const std::size_t& from, const std::size_t& limit) const
+{
+  for(std::size_t position = from; position < limit && position <= size;)
+  {
+    if(!m_folded.empty())
+    {
+      Match required{find_literal(data, size, position, limit)};
+      if(!required.found() && limit <= size)
+      {
+        // The line going on after limit may have it further
+        const void*       newline{std::memchr(data + limit - 1, '\n', size - limit + 1)};
+        const std::size_t line_end{newline == nullptr ? size : static_cast<std::size_t>(static_cast<const char*>(newline) - data)};
+        required = find_literal(data, size, limit, line_end + 1);
+      }
+      if(!required.found()) { break; }
+      std::size_t line{required.position};
+      while(line > position && data[line - 1] != '\n') { --line; }
+      position = line;
+      if(position >= limit) { break; }
+    }
+    const void*       newline{std::memchr(data + position, '\n', size - position)};
+    const std::size_t line_end{newline == nullptr ? size : static_cast<std::size_t>(static_cast<const char*>(newline) - data)};
+    std::cmatch       match;
+    const bool        found{std::regex_search(data + position, data + line_end, match, *m_regex, position != 0 && data[position - 1] != '\n' ? std::regex_constants::match_prev_avail : std::regex_constants::match_default)};
+    if(found)
+    {
+      const std::size_t start{position + static_cast<std::size_t>(match.position(0))};
+      if(start < limit) { return {start, static_cast<std::size_t>(match.length(0))}; }
+      return {};
+    }
+    if(newline == nullptr) { break; }
+    position = line_end + 1;
+  }
+  return {};
+}
+
+Term::IncrementalSearch::IncrementalSearch(const std::size_t& step) : m_step(std::max<std::size_t>(step, 1)) {}
+
+void Term::IncrementalSearch::start(const Term::TextBuffer& buffer, const Term::Search& search, const std::size_t& from, const bool& forward)
+{
+  const bool resume{m_buffer == &buffer && m_from == from && m_forward == forward && m_size == buffer.size() && search.refines(m_search)};
+  if(resume && m_match.found())
+  {
+    // The first match of search is not before the previous one
+    m_scanned = m_forward ? (m_match.position + m_size - m_from) % m_size : (m_from + m_size - 1 - m_match.position) % m_size;
+  }
+  else if(!resume)
+  {
+    m_buffer  = &buffer;
+    m_from    = std::min(from, buffer.size());
+    m_forward = forward;
+    m_size    = buffer.size();
+    m_scanned = 0;
+  }
+  m_search = search;
+  m_match  = Term::Search::Match();
+  m_done   = m_scanned == m_size || m_search.empty();
+}
+
+bool Term::IncrementalSearch::step()
+{
+  if(m_done) { return true; }
+  // In the search order, the text from m_from is before the text it wraps around to
+  const std::size_t wrap{m_forward ? m_size - m_from : m_from};
+  const std::size_t end{std::min(m_size, m_scanned + m_step)};
+  const std::size_t stop{m_scanned < wrap ? std::min(end, wrap) : end};
+  if(m_forward)
+  {
+    const std::size_t begin{m_scanned < wrap ? m_from + m_scanned : m_scanned - wrap};
+    m_match = m_buffer->find(m_search, begin, begin + (stop - m_scanned));
+  }
+  else
+  {
+    const std::size_t begin{m_scanned < wrap ? m_from - m_scanned : m_size - (m_scanned - wrap)};
+    m_match = m_buffer->rfind(m_search, begin - (stop - m_scanned), begin);
+  }
+  m_scanned = stop;
+  m_done    = m_match.found() || m_scanned == m_size;
+  return m_done;
+}
+
+Term::Search::Match Term::IncrementalSearch::run()
+{
+  while(!step()) {}
+  return m_match;
+}
+
+void Term::IncrementalSearch::cancel()
+{
+  m_buffer = nullptr;
+  m_done   = true;
+  m_match  = Term::Search::Match();
+}
+
+bool Term::IncrementalSearch::done() const { return m_done; }
+
+Term::Search::Match Term::IncrementalSearch::match() const { return m_match; }
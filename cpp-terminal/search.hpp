@@ -0,0 +1,138 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <regex>
+#include <string>
+
+namespace Term
+{
+
+class TextBuffer;
+
+///
+/// @brief A pattern to find in a text : a literal string, compared 16 bytes at a time (the bytes where both its first and its last character are found are the only ones checked), or a regular expression.
+///
+/// Matches do not span lines : a regular expression is run on each line, \b ^ and \b $ match at the ends of the lines, a pattern holding a '\\n' matches nothing. An empty pattern matches nothing either.
+/// The literal a regular expression requires, if it is simple enough to tell, is searched first : the lines without it are skipped.
+/// A large text is split in chunks searched on every core, the match of the first chunk having one is the one returned. A Search is not modified by searching, it can be shared by threads.
+///
+class Search
+{
+public:
+  enum class Syntax : std::uint8_t
+  {
+    Literal,
+    Regex  ///< ECMAScript, as \b std::regex .
+  };
+
+  struct Match
+  {
+    Match() = default;
+    Match(const std::size_t& match_position, const std::size_t& match_length) : position(match_position), length(match_length) {}
+    std::size_t position{static_cast<std::size_t>(-1)};  ///< \b std::string::npos if there is none.
+    std::size_t length{0};
+    bool        found() const;
+  };
+
+  Search() = default;
+
+  ///
+  /// @brief Find \b pattern , ignoring the case of the ASCII letters if \b ignore_case .
+  ///
+  /// @throw Term::Exception if \b pattern is not a valid regular expression.
+  ///
+  explicit Search(const std::string& pattern, const Syntax& syntax = Syntax::Literal, const bool& ignore_case = false);
+
+  const std::string& pattern() const;
+  Syntax             syntax() const;
+  bool               ignore_case() const;
+  bool               empty() const;
+
+  ///
+  /// @brief Whether every match of \b this is a match of \b search : a literal extending the literal \b search , ignoring the case the same way.
+  ///
+  /// The first match of \b this is then not before the first match of \b search , a search as you type resumes from there.
+  ///
+  bool refines(const Search& search) const;
+
+  ///
+  /// @brief The first match starting in [ \b from , \b limit ) of the text \b data [0, \b size ). It may end after \b limit .
+  ///
+  Match find(const char* data, const std::size_t& size, const std::size_t& from, const std::size_t& limit) const;
+  Match find(const std::string& text, const std::size_t& from = 0) const;
+
+private:
+  Match                             find_chunk(const char* data, const std::size_t& size, const std::size_t& from, const std::size_t& limit) const;
+  Match                             find_literal(const char* data, const std::size_t& size, const std::size_t& from, const std::size_t& limit) const;
+  Match                             find_regex(const char* data, const std::size_t& size, const std::size_t& from, const std::size_t& limit) const;
+  std::string                       m_pattern;
+  std::string                       m_folded;  ///< The literal pattern, or the literal a regular expression requires, with the ASCII letters in lower case if \b m_ignore_case .
+  std::string                       m_masks;   ///< 0x20 for the letters of \b m_folded if \b m_ignore_case , 0 otherwise : a byte \b c matches \b m_folded[i] if (c | m_masks[i]) == m_folded[i].
+  Syntax                            m_syntax{Syntax::Literal};
+  bool                              m_ignore_case{false};
+  std::shared_ptr<const std::regex> m_regex;
+};
+
+///
+/// @brief Find as you type in a \b TextBuffer too large to be searched between two key presses : the search is done a step at a time, and dropped when the pattern changes.
+///
+/// The search goes from a position to the end of the text and wraps around to its start (backward : to its start, then from its end). When the new pattern refines the previous one, the search resumes where the previous one
+/// got to or matched. The buffer must not change until the search is over or started again.
+///
+class IncrementalSearch
+{
+public:
+  ///
+  /// @brief Search \b step bytes at each \b step() .
+  ///
+  explicit IncrementalSearch(const std::size_t& step = 16 * 1024 * 1024);
+
+  ///
+  /// @brief Search \b buffer for \b search from \b from , forward or backward (the matches starting before \b from first), cancelling the search in progress.
+  ///
+  void start(const Term::TextBuffer& buffer, const Term::Search& search, const std::size_t& from, const bool& forward = true);
+
+  ///
+  /// @brief Search the next step.
+  ///
+  /// @return Whether the search is over.
+  ///
+  bool step();
+
+  ///
+  /// @brief Search until the search is over.
+  ///
+  Term::Search::Match run();
+
+  void cancel();
+  bool done() const;
+
+  ///
+  /// @brief The match, once the search is over.
+  ///
+  Term::Search::Match match() const;
+
+private:
+  std::size_t             m_step{0};
+  const Term::TextBuffer* m_buffer{nullptr};
+  Term::Search            m_search;
+  std::size_t             m_from{0};
+  bool                    m_forward{true};
+  std::size_t             m_size{0};
+  std::size_t             m_scanned{0};  ///< The bytes searched, from \b m_from in the search order.
+  bool                    m_done{true};
+  Term::Search::Match     m_match;
+};
+
+}  // namespace Term
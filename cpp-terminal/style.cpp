@@ -9,10 +9,32 @@
 
 #include "cpp-terminal/style.hpp"
 
-std::string Term::style(const Term::Style& style)
+#include <cstddef>
+
+namespace
+{
+
+// The sequences of all the styles, made once
+class Sequences
+{
+public:
+  Sequences()
+  {
+    for(std::size_t i = 0; i != 256; ++i) { sequences[i] = "\u001b[" + std::to_string(i) + 'm'; }
+    //https://unix.stackexchange.com/questions/212933/background-color-whitespace-when-end-of-the-terminal-reached
+    sequences[static_cast<std::uint8_t>(Term::Style::DefaultBackgroundColor)] += "\u001b[K";
+  }
+  std::string sequences[256];
+};
+
+const std::string& sequence(const Term::Style& style)
 {
-  //https://unix.stackexchange.com/questions/212933/background-color-whitespace-when-end-of-the-terminal-reached
-  std::string ret{"\u001b[" + std::to_string(static_cast<std::uint8_t>(style)) + 'm'};
-  if(style == Term::Style::DefaultBackgroundColor) { ret += "\u001b[K"; }
-  return ret;
+  static const Sequences ret;
+  return ret.sequences[static_cast<std::uint8_t>(style)];
 }
+
+}  // namespace
+
+std::string Term::style(const Term::Style& style) { return sequence(style); }
+
+void Term::append_style(std::string& out, const Term::Style& style) { out.append(sequence(style)); }
@@ -93,6 +93,11 @@ enum class Style : std::uint8_t
 
 std::string style(const Term::Style& style);
 
+///
+/// @brief Append the escape sequence of \b style(style) to \b out , the sequences are precomputed.
+///
+void append_style(std::string& out, const Term::Style& style);
+
 template<class Stream> Stream& operator<<(Stream& stream, const Term::Style& style_type) { return stream << style(style_type); }
 // unabigify operator overload
 inline Term::TOstream&         operator<<(Term::TOstream& term, const Term::Style& style_type) { return term << style(style_type); }
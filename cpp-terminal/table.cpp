@@ -0,0 +1,187 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/table.hpp"
+
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/private/grapheme.hpp"
+#include "cpp-terminal/style.hpp"
+#include "cpp-terminal/window.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+
+const std::string separator{" │ "};
+const std::size_t separator_width{3};
+
+// Printable ASCII, most cells, is as wide as it is long
+bool ascii(const std::string& text)
+{
+  return std::all_of(text.begin(), text.end(), [](const char& character) { return character >= 0x20 && character < 0x7F; });
+}
+
+// text in exactly width columns: cut with '…' if it is wider, padded as aligned otherwise
+std::string fit(const std::string& text, const std::size_t& width, const Term::Table::Align& align)
+{
+  if(width == 0) { return {}; }
+  const bool        is_ascii{ascii(text)};
+  std::string       ret{is_ascii ? text.substr(0, width + 1) : Term::Private::visible_columns(text, 0, width + 1)};
+  const std::size_t columns{is_ascii ? ret.size() : Term::Private::visible_width(ret)};
+  if(columns > width) { return (is_ascii ? text.substr(0, width - 1) : Term::Private::visible_columns(text, 0, width - 1)) + "…"; }
+  const std::size_t padding{width - columns};
+  switch(align)
+  {
+    case Term::Table::Align::Left: return ret + std::string(padding, ' ');
+    case Term::Table::Align::Right: return std::string(padding, ' ') + ret;
+    case Term::Table::Align::Center: return std::string(padding / 2, ' ') + ret + std::string(padding - padding / 2, ' ');
+  }
+  return ret;
+}
+
+}  // namespace
+
+Term::Table::Column::Column(const std::string& column_title, const Align& column_align, const std::size_t& column_width, const std::size_t& column_max_width) : title(column_title), align(column_align), width(column_width), max_width(column_max_width) {}
+
+Term::Table::Table(const std::vector<Column>& columns, const std::size_t& rows, const Rows& provider, const std::size_t& samples) : m_columns(columns), m_widths(columns.size(), 0), m_rows(rows), m_provider(provider), m_samples(samples)
+{
+  if(m_columns.empty()) { throw Term::Exception("Table: no column"); }
+  if(!m_provider) { throw Term::Exception("Table: no row provider"); }
+}
+
+std::size_t Term::Table::rows() const { return m_rows; }
+
+void Term::Table::set_rows(const std::size_t& rows)
+{
+  m_rows = rows;
+  if(m_cache_top >= m_rows) { m_cache.clear(); }
+  else if(m_cache_top + m_cache.size() > m_rows) { m_cache.resize(m_rows - m_cache_top); }
+}
+
+void Term::Table::refresh() { m_cache.clear(); }
+
+void Term::Table::scroll(const long& rows)
+{
+  if(rows < 0) { m_top -= std::min(m_top, static_cast<std::size_t>(-rows)); }
+  else { scroll_to(m_top + static_cast<std::size_t>(rows)); }
+}
+
+void Term::Table::scroll_to(const std::size_t& row) { m_top = std::min(row, m_rows > m_page ? m_rows - m_page : 0); }
+
+void Term::Table::scroll_columns(const long& columns)
+{
+  if(columns < 0) { m_left -= std::min(m_left, static_cast<std::size_t>(-columns)); }
+  else
+  {
+    const std::size_t total{width()};
+    m_left = std::min(m_left + static_cast<std::size_t>(columns), total > m_view_width ? total - m_view_width : 0);
+  }
+}
+
+std::size_t Term::Table::top() const { return m_top; }
+
+std::size_t Term::Table::left() const { return m_left; }
+
+std::size_t Term::Table::page() const { return m_page; }
+
+std::size_t Term::Table::column_width(const std::size_t& column)
+{
+  sample();
+  return m_widths.at(column);
+}
+
+std::size_t Term::Table::width()
+{
+  sample();
+  std::size_t ret{separator_width * (m_widths.size() - 1)};
+  for(const std::size_t& width: m_widths) { ret += width; }
+  return ret;
+}
+
+void Term::Table::render(Term::Window& window, const std::size_t& column, const std::size_t& row, const std::size_t& width, const std::size_t& height)
+{
+  if(width == 0 || height == 0) { return; }
+  sample();
+  m_page       = std::max<std::size_t>(height - 1, 1);
+  m_view_width = width;
+  scroll_to(m_top);
+  fetch(std::min(height - 1, m_rows - m_top));
+  // The cells shown may have widened the columns
+  const std::size_t total{this->width()};
+  m_left = std::min(m_left, total > width ? total - width : 0);
+  std::vector<std::string> titles;
+  for(const Column& col: m_columns) { titles.push_back(col.title); }
+  window.print_str(column, row, line(titles, width));
+  window.fill_style(column, row, column + width - 1, row, Term::Style::Bold);
+  for(std::size_t i = 0; i != m_cache.size(); ++i) { window.print_str(column, row + 1 + i, line(m_cache[i], width)); }
+}
+
+void Term::Table::sample()
+{
+  if(m_sampled) { return; }
+  m_sampled = true;
+  for(std::size_t i = 0; i != m_columns.size(); ++i) { m_widths[i] = m_columns[i].width != 0 ? m_columns[i].width : Term::Private::visible_width(m_columns[i].title); }
+  // Rows spread evenly from the first to the last
+  const std::size_t count{std::min(m_samples, m_rows)};
+  for(std::size_t i = 0; i != count; ++i) { measure(m_provider(count == 1 ? 0 : i * (m_rows - 1) / (count - 1))); }
+}
+
+void Term::Table::fetch(const std::size_t& count)
+{
+  // The rows already cached are kept, only the new ones are asked for and measured
+  std::vector<std::vector<std::string>> cache(count);
+  for(std::size_t i = 0; i != count; ++i)
+  {
+    const std::size_t row{m_top + i};
+    if(row >= m_cache_top && row < m_cache_top + m_cache.size()) { cache[i] = std::move(m_cache[row - m_cache_top]); }
+    else
+    {
+      cache[i] = m_provider(row);
+      measure(cache[i]);
+    }
+  }
+  m_cache     = std::move(cache);
+  m_cache_top = m_top;
+}
+
+void Term::Table::measure(const std::vector<std::string>& cells)
+{
+  for(std::size_t i = 0; i != std::min(cells.size(), m_columns.size()); ++i)
+  {
+    if(m_columns[i].width == 0) { m_widths[i] = std::max(m_widths[i], std::min(ascii(cells[i]) ? cells[i].size() : Term::Private::visible_width(cells[i]), m_columns[i].max_width)); }
+  }
+}
+
+std::string Term::Table::line(const std::vector<std::string>& cells, const std::size_t& width) const
+{
+  // Only the cells and separators in [m_left, m_left + width) are laid out, from the column first
+  std::string ret;
+  std::size_t x{0};
+  std::size_t first{m_left};
+  for(std::size_t i = 0; i != m_columns.size() && x < m_left + width; ++i)
+  {
+    if(x + m_widths[i] > m_left)
+    {
+      if(ret.empty()) { first = x; }
+      ret += fit(i < cells.size() ? cells[i] : std::string(), m_widths[i], m_columns[i].align);
+    }
+    x += m_widths[i];
+    if(i + 1 == m_columns.size()) { break; }
+    if(x + separator_width > m_left && x < m_left + width)
+    {
+      if(ret.empty()) { first = x; }
+      ret += separator;
+    }
+    x += separator_width;
+  }
+  // Cut only when the edges of the view cut a cell
+  return first == m_left && x <= m_left + width ? ret : Term::Private::visible_columns(ret, m_left - first, width);
+}
@@ -0,0 +1,130 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Term
+{
+
+class Window;
+
+///
+/// @brief A table of any number of rows, asked for to a callback as they are shown : a page costs the cells it shows, whatever the size of the table.
+///
+/// The widths of the columns come from a sample of rows spread over the table, then grow (up to a maximum) with the wider cells shown ; a cell wider than its column is cut with '…'.
+/// The header stays at the top, the table scrolls vertically by rows and horizontally by cells. The rows shown are cached, scrolling asks for the new ones only.
+///
+class Table
+{
+public:
+  enum class Align : std::uint8_t
+  {
+    Left,
+    Right,
+    Center
+  };
+
+  struct Column
+  {
+    Column(const std::string& column_title, const Align& column_align = Align::Left, const std::size_t& column_width = 0, const std::size_t& column_max_width = 40);
+    std::string title;
+    Align       align;
+    std::size_t width;      ///< 0 to size the column from its cells.
+    std::size_t max_width;  ///< The widest its cells can make the column.
+  };
+
+  ///
+  /// @brief The cells of a row, numbered from 0. Missing cells are empty.
+  ///
+  using Rows = std::function<std::vector<std::string>(const std::size_t& row)>;
+
+  ///
+  /// @brief A table of \b rows rows given by \b provider , \b samples of them measured to size the columns.
+  ///
+  Table(const std::vector<Column>& columns, const std::size_t& rows, const Rows& provider, const std::size_t& samples = 128);
+
+  std::size_t rows() const;
+
+  ///
+  /// @brief The table has now \b rows rows, the rows already seen are kept.
+  ///
+  void set_rows(const std::size_t& rows);
+
+  ///
+  /// @brief Forget the rows seen, they will be asked for again.
+  ///
+  void refresh();
+
+  ///
+  /// @brief Scroll down \b rows (up if negative), no further than the last page.
+  ///
+  void scroll(const long& rows);
+  void scroll_to(const std::size_t& row);
+
+  ///
+  /// @brief Scroll right \b columns cells (left if negative), no further than the right edge of the table.
+  ///
+  void scroll_columns(const long& columns);
+
+  ///
+  /// @brief The first row shown.
+  ///
+  std::size_t top() const;
+
+  ///
+  /// @brief The first cell shown from the left edge of the table.
+  ///
+  std::size_t left() const;
+
+  ///
+  /// @brief The rows a page shows, as of the last \b render .
+  ///
+  std::size_t page() const;
+
+  ///
+  /// @brief The width of \b column , from the rows sampled and shown so far.
+  ///
+  std::size_t column_width(const std::size_t& column);
+
+  ///
+  /// @brief The width of the table, columns and separators.
+  ///
+  std::size_t width();
+
+  ///
+  /// @brief Draw the header and the rows from \b top in the \b width x \b height cells of \b window from \b column , \b row (from 1).
+  ///
+  void render(Term::Window& window, const std::size_t& column, const std::size_t& row, const std::size_t& width, const std::size_t& height);
+
+private:
+  void                                  sample();
+  void                                  fetch(const std::size_t& count);
+  void                                  measure(const std::vector<std::string>& cells);
+  std::string                           line(const std::vector<std::string>& cells, const std::size_t& width) const;
+  std::vector<Column>                   m_columns;
+  std::vector<std::size_t>              m_widths;
+  std::size_t                           m_rows{0};
+  Rows                                  m_provider;
+  std::size_t                           m_samples{0};
+  bool                                  m_sampled{false};
+  std::size_t                           m_top{0};
+  std::size_t                           m_left{0};
+  std::size_t                           m_page{1};
+  std::size_t                           m_view_width{0};
+  std::size_t                           m_cache_top{0};  ///< The row of \b m_cache[0] .
+  std::vector<std::vector<std::string>> m_cache;
+};
+
+}  // namespace Term
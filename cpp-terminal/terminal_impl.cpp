@@ -19,6 +19,60 @@
 #include "cpp-terminal/style.hpp"
 #include "cpp-terminal/terminal.hpp"
 
+#include <chrono>
+#include <string>
+
+#if !defined(_WIN32)
+  #include <poll.h>
+  #include <termios.h>
+#endif
+
+namespace
+{
+
+// Send graphics_query() and read until the DA1 reply arrives, for at most 200ms
+Term::Graphics probe_graphics()
+{
+#if defined(_WIN32)
+  return Term::Graphics::None;
+#else
+  if(Term::Private::in.null() || Term::Private::out.null()) { return Term::Graphics::None; }
+  Term::Private::in.lockIO();
+  ::termios actual;
+  if(tcgetattr(Term::Private::out.fd(), &actual) == -1)
+  {
+    Term::Private::in.unlockIO();
+    return Term::Graphics::None;
+  }
+  ::termios raw = actual;
+  raw.c_lflag &= ~(ECHO | ICANON | IEXTEN);
+  raw.c_cc[VMIN]  = 1;
+  raw.c_cc[VTIME] = 0;
+  tcsetattr(Term::Private::out.fd(), TCSAFLUSH, &raw);
+  Term::Private::out.write(Term::graphics_query());
+  // Every terminal answers DA1, after the kitty reply if any: wait for it instead of a fixed delay
+  std::string                                 reply;
+  const std::chrono::steady_clock::time_point deadline{std::chrono::steady_clock::now() + std::chrono::milliseconds(200)};
+  while(true)
+  {
+    const std::size_t da1{reply.find("\u001b[?")};
+    if(da1 != std::string::npos && reply.find('c', da1) != std::string::npos) { break; }
+    const std::chrono::steady_clock::duration left{deadline - std::chrono::steady_clock::now()};
+    ::pollfd                                  input;
+    input.fd      = Term::Private::in.fd();
+    input.events  = POLLIN;
+    input.revents = 0;
+    if(left <= std::chrono::steady_clock::duration::zero() || ::poll(&input, 1, static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(left).count()) + 1) <= 0) { break; }
+    reply += Term::Private::in.read();
+  }
+  tcsetattr(Term::Private::out.fd(), TCSAFLUSH, &actual);
+  Term::Private::in.unlockIO();
+  return Term::graphics_support(reply);
+#endif
+}
+
+}  // namespace
+
 Term::Options Term::Terminal::getOptions() const noexcept { return m_options; }
 
 Term::Terminal::Terminal()
@@ -32,6 +86,16 @@ Term::Terminal::Terminal()
 
 bool Term::Terminal::supportUTF8() { return m_terminfo.hasUTF8(); }
 
+Term::Graphics Term::Terminal::supportGraphics()
+{
+  if(!m_graphicsChecked)
+  {
+    m_graphics        = probe_graphics();
+    m_graphicsChecked = true;
+  }
+  return m_graphics;
+}
+
 Term::Terminal::~Terminal()
 {
   try
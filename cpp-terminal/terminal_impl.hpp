@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "cpp-terminal/graphics.hpp"
 #include "cpp-terminal/options.hpp"
 #include "cpp-terminal/terminal_initializer.hpp"
 #include "cpp-terminal/terminfo.hpp"
@@ -28,6 +29,10 @@ public:
   Terminal&                       operator=(Terminal&&)      = delete;
   Terminal&                       operator=(const Terminal&) = delete;
   bool                            supportUTF8();
+  ///
+  /// @brief The inline image protocols of the terminal. It is asked (\b graphics_query() ) on the first call only, which waits at most 200ms for its reply : programs not drawing images never wait for it nor lose the keys typed meanwhile.
+  ///
+  Term::Graphics                  supportGraphics();
   template<typename... Args> void setOptions(const Args&&... args)
   {
     m_options = {args...};
@@ -47,6 +52,8 @@ private:
   void           set_unset_utf8();
   Term::Terminfo m_terminfo;
   Term::Options  m_options;
+  Term::Graphics m_graphics{Term::Graphics::None};
+  bool           m_graphicsChecked{false};
 };
 
 }  // namespace Term
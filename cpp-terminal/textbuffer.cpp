@@ -0,0 +1,370 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/textbuffer.hpp"
+
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/private/mapped_file.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+namespace
+{
+const std::size_t npos{static_cast<std::size_t>(-1)};
+}
+
+std::size_t Term::TextBuffer::Snapshot::size() const { return m_size; }
+
+Term::TextBuffer::TextBuffer(const std::string& text)
+{
+  if(text.empty()) { return; }
+  m_original = std::make_shared<const Term::Private::MappedFile>(Term::Private::MappedFile::from_string(text));
+  m_pieces.push_back({0, text.size(), false});
+  refresh(0);
+}
+
+Term::TextBuffer Term::TextBuffer::open(const std::string& path)
+{
+  Term::TextBuffer ret;
+  ret.m_original = std::make_shared<const Term::Private::MappedFile>(path);
+  if(ret.m_original->size() != 0) { ret.m_pieces.push_back({0, ret.m_original->size(), false}); }
+  ret.refresh(0);
+  return ret;
+}
+
+std::size_t Term::TextBuffer::size() const { return m_size; }
+
+bool Term::TextBuffer::empty() const { return m_size == 0; }
+
+char Term::TextBuffer::operator[](const std::size_t& position) const
+{
+  const std::size_t piece{piece_of(position)};
+  return data(m_pieces[piece])[position - m_offsets[piece]];
+}
+
+std::string Term::TextBuffer::substr(const std::size_t& position, const std::size_t& count) const
+{
+  if(position > m_size) { throw Term::Exception("TextBuffer::substr(): position out of range"); }
+  const std::size_t end{position + std::min(count, m_size - position)};
+  std::string       ret;
+  ret.reserve(end - position);
+  for(std::size_t piece = piece_of(position); piece < m_pieces.size() && m_offsets[piece] < end; ++piece)
+  {
+    const std::size_t begin{std::max(position, m_offsets[piece])};
+    ret.append(data(m_pieces[piece]) + (begin - m_offsets[piece]), std::min(end, m_offsets[piece] + m_pieces[piece].length) - begin);
+  }
+  return ret;
+}
+
+std::string Term::TextBuffer::str() const { return substr(0, m_size); }
+
+void Term::TextBuffer::insert(const std::size_t& position, const std::string& text)
+{
+  if(position > m_size) { throw Term::Exception("TextBuffer::insert(): position out of range"); }
+  if(text.empty()) { return; }
+  const Piece       added{m_added.size(), text.size(), true};
+  const std::size_t piece{piece_of(position)};
+  for(std::size_t i = 0; i != text.size(); ++i)
+  {
+    if(text[i] == '\n') { m_added_newlines.push_back(m_added.size() + i); }
+  }
+  m_added += text;
+  // Typing extends the piece the previous character went to, without a new undo step
+  const bool at_boundary{piece == m_pieces.size() || m_offsets[piece] == position};
+  if(position == m_typing && at_boundary && piece != 0 && m_pieces[piece - 1].added && m_pieces[piece - 1].start + m_pieces[piece - 1].length == added.start && !m_undo.empty() && piece - 1 >= m_undo.back().index && piece - 1 < m_undo.back().index + m_undo.back().inserted.size())
+  {
+    m_pieces[piece - 1].length += text.size();
+    m_undo.back().inserted[piece - 1 - m_undo.back().index].length += text.size();
+    refresh(piece - 1);
+  }
+  else if(at_boundary) { replace(piece, 0, {added}); }
+  else
+  {
+    const Piece&      split{m_pieces[piece]};
+    const std::size_t before{position - m_offsets[piece]};
+    replace(piece, 1, {{split.start, before, split.added}, added, {split.start + before, split.length - before, split.added}});
+  }
+  // A new line is a new undo step
+  m_typing = text.back() == '\n' ? npos : position + text.size();
+}
+
+void Term::TextBuffer::erase(const std::size_t& position, const std::size_t& count)
+{
+  if(position > m_size) { throw Term::Exception("TextBuffer::erase(): position out of range"); }
+  const std::size_t end{position + std::min(count, m_size - position)};
+  if(end == position) { return; }
+  const std::size_t  first{piece_of(position)};
+  const std::size_t  last{piece_of(end - 1)};
+  std::vector<Piece> kept;
+  if(position != m_offsets[first]) { kept.push_back({m_pieces[first].start, position - m_offsets[first], m_pieces[first].added}); }
+  const std::size_t after{m_offsets[last] + m_pieces[last].length - end};
+  if(after != 0) { kept.push_back({m_pieces[last].start + m_pieces[last].length - after, after, m_pieces[last].added}); }
+  replace(first, last - first + 1, kept);
+  m_typing = npos;
+}
+
+std::size_t Term::TextBuffer::lines() const { return newlines_before(m_pieces.size()) + 1; }
+
+std::size_t Term::TextBuffer::line_begin(const std::size_t& line) const
+{
+  if(line == 0) { return 0; }
+  const std::size_t found{newline(line - 1)};
+  if(found == npos) { throw Term::Exception("TextBuffer::line_begin(): line out of range"); }
+  return found + 1;
+}
+
+std::size_t Term::TextBuffer::line_end(const std::size_t& line) const
+{
+  const std::size_t found{newline(line)};
+  if(found != npos) { return found; }
+  if(line != 0 && newline(line - 1) == npos) { throw Term::Exception("TextBuffer::line_end(): line out of range"); }
+  return m_size;
+}
+
+std::size_t Term::TextBuffer::line_of(const std::size_t& position) const
+{
+  if(position > m_size) { throw Term::Exception("TextBuffer::line_of(): position out of range"); }
+  const std::size_t piece{piece_of(position)};
+  if(piece == m_pieces.size()) { return newlines_before(piece); }
+  return newlines_before(piece) + count_newlines(m_pieces[piece], position - m_offsets[piece]);
+}
+
+std::string Term::TextBuffer::line(const std::size_t& line) const
+{
+  const std::size_t begin{line_begin(line)};
+  return substr(begin, line_end(line) - begin);
+}
+
+Term::Search::Match Term::TextBuffer::find(const Term::Search& search, const std::size_t& from, const std::size_t& limit) const
+{
+  const std::size_t end{std::min(limit, m_size)};
+  for(std::size_t position = from; position < end;)
+  {
+    const std::size_t index{piece_of(position)};
+    const Piece&      piece{m_pieces[index]};
+    const char*       text{data(piece)};
+    const std::size_t offset{m_offsets[index]};
+    // [first, last) are the lines wholly in the piece
+    std::size_t first{offset};
+    if(offset != 0 && (*this)[offset - 1] != '\n')
+    {
+      const void* newline{std::memchr(text, '\n', piece.length)};
+      first = newline == nullptr ? offset + piece.length : offset + static_cast<std::size_t>(static_cast<const char*>(newline) - text) + 1;
+    }
+    std::size_t last{offset + piece.length};
+    if(last != m_size)
+    {
+      last = offset;
+      for(std::size_t i = piece.length; i != 0; --i)
+      {
+        if(text[i - 1] == '\n')
+        {
+          last = offset + i;
+          break;
+        }
+      }
+    }
+    if(position >= first && position < last)
+    {
+      const Term::Search::Match match{search.find(text + (first - offset), last - first, position - first, std::min(end, last) - first)};
+      if(match.found()) { return {first + match.position, match.length}; }
+      position = last;
+      continue;
+    }
+    // A line cut by the start or the end of the piece
+    std::size_t begin{position};
+    while(begin != 0 && (*this)[begin - 1] != '\n') { --begin; }
+    std::size_t line_end{position};
+    while(line_end != m_size && (*this)[line_end] != '\n') { ++line_end; }
+    const std::string         line{substr(begin, line_end - begin)};
+    const Term::Search::Match match{search.find(line.data(), line.size(), position - begin, std::min(end, line_end + 1) - begin)};
+    if(match.found()) { return {begin + match.position, match.length}; }
+    position = line_end + 1;
+  }
+  return {};
+}
+
+Term::Search::Match Term::TextBuffer::rfind(const Term::Search& search, const std::size_t& from, const std::size_t& limit) const
+{
+  // The windows grow from 64 KB: a match near limit is found without searching much
+  std::size_t window{64 * 1024};
+  for(std::size_t end = std::min(limit, m_size); end > from; window = std::min<std::size_t>(window * 2, 64 * 1024 * 1024))
+  {
+    const std::size_t   begin{end - std::min(end - from, window)};
+    Term::Search::Match last;
+    for(Term::Search::Match match = find(search, begin, end); match.found(); match = find(search, match.position + 1, end)) { last = match; }
+    if(last.found()) { return last; }
+    end = begin;
+  }
+  return {};
+}
+
+Term::TextBuffer::Snapshot Term::TextBuffer::snapshot() const
+{
+  Snapshot ret;
+  ret.m_pieces = m_pieces;
+  ret.m_size   = m_size;
+  return ret;
+}
+
+void Term::TextBuffer::restore(const Snapshot& snapshot)
+{
+  replace(0, m_pieces.size(), snapshot.m_pieces);
+  m_typing = npos;
+}
+
+bool Term::TextBuffer::undo()
+{
+  if(m_undo.empty()) { return false; }
+  m_redo.push_back(std::move(m_undo.back()));
+  m_undo.pop_back();
+  apply(m_redo.back(), false);
+  m_typing = npos;
+  return true;
+}
+
+bool Term::TextBuffer::redo()
+{
+  if(m_redo.empty()) { return false; }
+  m_undo.push_back(std::move(m_redo.back()));
+  m_redo.pop_back();
+  apply(m_undo.back(), true);
+  m_typing = npos;
+  return true;
+}
+
+void Term::TextBuffer::save(const std::string& path) const
+{
+  // Reading a mapping past the end of a truncated file would crash
+  if(m_original != nullptr && !m_original->intact()) { throw Term::Exception("TextBuffer::save(): the file opened was truncated by another process"); }
+  const std::string temporary{path + ".tmp"};
+  std::ofstream     file(temporary, std::ios::binary | std::ios::trunc);
+  for(std::size_t piece = 0; piece != m_pieces.size() && file; ++piece) { file.write(data(m_pieces[piece]), static_cast<std::streamsize>(m_pieces[piece].length)); }
+  file.close();
+  if(file.fail())
+  {
+    std::remove(temporary.c_str());
+    throw Term::Exception("TextBuffer::save(): cannot write " + temporary);
+  }
+#if defined(_WIN32)
+  std::remove(path.c_str());  // rename does not replace a file there
+#endif
+  if(std::rename(temporary.c_str(), path.c_str()) != 0)
+  {
+    std::remove(temporary.c_str());
+    throw Term::Exception("TextBuffer::save(): cannot replace " + path);
+  }
+}
+
+const char* Term::TextBuffer::data(const Piece& piece) const { return (piece.added ? m_added.data() : m_original->data()) + piece.start; }
+
+std::size_t Term::TextBuffer::find_newline(const Piece& piece, const std::size_t& rank) const
+{
+  const std::size_t end{piece.start + piece.length};
+  if(piece.added)
+  {
+    const std::size_t index{static_cast<std::size_t>(std::lower_bound(m_added_newlines.begin(), m_added_newlines.end(), piece.start) - m_added_newlines.begin()) + rank};
+    return index < m_added_newlines.size() && m_added_newlines[index] < end ? m_added_newlines[index] - piece.start : npos;
+  }
+  // Index the original text only as far as the newline looked for
+  scan(piece.start, npos);
+  const std::size_t index{static_cast<std::size_t>(std::lower_bound(m_original_newlines.begin(), m_original_newlines.end(), piece.start) - m_original_newlines.begin()) + rank};
+  scan(end, index + 1);
+  return index < m_original_newlines.size() && m_original_newlines[index] < end ? m_original_newlines[index] - piece.start : npos;
+}
+
+std::size_t Term::TextBuffer::count_newlines(const Piece& piece, const std::size_t& length) const
+{
+  const std::vector<std::size_t>& newlines{piece.added ? m_added_newlines : m_original_newlines};
+  if(!piece.added) { scan(piece.start + length, npos); }
+  return static_cast<std::size_t>(std::lower_bound(newlines.begin(), newlines.end(), piece.start + length) - std::lower_bound(newlines.begin(), newlines.end(), piece.start));
+}
+
+void Term::TextBuffer::scan(const std::size_t& end, const std::size_t& newlines) const
+{
+  const char* text{m_original->data()};
+  while(m_scanned < end && m_original_newlines.size() < newlines)
+  {
+    const void* found{std::memchr(text + m_scanned, '\n', end - m_scanned)};
+    if(found == nullptr)
+    {
+      m_scanned = end;
+      break;
+    }
+    m_original_newlines.push_back(static_cast<std::size_t>(static_cast<const char*>(found) - text));
+    m_scanned = m_original_newlines.back() + 1;
+  }
+}
+
+std::size_t Term::TextBuffer::newline(const std::size_t& index) const
+{
+  // In a piece already counted
+  const std::vector<std::size_t>::const_iterator counted{std::upper_bound(m_newlines_before.begin(), m_newlines_before.end(), index)};
+  if(counted != m_newlines_before.end())
+  {
+    const std::size_t piece{static_cast<std::size_t>(counted - m_newlines_before.begin()) - 1};
+    return m_offsets[piece] + find_newline(m_pieces[piece], index - m_newlines_before[piece]);
+  }
+  for(std::size_t piece = m_newlines_before.size() - 1; piece != m_pieces.size(); ++piece)
+  {
+    const std::size_t found{find_newline(m_pieces[piece], index - m_newlines_before[piece])};
+    if(found != npos) { return m_offsets[piece] + found; }
+    m_newlines_before.push_back(m_newlines_before[piece] + count_newlines(m_pieces[piece], m_pieces[piece].length));
+  }
+  return npos;
+}
+
+std::size_t Term::TextBuffer::newlines_before(const std::size_t& piece) const
+{
+  while(m_newlines_before.size() <= piece)
+  {
+    const std::size_t last{m_newlines_before.size() - 1};
+    m_newlines_before.push_back(m_newlines_before[last] + count_newlines(m_pieces[last], m_pieces[last].length));
+  }
+  return m_newlines_before[piece];
+}
+
+std::size_t Term::TextBuffer::piece_of(const std::size_t& position) const
+{
+  if(position >= m_size) { return m_pieces.size(); }
+  return static_cast<std::size_t>(std::upper_bound(m_offsets.begin(), m_offsets.end(), position) - m_offsets.begin()) - 1;
+}
+
+void Term::TextBuffer::replace(const std::size_t& index, const std::size_t& count, const std::vector<Piece>& pieces)
+{
+  Change change;
+  change.index = index;
+  change.removed.assign(m_pieces.begin() + static_cast<std::ptrdiff_t>(index), m_pieces.begin() + static_cast<std::ptrdiff_t>(index + count));
+  change.inserted = pieces;
+  apply(change, true);
+  m_undo.push_back(std::move(change));
+  m_redo.clear();
+}
+
+void Term::TextBuffer::apply(const Change& change, const bool& forward)
+{
+  const std::vector<Piece>& removed{forward ? change.removed : change.inserted};
+  const std::vector<Piece>& inserted{forward ? change.inserted : change.removed};
+  const std::ptrdiff_t      index{static_cast<std::ptrdiff_t>(change.index)};
+  m_pieces.erase(m_pieces.begin() + index, m_pieces.begin() + index + static_cast<std::ptrdiff_t>(removed.size()));
+  m_pieces.insert(m_pieces.begin() + index, inserted.begin(), inserted.end());
+  refresh(change.index);
+}
+
+void Term::TextBuffer::refresh(const std::size_t& index)
+{
+  m_offsets.resize(m_pieces.size());
+  for(std::size_t piece = index; piece < m_pieces.size(); ++piece) { m_offsets[piece] = piece == 0 ? 0 : m_offsets[piece - 1] + m_pieces[piece - 1].length; }
+  m_size = m_pieces.empty() ? 0 : m_offsets.back() + m_pieces.back().length;
+  if(m_newlines_before.size() > index + 1) { m_newlines_before.resize(index + 1); }
+}
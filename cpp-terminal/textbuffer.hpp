@@ -0,0 +1,163 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+#include "cpp-terminal/search.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Term
+{
+
+namespace Private
+{
+class MappedFile;
+}
+
+///
+/// @brief Text stored as a piece table : a sequence of pieces of the original text, memory mapped and never copied, and of an append-only buffer holding everything inserted since.
+///
+/// Opening a file costs nothing whatever its size and an edit costs O(pieces), the pieces being the edits made rather than the lines. The positions of the '\\n' of the original text are indexed lazily, as far as the lines asked for :
+/// the start of the first lines of a huge file is found without reading the rest of it, \b lines() reads it once. Every edit is undoable, typing a run of characters being one step, and a \b Snapshot costs a copy of the pieces.
+/// Positions are in bytes, lines are numbered from 0. The index is built by const functions : a TextBuffer is not thread safe, even to read.
+///
+class TextBuffer
+{
+private:
+  struct Piece
+  {
+    std::size_t start;  ///< In the buffer of the piece.
+    std::size_t length;
+    bool        added;  ///< In the append buffer, otherwise in the original text.
+  };
+
+public:
+  ///
+  /// @brief The text at some point, to \b restore later. It only holds the pieces, it is valid for the buffer it comes from (and its copies).
+  ///
+  class Snapshot
+  {
+  public:
+    std::size_t size() const;
+
+  private:
+    friend class TextBuffer;
+    std::vector<Piece> m_pieces;
+    std::size_t        m_size{0};
+  };
+
+  TextBuffer() = default;
+  explicit TextBuffer(const std::string& text);
+
+  ///
+  /// @brief The text of the file at \b path , mapped rather than read.
+  ///
+  /// The file must not be truncated while the buffer is used (replacing it is fine) : reading the text mapped past its new end raises SIGBUS. \b save() checks it first and throws instead.
+  ///
+  static TextBuffer open(const std::string& path);
+
+  std::size_t size() const;
+  bool        empty() const;
+  char        operator[](const std::size_t& position) const;
+  std::string substr(const std::size_t& position, const std::size_t& count) const;
+  std::string str() const;
+
+  void insert(const std::size_t& position, const std::string& text);
+  void erase(const std::size_t& position, const std::size_t& count);
+
+  ///
+  /// @brief Number of lines: one more than the number of '\\n'.
+  ///
+  std::size_t lines() const;
+
+  ///
+  /// @brief Position of the first character of \b line .
+  ///
+  std::size_t line_begin(const std::size_t& line) const;
+
+  ///
+  /// @brief Position of the '\\n' ending \b line , \b size() for the last line.
+  ///
+  std::size_t line_end(const std::size_t& line) const;
+
+  ///
+  /// @brief The line containing \b position (the '\\n' ending a line belongs to it).
+  ///
+  std::size_t line_of(const std::size_t& position) const;
+
+  ///
+  /// @brief The text of \b line , without its '\\n'.
+  ///
+  std::string line(const std::size_t& line) const;
+
+  ///
+  /// @brief The first match of \b search starting in [ \b from , \b limit ). The lines wholly in a piece are searched where they are, in chunks on every core when they are large, the lines cut by an edit are copied.
+  ///
+  Term::Search::Match find(const Term::Search& search, const std::size_t& from = 0, const std::size_t& limit = static_cast<std::size_t>(-1)) const;
+
+  ///
+  /// @brief The last match of \b search starting in [ \b from , \b limit ), searched backward from \b limit in growing windows.
+  ///
+  Term::Search::Match rfind(const Term::Search& search, const std::size_t& from = 0, const std::size_t& limit = static_cast<std::size_t>(-1)) const;
+
+  Snapshot snapshot() const;
+  ///
+  /// @brief Go back to \b snapshot , as an edit which can be undone.
+  ///
+  void restore(const Snapshot& snapshot);
+
+  ///
+  /// @brief Undo the last edit.
+  ///
+  /// @return Whether there was one.
+  ///
+  bool undo();
+  bool redo();
+
+  ///
+  /// @brief Write the text to \b path . It is written to a temporary file renamed over \b path , so a file the buffer maps is replaced rather than overwritten.
+  ///
+  void save(const std::string& path) const;
+
+private:
+  struct Change
+  {
+    std::size_t        index{0};  ///< Of the first piece replaced.
+    std::vector<Piece> removed;
+    std::vector<Piece> inserted;
+  };
+  const char*                                data(const Piece& piece) const;
+  std::size_t                                find_newline(const Piece& piece, const std::size_t& rank) const;
+  std::size_t                                count_newlines(const Piece& piece, const std::size_t& length) const;
+  void                                       scan(const std::size_t& end, const std::size_t& newlines) const;
+  std::size_t                                newline(const std::size_t& index) const;
+  std::size_t                                newlines_before(const std::size_t& piece) const;
+  std::size_t                                piece_of(const std::size_t& position) const;
+  void                                       replace(const std::size_t& index, const std::size_t& count, const std::vector<Piece>& pieces);
+  void                                       apply(const Change& change, const bool& forward);
+  void                                       refresh(const std::size_t& index);
+  std::shared_ptr<const Private::MappedFile> m_original;
+  std::string                                m_added;
+  std::vector<std::size_t>                   m_added_newlines;                        ///< Positions of the '\\n' in m_added.
+  mutable std::vector<std::size_t>           m_original_newlines;                     ///< Positions of the '\\n' in the original text, up to m_scanned.
+  mutable std::size_t                        m_scanned{0};
+  std::vector<Piece>                         m_pieces;
+  std::vector<std::size_t>                   m_offsets;                               ///< Position of each piece.
+  std::size_t                                m_size{0};
+  mutable std::vector<std::size_t>           m_newlines_before{0};                    ///< Number of '\\n' before each piece, for the first pieces.
+  std::vector<Change>                        m_undo;
+  std::vector<Change>                        m_redo;
+  std::size_t                                m_typing{static_cast<std::size_t>(-1)};  ///< Where the last insert ended, if the next one can extend it.
+};
+
+}  // namespace Term
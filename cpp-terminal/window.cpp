@@ -12,12 +12,45 @@
 #include "cpp-terminal/color.hpp"
 #include "cpp-terminal/cursor.hpp"
 #include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/private/grapheme.hpp"
 #include "cpp-terminal/private/unicode.hpp"
+#include "cpp-terminal/private/wcwidth.hpp"
 #include "cpp-terminal/prompt.hpp"
 #include "cpp-terminal/terminal.hpp"
 
 #include <cstddef>
 
+namespace
+{
+// Second cell of a wide character, it is covered by the first one and not rendered
+const constexpr char32_t continuation{0xFFFFFFFF};
+
+// A cell holding more than one code point is either
+// - packed: packed_cluster | mark << mark_shift | code point, the code point followed by one of the marks below
+// - interned: first_cluster + index in m_clusters
+const constexpr char32_t      first_cluster{0x110000};
+const constexpr char32_t      packed_cluster{0x80000000};
+const constexpr std::uint32_t mark_shift{21};
+
+// Marks that can be packed, numbered from 1: combining diacritical marks, text and emoji presentation selectors, skin tones and the keycap
+std::uint32_t mark_number(const char32_t& mark)
+{
+  if(mark >= 0x0300 && mark <= 0x036F) { return mark - 0x0300 + 1; }
+  if(mark == U'\uFE0E' || mark == U'\uFE0F') { return mark - 0xFE0E + 113; }
+  if(mark >= 0x1F3FB && mark <= 0x1F3FF) { return mark - 0x1F3FB + 115; }
+  if(mark == U'\u20E3') { return 120; }
+  return 0;
+}
+
+char32_t mark(const std::uint32_t& number)
+{
+  if(number <= 112) { return 0x0300 + number - 1; }
+  if(number <= 114) { return 0xFE0E + number - 113; }
+  if(number <= 119) { return 0x1F3FB + number - 115; }
+  return U'\u20E3';
+}
+}  // namespace
+
 namespace Term
 {
 
@@ -41,8 +74,59 @@ std::size_t Term::Window::get_h() const { return m_window.rows(); }
 
 void Term::Window::set_char(const std::size_t& column, const std::size_t& row, const char32_t& character)
 {
-  if(insideWindow(column, row)) { m_chars[index(column, row)] = character; }
-  else { throw Term::Exception("set_char(): (x,y) out of bounds"); }
+  if(!insideWindow(column, row)) { throw Term::Exception("set_char(): (x,y) out of bounds"); }
+  place(column, row, character, Private::wcwidth(character));
+}
+
+void Term::Window::set_cluster(const std::size_t& column, const std::size_t& row, const char32_t* cluster, const std::size_t& size)
+{
+  char32_t            cell{cluster[0]};
+  const std::uint32_t number{size == 2 ? mark_number(cluster[1]) : 0};
+  if(size == 1) {}
+  else if(number != 0) { cell = packed_cluster | (number << mark_shift) | cluster[0]; }
+  else
+  {
+    const std::u32string                                               key(cluster, size);
+    const std::unordered_map<std::u32string, char32_t>::const_iterator found{m_cluster_cells.find(key)};
+    if(found != m_cluster_cells.end()) { cell = found->second; }
+    else
+    {
+      cell = first_cluster + static_cast<char32_t>(m_clusters.size());
+      m_clusters.push_back(key);
+      m_cluster_cells.emplace(key, cell);
+    }
+  }
+  place(column, row, cell, Private::grapheme_width(cluster, size));
+}
+
+void Term::Window::place(const std::size_t& column, const std::size_t& row, const char32_t& cell, const int& width)
+{
+  if(width != 2) { put(column, row, cell); }
+  else if(column == m_window.columns()) { put(column, row, U' '); }  // No room for the second half
+  else
+  {
+    put(column, row, cell);
+    put(column + 1, row, continuation);
+  }
+}
+
+void Term::Window::append_cluster(std::string& out, const char32_t& cell) const
+{
+  if(cell >= packed_cluster)
+  {
+    Private::append_utf8(out, cell & ((1U << mark_shift) - 1));
+    Private::append_utf8(out, mark((cell & ~packed_cluster) >> mark_shift));
+  }
+  else { Private::append_utf8(out, m_clusters[cell - first_cluster].data(), m_clusters[cell - first_cluster].size()); }
+}
+
+void Term::Window::put(const std::size_t& column, const std::size_t& row, const char32_t& character)
+{
+  const std::size_t cell{index(column, row)};
+  // Overwriting half of a wide character blanks the other half
+  if(m_chars[cell] == continuation) { m_chars[cell - 1] = U' '; }
+  else if(column < m_window.columns() && m_chars[cell + 1] == continuation) { m_chars[cell + 1] = U' '; }
+  m_chars[cell] = character;
 }
 
 void Term::Window::set_fg_reset(const std::size_t& column, const std::size_t& row)
@@ -85,7 +169,7 @@ void Term::Window::set_h(const std::size_t& new_h)
     m_fg.insert(m_fg.end(), dc, {0, 0, 0});
     m_bg.insert(m_bg.end(), dc, {0, 0, 0});
     m_style.insert(m_style.end(), dc, Style::Reset);
-    m_window = {m_window.columns(), new_h};
+    m_window = {new_h, m_window.columns()};
   }
   else { throw Term::Exception("Shrinking height not supported."); }
 }
@@ -95,9 +179,11 @@ void Term::Window::print_str(const std::size_t& x, const std::size_t& y, const s
   std::u32string s2   = Private::utf8_to_utf32(s);
   std::size_t    xpos = x;
   std::size_t    ypos = y;
-  for(char32_t i: s2)
+  std::size_t    size = 0;
+  for(std::size_t i = 0; i < s2.size(); i += size)
   {
-    if(i == U'\n')
+    size = Private::grapheme_size(&s2[i], s2.size() - i);
+    if(s2[i + size - 1] == U'\n')  // LF or CR LF
     {
       xpos = x + indent;
       ypos++;
@@ -109,9 +195,11 @@ void Term::Window::print_str(const std::size_t& x, const std::size_t& y, const s
     }
     else
     {
-      if(insideWindow(xpos, ypos)) { set_char(xpos, y, i); }
+      const int width{Private::grapheme_width(&s2[i], size)};
+      if(width < 1) { continue; }  // Zero width and control characters do not take a cell
+      if(insideWindow(xpos + static_cast<std::size_t>(width) - 1, ypos)) { set_cluster(xpos, ypos, &s2[i], size); }
       else { return; }
-      ++xpos;
+      xpos += static_cast<std::size_t>(width);
     }
   }
   if(move_cursor) { m_cursor = {ypos, xpos}; }
@@ -191,106 +279,198 @@ void Term::Window::clear()
   m_fg_reset.assign(area, true);
   m_fg.assign(area, Term::Color::Name::Default);
   m_chars.assign(area, ' ');
+  m_clusters.clear();
+  m_cluster_cells.clear();
 }
 
 std::string Term::Window::render(const std::size_t& x0, const std::size_t& y0, bool term)
 {
   std::string out;
   if(term) { out.append(cursor_off()); }
-  Color current_fg       = Term::Color::Name::Default;
-  Color current_bg       = Term::Color::Name::Default;
-  bool  current_fg_reset = true;
-  bool  current_bg_reset = true;
-  Style current_style    = Style::Reset;
+  Pen pen;
   for(std::size_t j = 1; j <= m_window.rows(); ++j)
   {
     if(term) { out.append(cursor_move(y0 + j - 1, x0)); }
-    for(std::size_t i = 1; i <= m_window.columns(); ++i)
+    render_cells(out, j, 1, m_window.columns(), pen);
+    if(j < m_window.rows()) { out.append("\n"); }
+  }
+  reset_pen(out, pen);
+  if(term)
+  {
+    out.append(cursor_move(y0 + (m_cursor.row() - 1), x0 + (m_cursor.column() - 1)));
+    out.append(cursor_on());
+  }
+  return out;
+}
+
+std::string Term::Window::render(const std::size_t& x0, const std::size_t& y0, const Window& previous)
+{
+  // Rewriting a few unchanged cells is shorter than the escape sequence moving over them
+  const constexpr std::size_t max_gap{6};
+  const std::size_t           columns{m_window.columns()};
+  std::string                 out;
+  Pen                         pen;
+  const bool                  comparable{previous.m_window.columns() == columns};
+  for(std::size_t j = 1; j <= m_window.rows(); ++j)
+  {
+    const bool        known{comparable && j <= previous.m_window.rows()};
+    const std::size_t row{(j - 1) * columns};  // cell of column i is row + i - 1
+    std::size_t       i{1};
+    while(i <= columns)
     {
-      bool update_fg       = false;
-      bool update_bg       = false;
-      bool update_fg_reset = false;
-      bool update_bg_reset = false;
-      bool update_style    = false;
-      if(current_fg_reset != get_fg_reset(i, j))
+      if(known && same(row + i - 1, previous))
       {
-        current_fg_reset = get_fg_reset(i, j);
-        if(current_fg_reset)
-        {
-          update_fg_reset = true;
-          current_fg      = {255, 255, 255};
-        }
+        ++i;
+        continue;
       }
-
-      if(current_bg_reset != get_bg_reset(i, j))
+      // Start on the first half of a wide character, here or on the screen
+      std::size_t first{i};
+      while(first > 1 && (m_chars[row + first - 1] == continuation || (known && previous.m_chars[row + first - 1] == continuation))) { --first; }
+      std::size_t last{i};
+      std::size_t gap{0};
+      for(++i; i <= columns && gap <= max_gap; ++i)
       {
-        current_bg_reset = get_bg_reset(i, j);
-        if(current_bg_reset)
+        if(known && same(row + i - 1, previous)) { ++gap; }
+        else
         {
-          update_bg_reset = true;
-          current_bg      = {255, 255, 255};
+          last = i;
+          gap  = 0;
         }
       }
+      while(last < columns && m_chars[row + last] == continuation) { ++last; }
+      i = last + 1;
+      if(out.empty()) { out.append(cursor_off()); }
+      out.append(cursor_move(y0 + j - 1, x0 + first - 1));
+      render_cells(out, j, first, last, pen);
+    }
+  }
+  if(!out.empty())
+  {
+    reset_pen(out, pen);
+    out.append(cursor_move(y0 + (m_cursor.row() - 1), x0 + (m_cursor.column() - 1)));
+    out.append(cursor_on());
+  }
+  else if(!(previous.m_cursor == m_cursor)) { out.append(cursor_move(y0 + (m_cursor.row() - 1), x0 + (m_cursor.column() - 1))); }
+  return out;
+}
 
-      if(!current_fg_reset)
+void Term::Window::render_cells(std::string& out, const std::size_t& j, const std::size_t& first, const std::size_t& last, Pen& pen) const
+{
+  // The characters are encoded by runs of cells sharing the same attributes
+  std::size_t run{index(first, j)};
+  for(std::size_t i = first; i <= last; ++i)
+  {
+    const std::size_t cell{index(i, j)};
+    const char32_t    character{m_chars[cell]};
+    if(character == continuation)
+    {
+      Private::append_utf8(out, &m_chars[run], cell - run);
+      run = cell + 1;
+      continue;
+    }
+    const bool cluster{character >= first_cluster};
+    // Zero width and control characters would shift the rest of the row, they are shown as a blank
+    const bool blank{character < 0x20 || (character >= 0x7F && !cluster && Private::wcwidth(character) < 1)};
+
+    bool update_fg       = false;
+    bool update_bg       = false;
+    bool update_fg_reset = false;
+    bool update_bg_reset = false;
+    bool update_style    = false;
+    if(pen.fg_reset != m_fg_reset[cell])
+    {
+      pen.fg_reset = m_fg_reset[cell];
+      if(pen.fg_reset)
       {
-        if(!(current_fg == get_fg(i, j)))
-        {
-          current_fg = get_fg(i, j);
-          update_fg  = true;
-        }
+        update_fg_reset = true;
+        pen.fg          = {255, 255, 255};
       }
+    }
 
-      if(!current_fg_reset)
+    if(pen.bg_reset != m_bg_reset[cell])
+    {
+      pen.bg_reset = m_bg_reset[cell];
+      if(pen.bg_reset)
       {
-        if(!(current_bg == get_bg(i, j)))
-        {
-          current_bg = get_bg(i, j);
-          update_bg  = true;
-        }
+        update_bg_reset = true;
+        pen.bg          = {255, 255, 255};
       }
-      if(current_style != get_style(i, j))
+    }
+
+    if(!pen.fg_reset)
+    {
+      if(!(pen.fg == m_fg[cell]))
       {
-        current_style = get_style(i, j);
-        update_style  = true;
-        if(current_style == Style::Reset)
-        {
-          // style::reset: reset fg and bg colors too, we have to
-          // set them again if they are non-default, but if fg or
-          // bg colors are reset, we do not update them, as
-          // style::reset already did that.
-          update_fg = !current_fg_reset;
-          update_bg = !current_bg_reset;
-        }
+        pen.fg    = m_fg[cell];
+        update_fg = true;
       }
-      // Set style first, as style::reset will reset colors too
-      if(update_style) { out.append(style(get_style(i, j))); }
-      if(update_fg_reset) { out.append(color_fg(Term::Color::Name::Default)); }
-      else if(update_fg)
+    }
+
+    if(!pen.bg_reset)
+    {
+      if(!(pen.bg == m_bg[cell]))
       {
-        const Term::Color color_tmp = get_fg(i, j);
-        out.append(color_fg(color_tmp));
+        pen.bg    = m_bg[cell];
+        update_bg = true;
       }
-
-      if(update_bg_reset) { out.append(color_bg(Term::Color::Name::Default)); }
-      else if(update_bg)
+    }
+    if(pen.style != m_style[cell])
+    {
+      pen.style    = m_style[cell];
+      update_style = true;
+      if(pen.style == Style::Reset)
       {
-        const Term::Color color_tmp = get_bg(i, j);
-        out.append(color_bg(color_tmp));
+        // style::reset: reset fg and bg colors too, we have to
+        // set them again if they are non-default, but if fg or
+        // bg colors are reset, we do not update them, as
+        // style::reset already did that.
+        update_fg = !pen.fg_reset;
+        update_bg = !pen.bg_reset;
       }
-      out.append(Private::utf32_to_utf8(get_char(i, j)));
     }
-    if(j < m_window.rows()) { out.append("\n"); }
-  }
-  if(!current_fg_reset) { out.append(color_fg(Term::Color::Name::Default)); }
-  if(!current_bg_reset) { out.append(color_bg(Term::Color::Name::Default)); }
-  if(current_style != Style::Reset) { out.append(style(Style::Reset)); }
-  if(term)
-  {
-    out.append(cursor_move(y0 + (m_cursor.row() - 1), x0 + (m_cursor.column() - 1)));
-    out.append(cursor_on());
+    if(blank || cluster || update_style || update_fg_reset || update_fg || update_bg_reset || update_bg)
+    {
+      Private::append_utf8(out, &m_chars[run], cell - run);
+      run = cell;
+    }
+    // Set style first, as style::reset will reset colors too
+    if(update_style) { append_style(out, m_style[cell]); }
+    if(update_fg_reset) { append_color_fg(out, Term::Color::Name::Default); }
+    else if(update_fg) { append_color_fg(out, m_fg[cell]); }
+
+    if(update_bg_reset) { append_color_bg(out, Term::Color::Name::Default); }
+    else if(update_bg) { append_color_bg(out, m_bg[cell]); }
+    if(blank)
+    {
+      out.push_back(' ');
+      ++run;
+    }
+    else if(cluster)
+    {
+      append_cluster(out, character);
+      ++run;
+    }
   }
-  return out;
+  Private::append_utf8(out, &m_chars[run], index(last, j) + 1 - run);
+}
+
+void Term::Window::reset_pen(std::string& out, const Pen& pen) const
+{
+  if(!pen.fg_reset) { append_color_fg(out, Term::Color::Name::Default); }
+  if(!pen.bg_reset) { append_color_bg(out, Term::Color::Name::Default); }
+  if(pen.style != Style::Reset) { append_style(out, Style::Reset); }
+}
+
+bool Term::Window::same(const std::size_t& cell, const Window& other) const
+{
+  const char32_t character{m_chars[cell]};
+  const char32_t other_character{other.m_chars[cell]};
+  if(m_style[cell] != other.m_style[cell] || m_fg_reset[cell] != other.m_fg_reset[cell] || m_bg_reset[cell] != other.m_bg_reset[cell]) { return false; }
+  if(!m_fg_reset[cell] && !(m_fg[cell] == other.m_fg[cell])) { return false; }
+  if(!m_bg_reset[cell] && !(m_bg[cell] == other.m_bg[cell])) { return false; }
+  // Interned clusters are numbered per window
+  if(character >= first_cluster && character < packed_cluster && other_character >= first_cluster && other_character < packed_cluster) { return m_clusters[character - first_cluster] == other.m_clusters[other_character - first_cluster]; }
+  return character == other_character;
 }
 
 std::size_t Term::Window::index(const std::size_t& column, const std::size_t& row) const
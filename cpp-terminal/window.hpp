@@ -15,6 +15,8 @@
 #include "cpp-terminal/style.hpp"
 
 #include <cstddef>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Term
@@ -25,9 +27,10 @@ namespace Term
 ///
 /// Represents a rectangular window, as a 2D array of characters and their attributes.
 /// The render method can convert this internal representation to a string that when printed will show the Window on the screen.
-//
-// @note the characters are represented by char32_t, representing their UTF-32 code point.
-/// The natural way to represent a character in a terminal would be a "unicode grapheme cluster", but due to a lack of a good library for C++ that could handle those, we simply use a Unicode code point as a character.
+///
+/// @note A cell holds an extended grapheme cluster (what the user sees as one character: a letter and its accents, an emoji ZWJ sequence, a flag...) as segmented by \b print_str .
+/// Most clusters are one code point and are stored as such, a code point followed by a common mark (combining diacritic, variation selector, skin tone) is packed in the cell, and longer clusters are interned in a table of the window.
+/// Wide clusters take two cells.
 ///
 class Window
 {
@@ -70,22 +73,44 @@ public:
 
   bool insideWindow(const std::size_t& column, const std::size_t& row) const;
 
-  // TODO: add Window/Screen parameter here, to be used like this:
-  // old_scr = scr;
-  // scr.print_str(...)
-  // scr.render(1, 1, old_scr)
   std::string render(const std::size_t&, const std::size_t&, bool);
 
+  ///
+  /// @brief Render only what changed since \b previous , the window as it is on the screen at (x0, y0).
+  ///
+  /// Used like this: previous = scr; scr.print_str(...); scr.render(1, 1, previous).
+  /// Each changed span of a row is written after a cursor move, unchanged cells between two close spans are rewritten when that is shorter than a move. Rows that \b previous does not have are written in full.
+  ///
+  std::string render(const std::size_t& x0, const std::size_t& y0, const Window& previous);
+
 private:
-  std::size_t              index(const std::size_t& column, const std::size_t& row) const;
-  Term::Screen             m_window{0, 0};
-  Term::Cursor             m_cursor{1, 1};
-  std::vector<char32_t>    m_chars;  // the characters in row first order
-  std::vector<Term::Color> m_fg;
-  std::vector<Term::Color> m_bg;
-  std::vector<bool>        m_fg_reset;
-  std::vector<bool>        m_bg_reset;
-  std::vector<Style>       m_style;
+  // The attributes the terminal currently draws with
+  struct Pen
+  {
+    Term::Color fg{Term::Color::Name::Default};
+    Term::Color bg{Term::Color::Name::Default};
+    bool        fg_reset{true};
+    bool        bg_reset{true};
+    Term::Style style{Term::Style::Reset};
+  };
+  void                                         render_cells(std::string& out, const std::size_t& row, const std::size_t& first, const std::size_t& last, Pen& pen) const;
+  void                                         reset_pen(std::string& out, const Pen& pen) const;
+  bool                                         same(const std::size_t& cell, const Window& other) const;
+  std::size_t                                  index(const std::size_t& column, const std::size_t& row) const;
+  void                                         put(const std::size_t& column, const std::size_t& row, const char32_t& character);
+  void                                         set_cluster(const std::size_t& column, const std::size_t& row, const char32_t* cluster, const std::size_t& size);
+  void                                         place(const std::size_t& column, const std::size_t& row, const char32_t& cell, const int& width);
+  void                                         append_cluster(std::string& out, const char32_t& cell) const;
+  Term::Screen                                 m_window{0, 0};
+  Term::Cursor                                 m_cursor{1, 1};
+  std::vector<char32_t>                        m_chars;  // the characters in row first order, a wide character takes two cells
+  std::vector<std::u32string>                  m_clusters;  // the grapheme clusters too long to be packed in a cell
+  std::unordered_map<std::u32string, char32_t> m_cluster_cells;
+  std::vector<Term::Color>                     m_fg;
+  std::vector<Term::Color>                     m_bg;
+  std::vector<bool>                            m_fg_reset;
+  std::vector<bool>                            m_bg_reset;
+  std::vector<Style>                           m_style;
 
   char32_t get_char(const std::size_t& column, const std::size_t& row);
 
@@ -11,21 +11,26 @@
 #include "cpp-terminal/color.hpp"
 #include "cpp-terminal/event.hpp"
 #include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/highlight.hpp"
 #include "cpp-terminal/input.hpp"
 #include "cpp-terminal/iostream.hpp"
 #include "cpp-terminal/key.hpp"
 #include "cpp-terminal/mouse.hpp"
 #include "cpp-terminal/options.hpp"
 #include "cpp-terminal/screen.hpp"
+#include "cpp-terminal/search.hpp"
 #include "cpp-terminal/style.hpp"
 #include "cpp-terminal/terminal.hpp"
 #include "cpp-terminal/terminal_initializer.hpp"
+#include "cpp-terminal/textbuffer.hpp"
 #include "cpp-terminal/tty.hpp"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdarg>
 #include <cstddef>
 #include <cstring>
-#include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -37,52 +42,8 @@ const std::string KILO_VERSION{"0.0.1"};
 const int         KILO_TAB_STOP{8};
 const int         KILO_QUIT_TIMES{3};
 
-enum editorHighlight
-{
-  HL_NORMAL = 0,
-  HL_COMMENT,
-  HL_MLCOMMENT,
-  HL_KEYWORD1,
-  HL_KEYWORD2,
-  HL_STRING,
-  HL_NUMBER,
-  HL_MATCH
-};
-
-#define HL_HIGHLIGHT_NUMBERS (1 << 0)
-#define HL_HIGHLIGHT_STRINGS (1 << 1)
-
 /*** data ***/
 
-class editorSyntax
-{
-public:
-  editorSyntax() : keywords(nullptr) {}
-  editorSyntax(const std::string& type, const std::vector<std::string>& match, const char** key, const std::string& sc, const std::string& mcs, const std::string& mce, const std::size_t& flag) : filetype(type), filematch(match), keywords(key), singleline_comment_start(sc), multiline_comment_start(mcs), multiline_comment_end(mce), flags(flag) { m_empty = false; }
-  bool                     empty() const noexcept { return m_empty; }
-  std::string              filetype;
-  std::vector<std::string> filematch;
-  const char**             keywords;
-  std::string              singleline_comment_start;
-  std::string              multiline_comment_start;
-  std::string              multiline_comment_end;
-  std::size_t              flags;
-
-private:
-  bool m_empty{true};
-};
-
-typedef struct erow
-{
-  int            idx;
-  int            size;
-  int            rsize;
-  char*          chars;
-  char*          render;
-  unsigned char* hl;
-  int            hl_open_comment;
-} erow;
-
 class editorConfig
 {
 public:
@@ -98,20 +59,24 @@ public:
     screencols = screen.columns();
     statusmsg.resize(screencols);
   }
-  std::size_t  cx{0};
-  std::size_t  cy{0};
-  int          rx{0};
-  std::size_t  rowoff{0};
-  std::size_t  coloff{0};
-  std::size_t  screenrows{0};
-  std::size_t  screencols{0};
-  std::size_t  numrows{0};
-  erow*        row{nullptr};
-  int          dirty{0};
-  std::string  filename;
-  std::string  statusmsg;
-  time_t       statusmsg_time{0};
-  editorSyntax syntax;
+  std::size_t             cx{0};
+  std::size_t             cy{0};
+  int                     rx{0};
+  std::size_t             rowoff{0};
+  std::size_t             coloff{0};
+  std::size_t             screenrows{0};
+  std::size_t             screencols{0};
+  Term::TextBuffer        buffer;  ///< The rows are its lines, the last one ending with a '\n' or not.
+  int                     dirty{0};
+  std::string             filename;
+  std::string             statusmsg;
+  time_t                  statusmsg_time{0};
+  Term::Syntax            syntax;
+  Term::Highlighter       highlighter;  ///< Holds the rendered rows up to the last one displayed.
+  int                     match_row{-1};  ///< The search match, shown over the syntax highlighting.
+  std::size_t             match_col{0};
+  std::size_t             match_len{0};
+  Term::IncrementalSearch search;  ///< The search in progress, stepped by the prompt while no key is pressed.
 
 private:
   static const constexpr std::size_t m_sizeBar{2};
@@ -121,393 +86,156 @@ class editorConfig E;
 
 /*** filetypes ***/
 
-const std::vector<std::string> C_HL_extensions = {".c", ".h", ".hpp", ".cpp"};
-const char*                    C_HL_keywords[] = {"switch", "if", "while", "for", "break", "continue", "return", "else", "struct", "union", "typedef", "static", "enum", "class", "case", "int|", "long|", "double|", "float|", "char|", "unsigned|", "signed|", "void|", "bool|", nullptr};
-
-std::array<editorSyntax, 1> HLDB = {
-  editorSyntax("c", C_HL_extensions, C_HL_keywords, "//", "/*", "*/", HL_HIGHLIGHT_NUMBERS | HL_HIGHLIGHT_STRINGS),
-};
+const std::array<Term::Syntax, 1> HLDB = {Term::Syntax::c()};
 
 /*** prototypes ***/
 
 std::string editorPrompt(const std::string& prompt, void (*callback)(std::string&, const Term::Key&));
 
-/*** syntax highlighting ***/
-
-bool is_separator(const int& c) { return isspace(c) || c == '\0' || strchr(",.()+-/*=~%<>[];", c) != nullptr; }
+/*** row operations ***/
 
-void editorUpdateSyntax(erow* row)
+std::size_t editorNumRows()
 {
-  row->hl = reinterpret_cast<unsigned char*>(realloc(row->hl, static_cast<size_t>(row->rsize)));
-  if(row->hl == nullptr) { exit(-1); /*TODO: better handler*/ }
-  memset(row->hl, HL_NORMAL, static_cast<size_t>(row->rsize));
-
-  if(E.syntax.empty()) return;
-
-  const char** keywords = E.syntax.keywords;
-
-  const std::string scs = E.syntax.singleline_comment_start;
-  const std::string mcs = E.syntax.multiline_comment_start;
-  const std::string mce = E.syntax.multiline_comment_end;
-
-  int prev_sep   = 1;
-  int in_string  = 0;
-  int in_comment = (row->idx > 0) && (E.row[row->idx - 1].hl_open_comment != 0);
-
-  size_t i = 0;
-  while(i < static_cast<size_t>(row->rsize))
-  {
-    char          c       = row->render[i];
-    unsigned char prev_hl = (i > 0) ? row->hl[i - 1] : static_cast<unsigned char>(HL_NORMAL);
-
-    if(scs.size() && !in_string && !in_comment)
-    {
-      if(!strncmp(&row->render[i], &scs[0], scs.size()))
-      {
-        memset(&row->hl[i], HL_COMMENT, row->rsize - i);
-        break;
-      }
-    }
-
-    if(mcs.size() && mce.size() && !in_string)
-    {
-      if(in_comment)
-      {
-        row->hl[i] = HL_MLCOMMENT;
-        if(!strncmp(&row->render[i], &mce[0], mce.size()))
-        {
-          memset(&row->hl[i], HL_MLCOMMENT, mce.size());
-          i += mce.size();
-          in_comment = 0;
-          prev_sep   = 1;
-          continue;
-        }
-        else
-        {
-          i++;
-          continue;
-        }
-      }
-      else if(!strncmp(&row->render[i], &mcs[0], mcs.size()))
-      {
-        memset(&row->hl[i], HL_MLCOMMENT, mcs.size());
-        i += mcs.size();
-        in_comment = 1;
-        continue;
-      }
-    }
-
-    if(E.syntax.flags & HL_HIGHLIGHT_STRINGS)
-    {
-      if(in_string)
-      {
-        row->hl[i] = HL_STRING;
-        if(c == '\\' && i + 1 < static_cast<size_t>(row->rsize))
-        {
-          row->hl[i + 1] = HL_STRING;
-          i += 2;
-          continue;
-        }
-        if(c == in_string) in_string = 0;
-        i++;
-        prev_sep = 1;
-        continue;
-      }
-      else
-      {
-        if(c == '"' || c == '\'')
-        {
-          in_string  = c;
-          row->hl[i] = HL_STRING;
-          i++;
-          continue;
-        }
-      }
-    }
-
-    if(E.syntax.flags & HL_HIGHLIGHT_NUMBERS)
-    {
-      if((isdigit(c) && (prev_sep || prev_hl == HL_NUMBER)) || (c == '.' && prev_hl == HL_NUMBER))
-      {
-        row->hl[i] = HL_NUMBER;
-        i++;
-        prev_sep = 0;
-        continue;
-      }
-    }
-
-    if(prev_sep)
-    {
-      int j;
-      for(j = 0; keywords[j]; j++)
-      {
-        int klen = static_cast<int>(strlen(keywords[j]));
-        int kw2  = keywords[j][klen - 1] == '|';
-        if(kw2) klen--;
-
-        if(!strncmp(&row->render[i], keywords[j], klen) && is_separator(row->render[i + klen]))
-        {
-          memset(&row->hl[i], kw2 ? HL_KEYWORD2 : HL_KEYWORD1, static_cast<size_t>(klen));
-          i += klen;
-          break;
-        }
-      }
-      if(keywords[j] != nullptr)
-      {
-        prev_sep = 0;
-        continue;
-      }
-    }
-
-    prev_sep = is_separator(c);
-    i++;
-  }
-
-  int changed          = (row->hl_open_comment != in_comment);
-  row->hl_open_comment = in_comment;
-  if(changed && row->idx + 1 < E.numrows) editorUpdateSyntax(&E.row[row->idx + 1]);
+  if(E.buffer.empty()) { return 0; }
+  return E.buffer.lines() - (E.buffer[E.buffer.size() - 1] == '\n' ? 1 : 0);
 }
 
-Term::Color editorSyntaxToColor(const std::size_t& color)
-{
-  switch(color)
-  {
-    case HL_COMMENT: return Term::Color::Name::BrightCyan;
-    case HL_MLCOMMENT: return Term::Color::Name::Cyan;
-    case HL_KEYWORD1: return Term::Color::Name::Yellow;
-    case HL_KEYWORD2: return Term::Color::Name::Green;
-    case HL_STRING: return Term::Color::Name::Magenta;
-    case HL_NUMBER: return Term::Color::Name::Red;
-    case HL_MATCH: return Term::Color::Name::Blue;
-    default: return Term::Color::Name::Gray;
-  }
-}
+std::string editorRow(const std::size_t& row) { return E.buffer.line(row); }
 
-void editorSelectSyntaxHighlight()
-{
-  if(E.filename.empty()) { return; }
-  const std::size_t found{E.filename.find_last_of('.')};
-  if(found == std::string::npos) { return; }
-  const std::string ext{E.filename.substr(found)};
+std::size_t editorRowSize(const std::size_t& row) { return E.buffer.line_end(row) - E.buffer.line_begin(row); }
 
-  for(std::size_t j = 0; j != HLDB.size(); ++j)
-  {
-    for(std::size_t i = 0; i != HLDB[j].filematch.size(); ++i)
-    {
-      if(HLDB[j].filematch[i] == ext)
-      {
-        E.syntax = HLDB[j];
-        for(std::size_t filerow = 0; filerow < E.numrows; filerow++) { editorUpdateSyntax(&E.row[filerow]); }
-        return;
-      }
-    }
-  }
-}
-
-/*** row operations ***/
-
-int editorRowCxToRx(erow* row, int cx)
+int editorRowCxToRx(const std::string& row, const std::size_t& cx)
 {
   int rx = 0;
   for(std::size_t j = 0; j < cx; ++j)
   {
-    if(row->chars[j] == '\t') { rx += (KILO_TAB_STOP - 1) - (rx % KILO_TAB_STOP); }
+    if(row[j] == '\t') { rx += (KILO_TAB_STOP - 1) - (rx % KILO_TAB_STOP); }
     ++rx;
   }
   return rx;
 }
 
-int editorRowRxToCx(erow* row, int rx)
-{
-  int cur_rx = 0;
-  int cx{};
-  for(cx = 0; cx < row->size; cx++)
-  {
-    if(row->chars[cx] == '\t') cur_rx += (KILO_TAB_STOP - 1) - (cur_rx % KILO_TAB_STOP);
-    cur_rx++;
-
-    if(cur_rx > rx) return cx;
-  }
-  return cx;
-}
-
-void editorUpdateRow(erow* row)
+std::string editorRender(const std::string& row)
 {
-  int tabs = 0;
-  for(int j = 0; j < row->size; j++)
-    if(row->chars[j] == '\t') tabs++;
-
-  free(row->render);
-  row->render = reinterpret_cast<char*>(malloc(static_cast<size_t>(row->size + tabs * (KILO_TAB_STOP - 1) + 1)));
-  if(row->render == nullptr) { exit(-1); /*TODO: create better check*/ }
-
-  int idx = 0;
-  for(int j = 0; j < row->size; j++)
+  std::string render;
+  render.reserve(row.size());
+  for(std::size_t j = 0; j < row.size(); j++)
   {
-    if(row->chars[j] == '\t')
+    if(row[j] == '\t')
     {
-      row->render[idx++] = ' ';
-      while(idx % KILO_TAB_STOP != 0) row->render[idx++] = ' ';
+      render += ' ';
+      while(render.size() % KILO_TAB_STOP != 0) render += ' ';
     }
-    else { row->render[idx++] = row->chars[j]; }
+    else { render += row[j]; }
   }
-  row->render[idx] = '\0';
-  row->rsize       = idx;
-
-  editorUpdateSyntax(row);
+  return render;
 }
 
-void editorInsertRow(int at, const char* s, std::size_t len)
-{
-  if(at < 0 || at > E.numrows) return;
-
-  E.row = reinterpret_cast<erow*>(realloc(E.row, sizeof(erow) * (static_cast<size_t>(E.numrows) + 1)));
-  if(E.row == nullptr) { exit(-1); /*TODO: create better check*/ }
-  memmove(&E.row[at + 1], &E.row[at], sizeof(erow) * (static_cast<size_t>(E.numrows) - at));
-  for(int j = at + 1; j <= E.numrows; j++) E.row[j].idx++;
-
-  E.row[at].idx = at;
-
-  E.row[at].size  = static_cast<int>(len);
-  E.row[at].chars = (char*)malloc(len + 1);
-  if(E.row[at].chars == nullptr)
-  {
-    // allocation could fail and return nullptr
-    exit(-1);  // insert better error handling if needed
-  }
-  memcpy(E.row[at].chars, s, len);
-  E.row[at].chars[len] = '\0';
-
-  E.row[at].rsize           = 0;
-  E.row[at].render          = nullptr;
-  E.row[at].hl              = nullptr;
-  E.row[at].hl_open_comment = 0;
-  editorUpdateRow(&E.row[at]);
-
-  E.numrows++;
-  E.dirty++;
-}
+/*** syntax highlighting ***/
 
-void editorFreeRow(erow* row)
+// The highlighter only holds the rows displayed so far, the edits of the others are picked up when they are displayed
+void editorUpdateSyntax(const std::size_t& row)
 {
-  free(row->render);
-  free(row->chars);
-  free(row->hl);
+  if(row < E.highlighter.lines()) { E.highlighter.set(row, editorRender(editorRow(row))); }
 }
 
-void editorDelRow(int at)
+void editorInsertSyntax(const std::size_t& row)
 {
-  if(at < 0 || at >= E.numrows) return;
-  editorFreeRow(&E.row[at]);
-  memmove(&E.row[at], &E.row[at + 1], sizeof(erow) * (static_cast<size_t>(E.numrows) - at - 1));
-  for(int j = at; j < E.numrows - 1; j++) E.row[j].idx--;
-  E.numrows--;
-  E.dirty++;
+  if(row < E.highlighter.lines()) { E.highlighter.insert(row, editorRender(editorRow(row))); }
 }
 
-void editorRowInsertChar(erow* row, int at, int c)
+void editorEraseSyntax(const std::size_t& row)
 {
-  if(at < 0 || at > row->size) at = row->size;
-  row->chars = reinterpret_cast<char*>(realloc(row->chars, static_cast<size_t>(row->size) + 2));
-  if(row->chars == nullptr) { exit(-1); /*TODO: create better check*/ }
-  memmove(&row->chars[at + 1], &row->chars[at], static_cast<size_t>(row->size) - at + 1);
-  row->size++;
-  row->chars[at] = static_cast<char>(c);
-  editorUpdateRow(row);
-  E.dirty++;
+  if(row < E.highlighter.lines()) { E.highlighter.erase(row); }
 }
 
-void editorRowAppendString(erow* row, char* s, std::size_t len)
+void editorSyncSyntax()
 {
-  row->chars = reinterpret_cast<char*>(realloc(row->chars, static_cast<size_t>(row->size) + len + 1));
-  if(row->chars == nullptr) { exit(-1); /*TODO: create better check*/ }
-  memcpy(&row->chars[row->size], s, len);
-  row->size += static_cast<int>(len);
-  row->chars[row->size] = '\0';
-  editorUpdateRow(row);
-  E.dirty++;
+  std::vector<std::string> rows;
+  for(std::size_t row = 0; row < std::min(E.highlighter.lines(), editorNumRows()); ++row) { rows.push_back(editorRender(editorRow(row))); }
+  E.highlighter.assign(rows);
 }
 
-void editorRowDelChar(erow* row, int at)
+void editorSelectSyntaxHighlight()
 {
-  if(at < 0 || at >= row->size) return;
-  memmove(&row->chars[at], &row->chars[at + 1], static_cast<size_t>(row->size) - at);
-  row->size--;
-  editorUpdateRow(row);
-  E.dirty++;
+  if(E.filename.empty()) { return; }
+  for(std::size_t j = 0; j != HLDB.size(); ++j)
+  {
+    if(HLDB[j].matches(E.filename))
+    {
+      E.syntax = HLDB[j];
+      E.highlighter.set_syntax(E.syntax);
+      return;
+    }
+  }
 }
 
 /*** editor operations ***/
 
 void editorInsertChar(const Term::Key& key)
 {
-  if(E.cy == E.numrows) { editorInsertRow(E.numrows, "", 0); }
-  editorRowInsertChar(&E.row[E.cy], E.cx, key);
+  // Typing after the last row starts a new one
+  if(E.cy == editorNumRows() && !E.buffer.empty() && E.buffer[E.buffer.size() - 1] != '\n') { E.buffer.insert(E.buffer.size(), "\n"); }
+  E.buffer.insert(E.buffer.line_begin(E.cy) + E.cx, std::string(1, static_cast<char>(key)));
+  editorUpdateSyntax(E.cy);
   E.cx++;
+  E.dirty++;
 }
 
 void editorInsertNewline()
 {
-  if(E.cx == 0) { editorInsertRow(E.cy, "", 0); }
-  else
-  {
-    erow* row = &E.row[E.cy];
-    editorInsertRow(E.cy + 1, &row->chars[E.cx], static_cast<size_t>(row->size - E.cx));
-    row                   = &E.row[E.cy];
-    row->size             = E.cx;
-    row->chars[row->size] = '\0';
-    editorUpdateRow(row);
-  }
+  if(E.cy == editorNumRows() && !E.buffer.empty() && E.buffer[E.buffer.size() - 1] != '\n') { E.buffer.insert(E.buffer.size(), "\n"); }
+  E.buffer.insert(E.buffer.line_begin(E.cy) + E.cx, "\n");
+  editorUpdateSyntax(E.cy);
+  editorInsertSyntax(E.cy + 1);
   E.cy++;
   E.cx = 0;
+  E.dirty++;
 }
 
 void editorDelChar()
 {
-  if(E.cy == E.numrows) return;
+  if(E.cy == editorNumRows()) return;
   if(E.cx == 0 && E.cy == 0) return;
 
-  erow* row = &E.row[E.cy];
   if(E.cx > 0)
   {
-    editorRowDelChar(row, E.cx - 1);
+    E.buffer.erase(E.buffer.line_begin(E.cy) + E.cx - 1, 1);
+    editorUpdateSyntax(E.cy);
     E.cx--;
   }
   else
   {
-    E.cx = E.row[E.cy - 1].size;
-    editorRowAppendString(&E.row[E.cy - 1], row->chars, static_cast<size_t>(row->size));
-    editorDelRow(E.cy);
+    // Join the row to the previous one
+    E.cx = editorRowSize(E.cy - 1);
+    E.buffer.erase(E.buffer.line_end(E.cy - 1), 1);
+    editorEraseSyntax(E.cy);
+    editorUpdateSyntax(E.cy - 1);
     E.cy--;
   }
+  E.dirty++;
 }
 
-/*** file i/o ***/
-
-std::string editorRowsToString()
+void editorUndo(const bool& redo)
 {
-  std::string ret;
-  for(std::size_t line = 0; line < E.numrows; ++line) { ret += std::string(E.row[line].chars, static_cast<std::size_t>(E.row[line].size)) + '\n'; }
-  return ret;
+  if(!(redo ? E.buffer.redo() : E.buffer.undo())) { return; }
+  editorSyncSyntax();
+  const std::size_t numrows{editorNumRows()};
+  if(E.cy > numrows) { E.cy = numrows; }
+  const std::size_t rowlen{E.cy < numrows ? editorRowSize(E.cy) : 0};
+  if(E.cx > rowlen) { E.cx = rowlen; }
+  E.dirty++;
 }
 
+/*** file i/o ***/
+
 void editorOpen(const std::string& filename)
 {
   E.filename = filename;
   editorSelectSyntaxHighlight();
-
-  std::ifstream file(E.filename);
-  if(file.fail()) { throw std::runtime_error("File failed to open."); }
-  std::string line;
-  std::getline(file, line);
-  while(file.rdstate() == std::ios_base::goodbit)
-  {
-    long linelen = static_cast<long>(line.size());
-    while(linelen > 0 && (line[static_cast<size_t>(linelen - 1)] == '\n' || line[static_cast<size_t>(linelen - 1)] == '\r')) linelen--;
-    editorInsertRow(E.numrows, line.c_str(), linelen);
-    std::getline(file, line);
-  }
-  E.dirty = 0;
+  // Mapped, not read : the rows are only read when they are displayed
+  E.buffer = Term::TextBuffer::open(E.filename);
+  E.dirty  = 0;
 }
 
 void editorSetStatusMessage(const std::string fmt, ...)
@@ -532,71 +260,64 @@ void editorSave()
     editorSelectSyntaxHighlight();
   }
 
-  std::string   text = editorRowsToString();
-  std::ofstream out;
-  out.open(E.filename);
-  out << text;
-  out.close();
+  E.buffer.save(E.filename);
   E.dirty = 0;
-  editorSetStatusMessage("%d bytes written to disk", text.size());
+  editorSetStatusMessage("%d bytes written to disk", E.buffer.size());
 }
 
 /*** find ***/
 
-void editorFindCallback(std::string& query, const Term::Key& key)
+// Move to the match and show it
+void editorFindShow(const Term::Search::Match& match)
 {
-  static int last_match = -1;
-  static int direction  = 1;
+  if(!match.found()) { return; }
+  const std::size_t row{E.buffer.line_of(match.position)};
+  const std::string text{editorRow(row)};
+  const std::size_t cx{match.position - E.buffer.line_begin(row)};
+  E.cy     = row;
+  E.cx     = cx;
+  E.rowoff = editorNumRows();
 
-  static int   saved_hl_line;
-  static char* saved_hl = nullptr;
+  E.match_row = static_cast<int>(row);
+  E.match_col = static_cast<std::size_t>(editorRowCxToRx(text, cx));
+  E.match_len = static_cast<std::size_t>(editorRowCxToRx(text, cx + match.length)) - E.match_col;
+}
 
-  if(saved_hl)
-  {
-    memcpy(E.row[saved_hl_line].hl, saved_hl, static_cast<size_t>(E.row[saved_hl_line].rsize));
-    free(saved_hl);
-    saved_hl = nullptr;
-  }
+// Called for each key and, while the search is not over, when no key comes : the search goes on a step at a time and a new key cancels it
+void editorFindCallback(std::string& query, const Term::Key& key)
+{
+  static bool                searching{false};
+  static std::size_t         origin{0};  // Where the cursor was, the search as you type starts from there
+  static Term::Search::Match last;
 
   if(key == Term::Key::Enter || key == Term::Key::Esc)
   {
-    last_match = -1;
-    direction  = 1;
+    E.search.cancel();
+    E.match_row = -1;
+    searching   = false;
+    last        = Term::Search::Match();
     return;
   }
-  else if(key == Term::Key::ArrowRight || key == Term::Key::ArrowDown) { direction = 1; }
-  else if(key == Term::Key::ArrowLeft || key == Term::Key::ArrowUp) { direction = -1; }
-  else
+  if(!searching)
   {
-    last_match = -1;
-    direction  = 1;
+    searching = true;
+    origin    = E.cy < editorNumRows() ? E.buffer.line_begin(E.cy) + E.cx : E.buffer.size();
   }
-
-  if(last_match == -1) direction = 1;
-  int current = last_match;
-  for(int i = 0; i < E.numrows; i++)
+  if(key.empty())
   {
-    current += direction;
-    if(current == -1) { current = E.numrows - 1; }
-    else if(current == E.numrows) { current = 0; }
-
-    erow* row   = &E.row[current];
-    char* match = strstr(row->render, query.c_str());
-    if(match)
-    {
-      last_match = current;
-      E.cy       = current;
-      E.cx       = editorRowRxToCx(row, static_cast<int>(match - row->render));
-      E.rowoff   = E.numrows;
-
-      saved_hl_line = current;
-      saved_hl      = reinterpret_cast<char*>(malloc(static_cast<size_t>(row->rsize)));
-      if(saved_hl == nullptr) { exit(-1); /*TODO: better handler*/ }
-      memcpy(saved_hl, row->hl, row->rsize);
-      memset(&row->hl[match - row->render], HL_MATCH, query.size());
-      break;
-    }
+    if(E.search.done() || !E.search.step()) { return; }
   }
+  else
+  {
+    const Term::Search search(query);
+    if((key == Term::Key::ArrowRight || key == Term::Key::ArrowDown) && last.found()) { E.search.start(E.buffer, search, last.position + 1); }
+    else if((key == Term::Key::ArrowLeft || key == Term::Key::ArrowUp) && last.found()) { E.search.start(E.buffer, search, last.position, false); }
+    else { E.search.start(E.buffer, search, origin); }
+    E.match_row = -1;
+    if(!E.search.step()) { return; }
+  }
+  last = E.search.match();
+  editorFindShow(last);
 }
 
 void editorFind()
@@ -622,7 +343,7 @@ void editorFind()
 void editorScroll()
 {
   E.rx = 0;
-  if(E.cy < E.numrows) { E.rx = editorRowCxToRx(&E.row[E.cy], E.cx); }
+  if(E.cy < editorNumRows()) { E.rx = editorRowCxToRx(editorRow(E.cy), E.cx); }
 
   if(E.cy < E.rowoff) { E.rowoff = E.cy; }
   if(E.cy >= E.rowoff + E.screenrows) { E.rowoff = E.cy - E.screenrows + 1; }
@@ -632,12 +353,17 @@ void editorScroll()
 
 void editorDrawRows(std::string& screen)
 {
+  const std::size_t numrows{editorNumRows()};
+  // Highlight the rows displayed, along with the ones before them
+  const std::size_t displayed{std::min(E.rowoff + E.screenrows, numrows)};
+  while(E.highlighter.lines() < displayed) { E.highlighter.insert(E.highlighter.lines(), editorRender(editorRow(E.highlighter.lines()))); }
+  E.highlighter.update();
   for(int y = 0; y < E.screenrows; y++)
   {
     int filerow = y + E.rowoff;
-    if(filerow >= E.numrows)
+    if(filerow >= numrows)
     {
-      if(E.numrows == 0 && y == E.screenrows / 3)
+      if(numrows == 0 && y == E.screenrows / 3)
       {
         char welcome[80];
         int  welcomelen = snprintf(welcome, sizeof(welcome), "Kilo editor -- version %s", KILO_VERSION.c_str());
@@ -655,15 +381,18 @@ void editorDrawRows(std::string& screen)
     }
     else
     {
-      int len = E.row[filerow].rsize - E.coloff;
+      const std::string render = editorRender(editorRow(static_cast<std::size_t>(filerow)));
+      int               len    = static_cast<int>(render.size()) - static_cast<int>(E.coloff);
       if(len < 0) len = 0;
       if(len > E.screencols) len = E.screencols;
-      char*          c             = &E.row[filerow].render[E.coloff];
-      unsigned char* hl            = &E.row[filerow].hl[E.coloff];
-      Term::Color    current_color = Term::Color::Name::Black;  // black is not used in editorSyntaxToColor
-      int            j;
+      const char*                        c             = render.c_str() + std::min(E.coloff, render.size());
+      const std::vector<Term::Highlight> hl            = E.highlighter.highlights(static_cast<std::size_t>(filerow));
+      Term::Color                        current_color = Term::Color::Name::Black;  // black is not used by highlight_color
+      int                                j;
       for(j = 0; j < len; j++)
       {
+        const std::size_t at{E.coloff + static_cast<std::size_t>(j)};
+        const bool        match{filerow == E.match_row && at >= E.match_col && at < E.match_col + E.match_len};
         if(iscntrl(c[j]))
         {
           char sym = (c[j] <= 26) ? '@' + c[j] : '?';
@@ -672,7 +401,7 @@ void editorDrawRows(std::string& screen)
           screen.append(style(Term::Style::Reset));
           if(current_color != Term::Color::Name::Default) { screen.append(color_fg(current_color)); }
         }
-        else if(hl[j] == HL_NORMAL)
+        else if(!match && hl[at] == Term::Highlight::Normal)
         {
           if(current_color != Term::Color::Name::Black)
           {
@@ -683,7 +412,7 @@ void editorDrawRows(std::string& screen)
         }
         else
         {
-          Term::Color color = editorSyntaxToColor(hl[j]);
+          Term::Color color = match ? Term::Color(Term::Color::Name::Blue) : Term::highlight_color(hl[at]);
           if(color != current_color)
           {
             current_color = color;
@@ -705,8 +434,8 @@ void editorDrawStatusBar(std::string& screen)
   screen.append(style(Term::Style::Reversed));
   char status[80];
   char rstatus[80];
-  int  len  = snprintf(status, sizeof(status), "%.20s - %d lines %s", !E.filename.empty() ? E.filename.c_str() : "[No Name]", E.numrows, E.dirty ? "(modified)" : "");
-  int  rlen = snprintf(rstatus, sizeof(rstatus), "%s | %ld/%ld", !E.syntax.empty() ? E.syntax.filetype.c_str() : "no ft", E.cy + 1, E.numrows);
+  int  len  = snprintf(status, sizeof(status), "%.20s - %d lines %s", !E.filename.empty() ? E.filename.c_str() : "[No Name]", editorNumRows(), E.dirty ? "(modified)" : "");
+  int  rlen = snprintf(rstatus, sizeof(rstatus), "%s | %ld/%ld", !E.syntax.filetype.empty() ? E.syntax.filetype.c_str() : "no ft", E.cy + 1, editorNumRows());
   if(len > E.screencols) len = E.screencols;
   screen.append(std::string(status, len));
   while(len < E.screencols)
@@ -759,9 +488,14 @@ std::string editorPrompt(const std::string& prompt, void (*callback)(std::string
     editorSetStatusMessage(prompt, buf.c_str());
     editorRefreshScreen();
 
-    Term::Key c = Term::read_event();
+    // Do not wait for a key while a search is in progress
+    Term::Key c = E.search.done() ? Term::read_event() : Term::read_event(std::chrono::milliseconds(0));
 
-    if(c.empty()) continue;
+    if(c.empty())
+    {
+      if(callback) callback(buf, c);
+      continue;
+    }
     else if(c == Term::Key::Del || c == Term::Key::Ctrl_H || c == Term::Key::Backspace)
     {
       if(!buf.empty()) buf.pop_back();
@@ -789,7 +523,8 @@ std::string editorPrompt(const std::string& prompt, void (*callback)(std::string
 
 void editorMoveCursor(const Term::Key& key)
 {
-  erow* row = (E.cy >= E.numrows) ? nullptr : &E.row[E.cy];
+  const std::size_t numrows{editorNumRows()};
+  const bool        row{E.cy < numrows};
 
   switch(key)
   {
@@ -798,12 +533,12 @@ void editorMoveCursor(const Term::Key& key)
       else if(E.cy > 0)
       {
         E.cy--;
-        E.cx = E.row[E.cy].size;
+        E.cx = editorRowSize(E.cy);
       }
       break;
     case Term::Key::ArrowRight:
-      if(row && E.cx < row->size) { E.cx++; }
-      else if(row && E.cx == row->size)
+      if(row && E.cx < editorRowSize(E.cy)) { E.cx++; }
+      else if(row && E.cx == editorRowSize(E.cy))
       {
         E.cy++;
         E.cx = 0;
@@ -813,13 +548,12 @@ void editorMoveCursor(const Term::Key& key)
       if(E.cy != 0) { E.cy--; }
       break;
     case Term::Key::ArrowDown:
-      if(E.cy < E.numrows) { E.cy++; }
+      if(E.cy < numrows) { E.cy++; }
       break;
     default: return;
   }
 
-  row        = (E.cy >= E.numrows) ? nullptr : &E.row[E.cy];
-  int rowlen = row ? row->size : 0;
+  const std::size_t rowlen{E.cy < numrows ? editorRowSize(E.cy) : 0};
   if(E.cx > rowlen) { E.cx = rowlen; }
 }
 
@@ -862,7 +596,7 @@ bool editorProcessKeypress()
         }
         case Term::Key::End:
         {
-          if(E.cy < E.numrows) { E.cx = E.row[E.cy].size; }
+          if(E.cy < editorNumRows()) { E.cx = editorRowSize(E.cy); }
           break;
         }
         case Term::Key::Ctrl_F:
@@ -870,6 +604,12 @@ bool editorProcessKeypress()
           ::editorFind();
           break;
         }
+        case Term::Key::Ctrl_Z:
+        case Term::Key::Ctrl_Y:
+        {
+          ::editorUndo(key == Term::Key::Ctrl_Y);
+          break;
+        }
         case Term::Key::Backspace:
         case Term::Key::Del:
         {
@@ -884,7 +624,7 @@ bool editorProcessKeypress()
           else if(key == Term::Key::PageDown)
           {
             E.cy = E.rowoff + E.screenrows - 1;
-            if(E.cy > E.numrows) E.cy = E.numrows;
+            if(E.cy > editorNumRows()) E.cy = editorNumRows();
           }
 
           int times = E.screenrows;
@@ -960,7 +700,7 @@ int main()
     Term::terminal.setOptions(Term::Option::ClearScreen, Term::Option::NoSignalKeys, Term::Option::NoCursor, Term::Option::Raw);
     if(Term::argc >= 2) { editorOpen(Term::argv[1]); }
 
-    editorSetStatusMessage("HELP: Ctrl-S = save | Ctrl-Q = quit | Ctrl-F = find");
+    editorSetStatusMessage("HELP: Ctrl-S = save | Ctrl-Q = quit | Ctrl-F = find | Ctrl-Z/Ctrl-Y = undo/redo");
 
     editorRefreshScreen();
     while(editorProcessKeypress()) { editorRefreshScreen(); }
@@ -12,15 +12,19 @@
 #include "cpp-terminal/input.hpp"
 #include "cpp-terminal/iostream.hpp"
 #include "cpp-terminal/key.hpp"
+#include "cpp-terminal/latency.hpp"
 #include "cpp-terminal/screen.hpp"
 #include "cpp-terminal/style.hpp"
 #include "cpp-terminal/terminal.hpp"
 #include "cpp-terminal/tty.hpp"
 
-static void render(const std::size_t& rows, const std::size_t& cols, const std::size_t& menuheight, const std::size_t& menuwidth, const std::size_t& menupos)
+#include <cstdlib>
+
+static void render(Term::FrameLatency& latency, const std::size_t& rows, const std::size_t& cols, const std::size_t& menuheight, const std::size_t& menuwidth, const std::size_t& menupos)
 {
   static std::string scr;
   scr.reserve(rows * cols * 4);
+  scr.clear();
 
   scr.append(Term::cursor_move(1, 1));
 
@@ -83,7 +87,7 @@ static void render(const std::size_t& rows, const std::size_t& cols, const std::
   scr.append("Menu width: " + std::to_string(menuwidth) + "       \n");
   scr.append("Menu height: " + std::to_string(menuheight) + "    \n");
 
-  Term::cout << scr << std::flush;
+  latency.present(scr);
 }
 
 int main()
@@ -100,14 +104,18 @@ int main()
     bool         on{true};
     bool         need_to_render{true};
 
+    // Time between a key press and the frame showing it, printed on exit if CPPTERMINAL_LATENCY_REPORT is set
+    Term::FrameLatency latency;
+
     while(on)
     {
       if(need_to_render)
       {
-        ::render(term_size.rows(), term_size.columns(), h, w, pos);
+        ::render(latency, term_size.rows(), term_size.columns(), h, w, pos);
         need_to_render = false;
       }
       Term::Event event{Term::read_event()};
+      latency.input(event);
       switch(event.type())
       {
         case Term::Event::Type::Key:
@@ -149,7 +157,7 @@ int main()
         {
           term_size = Term::Screen(event);
           Term::cout << Term::clear_screen() << std::flush;
-          ::render(term_size.rows(), term_size.columns(), h, w, pos);
+          ::render(latency, term_size.rows(), term_size.columns(), h, w, pos);
           break;
         }
         case Term::Event::Type::Mouse:
@@ -171,6 +179,7 @@ int main()
         default: break;
       }
     }
+    if(std::getenv("CPPTERMINAL_LATENCY_REPORT") != nullptr) { Term::cerr << latency.report() << std::endl; }
   }
   catch(const Term::Exception& re)
   {
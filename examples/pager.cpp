@@ -0,0 +1,133 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/args.hpp"
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/input.hpp"
+#include "cpp-terminal/iostream.hpp"
+#include "cpp-terminal/key.hpp"
+#include "cpp-terminal/pager.hpp"
+#include "cpp-terminal/screen.hpp"
+#include "cpp-terminal/style.hpp"
+#include "cpp-terminal/terminal.hpp"
+#include "cpp-terminal/tty.hpp"
+#include "cpp-terminal/window.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <utility>
+
+// A less-like viewer: arrows, PageUp/PageDown, Home/End, ':' line, '%' percentage, 'F' follow, 'q' quit
+int main()
+{
+  try
+  {
+    if(!Term::is_stdin_a_tty())
+    {
+      Term::cout << "The terminal is not attached to a TTY and therefore can't catch user input. Exiting...\n";
+      return 1;
+    }
+    if(Term::argc < 2)
+    {
+      Term::cout << "Usage: pager FILE" << std::endl;
+      return 1;
+    }
+    Term::Pager pager(Term::argv[1]);
+    Term::terminal.setOptions(Term::Option::ClearScreen, Term::Option::NoSignalKeys, Term::Option::NoCursor, Term::Option::Raw);
+    Term::Screen size{Term::screen_size()};
+    Term::Window scr(size.columns(), size.rows());
+    Term::Window previous(size.columns(), size.rows());
+    bool         first{true};
+    std::string  command;  // The ':' or '%' being typed, and its number
+    while(true)
+    {
+      pager.update();
+      const std::size_t height{size.rows() - 1};
+      scr.clear();
+      pager.render(scr, 1, 1, size.columns(), height);
+      // The status line
+      std::string status{command.empty() ? Term::argv[1] : command};
+      if(command.empty())
+      {
+        const std::size_t top{pager.top_line()};
+        char              position[64];
+        std::snprintf(position, sizeof(position), "  line %s/%zu%s  %.0f%%", top == std::string::npos ? "?" : std::to_string(top + 1).c_str(), pager.lines(), pager.indexing() ? "+" : "", pager.percent());
+        status += position;
+        if(pager.follow()) { status += "  (following)"; }
+      }
+      scr.print_str(1, size.rows(), status);
+      scr.fill_style(1, size.rows(), size.columns(), size.rows(), Term::Style::Reversed);
+      Term::cout << (first ? scr.render(1, 1, false) : scr.render(1, 1, previous)) << std::flush;
+      first = false;
+      std::swap(scr, previous);
+      // Wake up to pick up the progress of the index and what is appended to the file
+      const Term::Event event{Term::read_event(std::chrono::milliseconds(200))};
+      if(event.type() == Term::Event::Type::Screen)
+      {
+        size     = event;
+        scr      = Term::Window(size.columns(), size.rows());
+        previous = Term::Window(size.columns(), size.rows());
+        first    = true;
+        continue;
+      }
+      if(event.type() != Term::Event::Type::Key) { continue; }
+      const Term::Key key{event};
+      if(!command.empty())
+      {
+        if(key.isdigit()) { command += static_cast<char>(key); }
+        else if(key == Term::Key::Backspace && command.size() > 1) { command.pop_back(); }
+        else if(key == Term::Key::Enter && command.size() > 1)
+        {
+          const std::size_t number{std::stoul(command.substr(1))};
+          if(command[0] == ':') { pager.jump_to_line(number == 0 ? 0 : number - 1); }  // Lines are shown from 1
+          else { pager.jump_to_percent(static_cast<double>(number)); }
+          command.clear();
+        }
+        else if(key == Term::Key::Esc || key == Term::Key::Enter) { command.clear(); }
+        continue;
+      }
+      switch(key)
+      {
+        case Term::Key::q:
+        case Term::Key::Ctrl_C: return 0;
+        case Term::Key::ArrowDown:
+        case Term::Key::j:
+        case Term::Key::Enter: pager.scroll(1); break;
+        case Term::Key::ArrowUp:
+        case Term::Key::k: pager.scroll(-1); break;
+        case Term::Key::PageDown:
+        case Term::Key::Space: pager.scroll(static_cast<long>(height)); break;
+        case Term::Key::PageUp:
+        case Term::Key::b: pager.scroll(-static_cast<long>(height)); break;
+        case Term::Key::ArrowRight: pager.scroll_columns(8); break;
+        case Term::Key::ArrowLeft: pager.scroll_columns(-8); break;
+        case Term::Key::Home:
+        case Term::Key::g: pager.jump_to_line(0); break;
+        case Term::Key::End:
+        case Term::Key::G: pager.jump_to_end(); break;
+        case Term::Key::F: pager.set_follow(!pager.follow()); break;
+        case Term::Key::Colon: command = ":"; break;
+        case Term::Key::Percent: command = "%"; break;
+        default: break;
+      }
+    }
+  }
+  catch(const Term::Exception& re)
+  {
+    Term::cerr << "cpp-terminal error: " << re.what() << std::endl;
+    return 2;
+  }
+  catch(...)
+  {
+    Term::cerr << "Unknown error." << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,82 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/history.hpp"
+#include "cpp-terminal/input.hpp"
+#include "cpp-terminal/iostream.hpp"
+#include "cpp-terminal/key.hpp"
+#include "cpp-terminal/prompt.hpp"
+#include "cpp-terminal/screen.hpp"
+#include "cpp-terminal/terminal.hpp"
+#include "cpp-terminal/tty.hpp"
+#include "cpp-terminal/window.hpp"
+
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+// A clock kept up to date while a prompt waits for input: the prompt is fed the events instead of reading them itself
+int main()
+{
+  try
+  {
+    if(!Term::is_stdin_a_tty())
+    {
+      Term::cout << "The terminal is not attached to a TTY and therefore can't catch user input. Exiting...\n";
+      return 1;
+    }
+    Term::terminal.setOptions(Term::Option::ClearScreen, Term::Option::NoSignalKeys, Term::Option::Cursor, Term::Option::Raw);
+    const Term::Screen                     size{Term::screen_size()};
+    Term::History                          history;
+    std::function<bool(std::string)>       iscomplete = [](const std::string&) { return true; };
+    std::unique_ptr<Term::MultilinePrompt> prompt{new Term::MultilinePrompt("> ", history, iscomplete)};
+    Term::Window                           scr(size.columns(), size.rows());
+    Term::Window                           previous(size.columns(), size.rows());
+    std::string                            last{"(nothing yet)"};
+    std::size_t                            submitted{0};
+    bool                                   first{true};
+    while(true)
+    {
+      const std::time_t now{std::time(nullptr)};
+      std::string       time{std::ctime(&now)};
+      time.pop_back();  // '\n'
+      scr.clear();
+      scr.print_str(1, 1, "Live dashboard, Ctrl-D on an empty prompt to quit");
+      scr.print_str(1, 3, "Time: " + time);
+      scr.print_str(1, 4, "Submitted: " + std::to_string(submitted) + ", last: " + last);
+      prompt->render(scr, 1, 6, size.columns());
+      Term::cout << (first ? scr.render(1, 1, false) : scr.render(1, 1, previous)) << std::flush;
+      first = false;
+      std::swap(scr, previous);
+      // Wake up at least every 200ms to update the clock
+      const Term::Status status{prompt->feed(Term::read_event(std::chrono::milliseconds(200)))};
+      if(status != Term::Status::Done) { continue; }
+      if(prompt->result().size() == 1 && prompt->result()[0] == Term::Key::Ctrl_D) { break; }
+      last = prompt->result().substr(0, prompt->result().size() - 1);
+      ++submitted;
+      // A new prompt for the next input, the history is shared
+      prompt.reset(new Term::MultilinePrompt("> ", history, iscomplete));
+    }
+  }
+  catch(const Term::Exception& re)
+  {
+    Term::cerr << "cpp-terminal error: " << re.what() << std::endl;
+    return 2;
+  }
+  catch(...)
+  {
+    Term::cerr << "Unknown error." << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,108 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/input.hpp"
+#include "cpp-terminal/iostream.hpp"
+#include "cpp-terminal/key.hpp"
+#include "cpp-terminal/screen.hpp"
+#include "cpp-terminal/style.hpp"
+#include "cpp-terminal/table.hpp"
+#include "cpp-terminal/terminal.hpp"
+#include "cpp-terminal/tty.hpp"
+#include "cpp-terminal/window.hpp"
+
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+// A row of a listing of 10M files, made up as it is shown
+std::vector<std::string> file(const std::size_t& row)
+{
+  static const std::vector<std::string> directories{"src", "include/detail", "tests", "docs/api/reference", "build/generated/protobuf", "third_party/unicode/data"};
+  static const std::vector<std::string> kinds{"source", "header", "text", "binary"};
+  char                                  modified[32];
+  std::snprintf(modified, sizeof(modified), "2023-%02zu-%02zu %02zu:%02zu", 1 + row % 12, 1 + row % 28, row % 24, row % 60);
+  const std::string name{"file_" + std::to_string(row) + (row % 7 == 0 ? "_with_a_rather_long_name" : "") + ".dat"};
+  return {std::to_string(row + 1), name, std::to_string((row * 2654435761U) % 100000000), modified, kinds[row % kinds.size()], directories[row % directories.size()] + '/' + name};
+}
+
+}  // namespace
+
+// A table of 10M rows: arrows, PageUp/PageDown, Home/End, 'q' quit
+int main()
+{
+  try
+  {
+    if(!Term::is_stdin_a_tty())
+    {
+      Term::cout << "The terminal is not attached to a TTY and therefore can't catch user input. Exiting...\n";
+      return 1;
+    }
+    const std::vector<Term::Table::Column> columns{Term::Table::Column("#", Term::Table::Align::Right),    Term::Table::Column("Name"), Term::Table::Column("Size", Term::Table::Align::Right),
+                                                   Term::Table::Column("Modified", Term::Table::Align::Center), Term::Table::Column("Kind", Term::Table::Align::Center), Term::Table::Column("Path", Term::Table::Align::Left, 0, 60)};
+    Term::Table                            table(columns, 10000000, file);
+    Term::terminal.setOptions(Term::Option::ClearScreen, Term::Option::NoSignalKeys, Term::Option::NoCursor, Term::Option::Raw);
+    Term::Screen size{Term::screen_size()};
+    Term::Window scr(size.columns(), size.rows());
+    Term::Window previous(size.columns(), size.rows());
+    bool         first{true};
+    while(true)
+    {
+      const std::size_t height{size.rows() - 1};
+      scr.clear();
+      table.render(scr, 1, 1, size.columns(), height);
+      const std::string status{"rows " + std::to_string(table.top() + 1) + "-" + std::to_string(table.top() + table.page()) + " of " + std::to_string(table.rows()) + "  column " + std::to_string(table.left() + 1)};
+      scr.print_str(1, size.rows(), status);
+      scr.fill_style(1, size.rows(), size.columns(), size.rows(), Term::Style::Reversed);
+      Term::cout << (first ? scr.render(1, 1, false) : scr.render(1, 1, previous)) << std::flush;
+      first = false;
+      std::swap(scr, previous);
+      const Term::Event event{Term::read_event()};
+      if(event.type() == Term::Event::Type::Screen)
+      {
+        size     = event;
+        scr      = Term::Window(size.columns(), size.rows());
+        previous = Term::Window(size.columns(), size.rows());
+        first    = true;
+        continue;
+      }
+      if(event.type() != Term::Event::Type::Key) { continue; }
+      switch(Term::Key(event))
+      {
+        case Term::Key::q:
+        case Term::Key::Ctrl_C: return 0;
+        case Term::Key::ArrowDown: table.scroll(1); break;
+        case Term::Key::ArrowUp: table.scroll(-1); break;
+        case Term::Key::PageDown: table.scroll(static_cast<long>(table.page())); break;
+        case Term::Key::PageUp: table.scroll(-static_cast<long>(table.page())); break;
+        case Term::Key::ArrowRight: table.scroll_columns(8); break;
+        case Term::Key::ArrowLeft: table.scroll_columns(-8); break;
+        case Term::Key::Home: table.scroll_to(0); break;
+        case Term::Key::End: table.scroll_to(table.rows()); break;
+        default: break;
+      }
+    }
+  }
+  catch(const Term::Exception& re)
+  {
+    Term::cerr << "cpp-terminal error: " << re.what() << std::endl;
+    return 2;
+  }
+  catch(...)
+  {
+    Term::cerr << "Unknown error." << std::endl;
+    return 1;
+  }
+  return 0;
+}
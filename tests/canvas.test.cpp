@@ -0,0 +1,173 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/canvas.hpp"
+
+#include "cpp-terminal/emulator.hpp"
+#include "cpp-terminal/window.hpp"
+#include "doctest/doctest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace
+{
+
+// Bresenham walking every dot of the segment, those off the canvas included
+void reference_line(Term::Canvas& canvas, const std::int64_t& x0, const std::int64_t& y0, const std::int64_t& x1, const std::int64_t& y1)
+{
+  std::int64_t       x{x0};
+  std::int64_t       y{y0};
+  const std::int64_t dx{x1 > x ? x1 - x : x - x1};
+  const std::int64_t dy{y1 > y ? y - y1 : y1 - y};
+  std::int64_t       error{dx + dy};
+  while(true)
+  {
+    canvas.set(static_cast<std::size_t>(x), static_cast<std::size_t>(y));
+    if(x == x1 && y == y1) { return; }
+    const std::int64_t twice{2 * error};
+    if(twice >= dy)
+    {
+      error += dy;
+      x += x1 > x0 ? 1 : -1;
+    }
+    if(twice <= dx)
+    {
+      error += dx;
+      y += y1 > y0 ? 1 : -1;
+    }
+  }
+}
+
+std::string show(const Term::Canvas& canvas, const std::size_t& row)
+{
+  Term::Window window(canvas.columns() + 1, canvas.rows());
+  canvas.draw(window, 1, 1);
+  Term::Emulator emulator(window.get_h(), window.get_w());
+  emulator.feed(window.render(1, 1, false));
+  const std::string ret{emulator.row(row)};
+  return ret.substr(0, ret.size() - 1);
+}
+
+}  // namespace
+
+TEST_CASE("Dots")
+{
+  Term::Canvas canvas(2, 1);
+  CHECK(canvas.width() == 4);
+  CHECK(canvas.height() == 4);
+  canvas.set(0, 0);
+  canvas.set(3, 3);
+  CHECK(canvas.get(0, 0));
+  CHECK_FALSE(canvas.get(1, 0));
+  CHECK(show(canvas, 1) == "⠁⢀");
+  canvas.set(0, 3);
+  canvas.set(1, 1);
+  CHECK(show(canvas, 1) == "⡑⢀");
+  canvas.unset(0, 0);
+  CHECK(show(canvas, 1) == "⡐⢀");
+  // Outside: ignored
+  canvas.set(4, 0);
+  canvas.set(0, 4);
+  CHECK_FALSE(canvas.get(4, 0));
+  canvas.clear();
+  CHECK_FALSE(canvas.get(3, 3));
+  CHECK(show(canvas, 1) == "  ");
+}
+
+TEST_CASE("Lines")
+{
+  Term::Canvas canvas(2, 2);
+  canvas.line(0, 0, 3, 0);
+  CHECK(show(canvas, 1) == "⠉⠉");
+  canvas.clear();
+  canvas.line(0, 0, 3, 7);
+  for(std::size_t y = 0; y != 8; ++y) { CHECK(canvas.get(y / 2, y)); }
+  CHECK(show(canvas, 1) == "⢣ ");
+  CHECK(show(canvas, 2) == " ⢣");
+  // Same segment backwards
+  Term::Canvas backwards(2, 2);
+  backwards.line(3, 7, 0, 0);
+  CHECK(show(backwards, 1) == show(canvas, 1));
+  CHECK(show(backwards, 2) == show(canvas, 2));
+  // Clipped
+  canvas.clear();
+  canvas.line(1, 1, 1000, 1);
+  CHECK(show(canvas, 1) == "⠐⠒");
+  canvas.line(0, 0, static_cast<std::size_t>(-1), static_cast<std::size_t>(-1));
+  CHECK(canvas.get(3, 3));
+  // Clipped segments have the dots of the whole segment on the canvas
+  std::mt19937 random(3);
+  for(std::size_t round = 0; round != 5000; ++round)
+  {
+    const std::size_t x0{random() % 40};
+    const std::size_t y0{random() % 60};
+    const std::size_t x1{random() % 40};
+    const std::size_t y1{random() % 60};
+    CAPTURE(x0);
+    CAPTURE(y0);
+    CAPTURE(x1);
+    CAPTURE(y1);
+    Term::Canvas clipped(5, 5);
+    Term::Canvas expected(5, 5);
+    clipped.line(x0, y0, x1, y1);
+    reference_line(expected, static_cast<std::int64_t>(x0), static_cast<std::int64_t>(y0), static_cast<std::int64_t>(x1), static_cast<std::int64_t>(y1));
+    for(std::size_t y = 0; y != 20; ++y)
+    {
+      for(std::size_t x = 0; x != 10; ++x) { CHECK(clipped.get(x, y) == expected.get(x, y)); }
+    }
+  }
+  // Far off in each direction, only the dots on the canvas are walked
+  const std::size_t far{2000000000};
+  Term::Canvas      small(5, 5);
+  small.line(far, 0, 0, 0);
+  small.line(0, far, 0, 0);
+  small.line(far, far, 0, 0);
+  small.line(0, 19, far, 19);
+  small.line(far, 2, far, 17);
+  small.line(9, far, 9, far / 2);
+  for(std::size_t i = 0; i != 10; ++i)
+  {
+    CHECK(small.get(i, 0));
+    CHECK(small.get(0, 2 * i));
+    CHECK(small.get(i, i));
+    CHECK(small.get(i, 19));
+  }
+  for(std::size_t y = 10; y != 19; ++y) { CHECK_FALSE(small.get(9, y)); }
+}
+
+TEST_CASE("Rectangles")
+{
+  Term::Canvas canvas(2, 1);
+  canvas.rectangle(3, 3, 0, 0);
+  CHECK(show(canvas, 1) == "⣏⣹");
+  canvas.clear();
+  canvas.rectangle(1, 1, 2, 2, true);
+  CHECK(show(canvas, 1) == "⠰⠆");
+  canvas.clear();
+  canvas.rectangle(0, 0, 100, 100, true);
+  CHECK(show(canvas, 1) == "⣿⣿");
+}
+
+TEST_CASE("Draw in a window")
+{
+  Term::Canvas canvas(3, 1);
+  canvas.set(0, 0);
+  canvas.set(5, 0);
+  Term::Window window(3, 1);
+  window.print_str(1, 1, "abc");
+  // The empty cell keeps its character, the cells out of the window are skipped
+  canvas.draw(window, 2, 1, Term::Color::Name::Red);
+  Term::Emulator emulator(1, 3);
+  emulator.feed(window.render(1, 1, false));
+  CHECK(emulator.row(1) == "a⠁c");
+}
@@ -0,0 +1,114 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/color.hpp"
+#include "cpp-terminal/private/palette_table.hpp"
+#include "cpp-terminal/style.hpp"
+#include "cpp-terminal/terminfo.hpp"
+
+#include "doctest/doctest.h"
+
+#include <string>
+#include <vector>
+
+TEST_CASE("to8bits")
+{
+  CHECK(Term::Color(255, 0, 0).to8bits() == 196);
+  CHECK(Term::Color(0, 0, 0).to8bits() == 16);
+  CHECK(Term::Color(255, 255, 255).to8bits() == 231);
+  CHECK(Term::Color(128, 128, 128).to8bits() == 244);  // the grayscale ramp is used
+  CHECK(Term::Color(100, 100, 100).to8bits() == 241);
+  CHECK(Term::Color(250, 128, 114).to8bits() == 210);
+  CHECK(Term::Color(200, 30, 30).to8bits() == 160);
+  CHECK(Term::Color(42).to8bits() == 42);
+  // The colors of the palette map to themselves
+  for(std::size_t i = 16; i != 256; ++i)
+  {
+    const std::uint8_t* rgb{&Term::Private::Palette::rgb[3 * i]};
+    CHECK(Term::Color(rgb[0], rgb[1], rgb[2]).to8bits() == i);
+  }
+  // Batch
+  const std::vector<std::uint8_t> pixels{255, 0, 0, 128, 128, 128, 95, 95, 95};
+  std::vector<std::uint8_t>       colors(3);
+  Term::to8bits(pixels.data(), 3, colors.data());
+  CHECK(colors == std::vector<std::uint8_t>{196, 244, 59});
+}
+
+TEST_CASE("to4bits")
+{
+  CHECK(Term::Color(255, 0, 0).to4bits() == Term::Color::Name::BrightRed);
+  CHECK(Term::Color(200, 0, 0).to4bits() == Term::Color::Name::Red);
+  CHECK(Term::Color(128, 128, 128).to4bits() == Term::Color::Name::Gray);
+  CHECK(Term::Color(250, 250, 250).to4bits() == Term::Color::Name::BrightWhite);
+  CHECK(Term::Color(0, 0, 255).to4bits() == Term::Color::Name::Blue);
+  CHECK(Term::Color(196).to4bits() == Term::Color::Name::BrightRed);
+  CHECK(Term::Color(9).to4bits() == Term::Color::Name::BrightRed);
+  CHECK(Term::Color(Term::Color::Name::Cyan).to4bits() == Term::Color::Name::Cyan);
+  CHECK(Term::Color(Term::Color::Name::BrightCyan).to3bits() == Term::Color::Name::Cyan);
+  const std::vector<std::uint8_t> pixels{255, 0, 0, 0, 0, 0};
+  std::vector<Term::Color::Name>  colors(2);
+  Term::to4bits(pixels.data(), 2, colors.data());
+  CHECK(colors == std::vector<Term::Color::Name>{Term::Color::Name::BrightRed, Term::Color::Name::Black});
+}
+
+TEST_CASE("color sequences")
+{
+  const Term::Terminfo terminfo;  // sets the color mode from the environment
+  switch(Term::Terminfo::getColorMode())
+  {
+    case Term::Terminfo::ColorMode::Bit24:
+      CHECK(Term::color_fg(Term::Color::Name::Red) == "\u001b[31m");
+      CHECK(Term::color_bg(Term::Color::Name::BrightWhite) == "\u001b[107m\u001b[K");
+      CHECK(Term::color_fg(Term::Color::Name::Default) == "\u001b[39m");
+      CHECK(Term::color_fg(0) == "\u001b[38;5;0m");
+      CHECK(Term::color_bg(255) == "\u001b[48;5;255m\u001b[K");
+      CHECK(Term::color_fg(0, 9, 10) == "\u001b[38;2;0;9;10m");
+      CHECK(Term::color_bg(99, 100, 255) == "\u001b[48;2;99;100;255m\u001b[K");
+      break;
+    case Term::Terminfo::ColorMode::Bit8:
+      CHECK(Term::color_fg(Term::Color::Name::Red) == "\u001b[31m");
+      CHECK(Term::color_bg(42) == "\u001b[48;5;42m\u001b[K");
+      CHECK(Term::color_fg(255, 255, 255) == "\u001b[38;5;255m");
+      break;
+    case Term::Terminfo::ColorMode::Bit4:
+      CHECK(Term::color_fg(Term::Color::Name::BrightRed) == "\u001b[91m");
+      CHECK(Term::color_bg(1) == "\u001b[41m\u001b[K");
+      break;
+    default: break;
+  }
+  CHECK(Term::color_fg(Term::Color()).empty());
+  CHECK(Term::color_bg(Term::Color()).empty());
+  // The appending variants produce the same sequences
+  std::string expected;
+  std::string out{"abc"};
+  for(std::size_t i = 0; i != 256; ++i)
+  {
+    const std::uint8_t value{static_cast<std::uint8_t>(i)};
+    expected += Term::color_fg(value) + Term::color_bg(value) + Term::color_fg(value, static_cast<std::uint8_t>(255 - i), 7) + Term::color_bg(Term::Color(static_cast<Term::Color::Name>(value % 68)));
+    Term::append_color_fg(out, value);
+    Term::append_color_bg(out, value);
+    Term::append_color_fg(out, Term::Color(value, static_cast<std::uint8_t>(255 - i), 7));
+    Term::append_color_bg(out, static_cast<Term::Color::Name>(value % 68));
+  }
+  CHECK(out == "abc" + expected);
+}
+
+TEST_CASE("style sequences")
+{
+  CHECK(Term::style(Term::Style::Reset) == "\u001b[0m");
+  CHECK(Term::style(Term::Style::Bold) == "\u001b[1m");
+  CHECK(Term::style(Term::Style::DefaultBackgroundColor) == "\u001b[49m\u001b[K");
+  CHECK(Term::style(Term::Style::ResetSubscript) == "\u001b[75m");
+  CHECK(Term::style(static_cast<Term::Style>(255)) == "\u001b[255m");
+  std::string out;
+  Term::append_style(out, Term::Style::Underline);
+  Term::append_style(out, Term::Style::ResetUnderline);
+  CHECK(out == "\u001b[4m\u001b[24m");
+}
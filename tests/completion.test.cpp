@@ -0,0 +1,206 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/completion.hpp"
+
+#include "cpp-terminal/emulator.hpp"
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/private/blocking_queue.hpp"
+#include "cpp-terminal/private/completion_worker.hpp"
+#include "cpp-terminal/prompt.hpp"
+#include "cpp-terminal/window.hpp"
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+// Counts the ready notifications of a CompletionWorker
+class Ready
+{
+public:
+  void notify()
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_count;
+    m_condition.notify_all();
+  }
+  bool wait(const std::size_t& count)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_condition.wait_for(lock, std::chrono::seconds(10), [this, &count]() { return m_count >= count; });
+  }
+
+private:
+  std::mutex              m_mutex;
+  std::condition_variable m_condition;
+  std::size_t             m_count{0};
+};
+
+// Blocks until it is cancelled when asked to complete "slow"
+class Slow : public Term::Completer
+{
+public:
+  Term::Completion complete(const std::string& input, const std::atomic<bool>& cancelled) const override
+  {
+    if(input == "throw") { throw std::runtime_error("no completion"); }
+    if(input == "slow")
+    {
+      started = true;
+      while(!cancelled) { std::this_thread::yield(); }
+    }
+    return Term::Completion(0, std::vector<std::string>{input + "!"});
+  }
+  mutable std::atomic<bool> started{false};
+};
+
+}  // namespace
+
+TEST_CASE("Trie")
+{
+  const Term::Trie trie({"select", "sel", "selection", "from", "sel", "set", "where", "s\xc3\xa9lection", ""});
+  CHECK(trie.size() == 8);
+  CHECK(trie[0] == "");
+  CHECK(trie[1] == "from");
+  CHECK(trie[7] == "where");
+  CHECK_THROWS_AS(trie[8], Term::Exception);
+  CHECK(trie.range("") == std::make_pair(std::size_t{0}, std::size_t{8}));
+  CHECK(trie.range("s") == std::make_pair(std::size_t{2}, std::size_t{7}));
+  CHECK(trie.range("sel") == std::make_pair(std::size_t{2}, std::size_t{5}));
+  CHECK(trie.range("sele") == std::make_pair(std::size_t{3}, std::size_t{5}));
+  CHECK(trie.range("selection") == std::make_pair(std::size_t{4}, std::size_t{5}));
+  CHECK(trie.range("s\xc3") == std::make_pair(std::size_t{6}, std::size_t{7}));
+  CHECK(trie.range("selections").first == trie.range("selections").second);
+  CHECK(trie.range("x").first == trie.range("x").second);
+  CHECK(trie.range("sa").first == trie.range("sa").second);
+  const Term::Trie empty;
+  CHECK(empty.empty());
+  CHECK(empty.range("a").first == empty.range("a").second);
+}
+
+TEST_CASE("Trie against a sorted vector")
+{
+  // Identifiers sharing long prefixes, with every range checked against two binary searches
+  std::vector<std::string> words;
+  for(std::size_t i = 0; i != 5000; ++i) { words.push_back("table_" + std::to_string(i * 7919 % 1000) + "_column_" + std::to_string(i % 37)); }
+  const Term::Trie trie(words);
+  std::sort(words.begin(), words.end());
+  words.erase(std::unique(words.begin(), words.end()), words.end());
+  REQUIRE(trie.size() == words.size());
+  for(std::size_t i = 0; i < words.size(); i += 13)
+  {
+    for(std::size_t length = 0; length <= words[i].size() + 1; ++length)
+    {
+      const std::string                         prefix{words[i].substr(0, length) + (length > words[i].size() ? "9" : "")};
+      const std::pair<std::size_t, std::size_t> found{trie.range(prefix)};
+      const std::size_t                         first{static_cast<std::size_t>(std::lower_bound(words.begin(), words.end(), prefix) - words.begin())};
+      std::size_t                               last{first};
+      while(last != words.size() && words[last].compare(0, prefix.size(), prefix) == 0) { ++last; }
+      CAPTURE(prefix);
+      CHECK(found.second - found.first == last - first);
+      if(last != first) { CHECK(found.first == first); }
+    }
+  }
+}
+
+TEST_CASE("Trie completion")
+{
+  const Term::Trie        trie({"users", "user_id", "updated_at", "public.users"});
+  const std::atomic<bool> cancelled{false};
+  const Term::Completion  completion{trie.complete("SELECT u", cancelled)};
+  CHECK(completion.start() == 7);
+  REQUIRE(completion.size() == 3);
+  CHECK(completion[0] == "updated_at");
+  CHECK(completion[2] == "users");
+  CHECK_THROWS_AS(completion[3], Term::Exception);
+  CHECK(trie.complete("FROM public.u", cancelled)[0] == "public.users");
+  CHECK(trie.complete("x = (us", cancelled).start() == 5);
+  CHECK(trie.complete("SELECT ", cancelled).size() == 4);
+  CHECK(trie.complete("SELECT z", cancelled).empty());
+}
+
+TEST_CASE("CompletionWorker")
+{
+  Slow                            completer;
+  Ready                           ready;
+  Term::Completion                completion;
+  Term::Private::CompletionWorker worker(completer, [&ready]() { ready.notify(); });
+  CHECK_FALSE(worker.take(completion));
+  worker.request("sel");
+  REQUIRE(ready.wait(1));
+  REQUIRE(worker.take(completion));
+  CHECK(completion[0] == "sel!");
+  CHECK_FALSE(worker.take(completion));
+  // Typing supersedes a request still running: it is cancelled and only the last one is answered
+  worker.request("slow");
+  while(!completer.started) { std::this_thread::yield(); }
+  worker.request("select");
+  REQUIRE(ready.wait(2));
+  REQUIRE(worker.take(completion));
+  CHECK(completion[0] == "select!");
+  // Exceptions reach the prompt
+  worker.request("throw");
+  REQUIRE(ready.wait(3));
+  CHECK_THROWS_AS(worker.take(completion), std::runtime_error);
+  // A cancelled request is never answered
+  worker.request("slow");
+  worker.cancel();
+  CHECK_FALSE(worker.take(completion));
+}
+
+TEST_CASE("Wakeups dropped once their owner is done")
+{
+  Slow                            completer;
+  Term::Private::BlockingQueue    queue;
+  const int                       owner{0};
+  Term::Private::CompletionWorker worker(completer, [&queue, &owner]() { queue.push_wakeup(&owner); });
+  worker.request("sel");
+  queue.wait_for_events();
+  queue.push(Term::Event(Term::Key(Term::Key::Enter)));
+  queue.push(Term::Event());
+  queue.discard(&owner);
+  // The events of the others are kept, in order
+  REQUIRE(queue.size() == 2);
+  CHECK(queue.pop().type() == Term::Event::Type::Key);
+  CHECK(queue.pop().type() == Term::Event::Type::Empty);
+}
+
+TEST_CASE("Completion popup")
+{
+  std::size_t            produced{0};
+  const Term::Completion completion(0, 500000, [&produced](const std::size_t& index) { ++produced; return "column_" + std::to_string(index); });
+  Term::Window           window(30, 12);
+  Term::render_completion(window, completion, 10, 5, 2);
+  CHECK(produced == 8);  // the visible candidates only
+  Term::Emulator emulator(12, 30);
+  emulator.feed(window.render(1, 1, true));
+  // Scrolled to keep the selected candidate on the last row, its position below
+  CHECK(emulator.row(2).find("column_3") == 5);
+  CHECK(emulator.row(9).find("column_10") == 5);
+  CHECK(emulator.cell(9, 6).has(Term::Style::Reversed));
+  CHECK_FALSE(emulator.cell(8, 6).has(Term::Style::Reversed));
+  CHECK(emulator.row(10).find("11/500000") == 5);
+  CHECK(emulator.row(11).find_first_not_of(' ') == std::string::npos);
+  // Moved left to fit
+  Term::Window narrow(12, 12);
+  Term::render_completion(narrow, completion, 0, 8, 1);
+  Term::Emulator small(12, 12);
+  small.feed(narrow.render(1, 1, true));
+  CHECK(small.row(1).find("column_0") == 3);
+}
@@ -0,0 +1,166 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/emulator.hpp"
+
+#include "cpp-terminal/exception.hpp"
+#include "doctest/doctest.h"
+
+#include <string>
+
+TEST_CASE("Text and autowrap")
+{
+  Term::Emulator emulator(3, 5);
+  emulator.feed("Hello World");
+  CHECK(emulator.text() == "Hello\n Worl\nd");
+  CHECK(emulator.cursor().row() == 3);
+  CHECK(emulator.cursor().column() == 2);
+  CHECK(emulator.bytes() == 11);
+  emulator.feed("\n!");
+  CHECK(emulator.text() == " Worl\nd\n!");
+  CHECK_THROWS_AS(Term::Emulator(0, 5), Term::Exception);
+}
+
+TEST_CASE("Cursor movement and erase")
+{
+  Term::Emulator emulator(3, 10);
+  emulator.feed("0123456789\r\nabcdefghij");
+  emulator.feed("\u001b[1;4H\u001b[K");
+  CHECK(emulator.row(1) == "012       ");
+  emulator.feed("\u001b[2;5H\u001b[1K");
+  CHECK(emulator.row(2) == "     fghij");
+  emulator.feed("\u001b[2C\u001b[2P");
+  CHECK(emulator.row(2) == "     fij  ");
+  emulator.feed("\u001b[2J\u001b[H");
+  CHECK(emulator.text() == "\n\n");
+  CHECK(emulator.cursor().row() == 1);
+  CHECK(emulator.cursor().column() == 1);
+}
+
+TEST_CASE("SGR")
+{
+  Term::Emulator emulator(1, 10);
+  emulator.feed("\u001b[1;31ma\u001b[22;4;38;5;200;48;2;1;2;3mb\u001b[0;95;107mc\u001b[md");
+  CHECK(emulator.cell(1, 1).has(Term::Style::Bold));
+  CHECK(emulator.cell(1, 1).fg == Term::Color::Name::Red);
+  CHECK(!emulator.cell(1, 2).has(Term::Style::Bold));
+  CHECK(emulator.cell(1, 2).has(Term::Style::Underline));
+  CHECK(emulator.cell(1, 2).fg == Term::Color(200));
+  CHECK(emulator.cell(1, 2).bg == Term::Color(1, 2, 3));
+  CHECK(emulator.cell(1, 3).fg == Term::Color::Name::BrightMagenta);
+  CHECK(emulator.cell(1, 3).bg == Term::Color::Name::BrightWhite);
+  Term::Emulator::Cell plain;
+  plain.character = U'd';
+  CHECK(emulator.cell(1, 4) == plain);
+}
+
+TEST_CASE("Scrolling region")
+{
+  Term::Emulator emulator(4, 3);
+  emulator.feed("a\nb\nc\nd");
+  emulator.feed("\u001b[2;3r\u001b[3;1H\n");
+  CHECK(emulator.text() == "a\nc\n\nd");
+  emulator.feed("\u001b[2;1H\u001bM");
+  CHECK(emulator.text() == "a\n\nc\nd");
+  emulator.feed("\u001b[r\u001b[S");
+  CHECK(emulator.text() == "\nc\nd\n");
+}
+
+TEST_CASE("UTF-8 split across feeds")
+{
+  Term::Emulator emulator(1, 6);
+  const std::string text{"é你\U0001F600"};
+  for(const char byte: text) { emulator.feed(&byte, 1); }
+  CHECK(emulator.cell(1, 1).character == U'é');
+  CHECK(emulator.cell(1, 2).character == U'你');
+  CHECK(emulator.cell(1, 4).character == U'\U0001F600');
+  emulator.feed("\xff");
+  CHECK(emulator.cell(1, 6).character == U'�');
+}
+
+TEST_CASE("Replies, strings and modes")
+{
+  Term::Emulator emulator(5, 20);
+  emulator.feed("\u001b[3;7H\u001b[6n\u001b]0;title\u0007\u001b]2;other\u001b\\x");
+  CHECK(emulator.responses() == "\u001b[3;7R");
+  CHECK(emulator.responses().empty());
+  emulator.feed("\u001b[c");
+  CHECK(emulator.responses() == "\u001b[?62;22c");
+  CHECK(emulator.cell(3, 7).character == U'x');
+  emulator.feed("\u001b[?25l\u001b[?1049h");
+  CHECK(!emulator.cursor_visible());
+  CHECK(emulator.text() == "\n\n\n\n");
+  emulator.feed("alt\u001b[?1049l");
+  CHECK(emulator.cell(3, 7).character == U'x');
+  CHECK(emulator.cursor().column() == 8);
+}
+
+TEST_CASE("Resize")
+{
+  Term::Emulator emulator(3, 6);
+  emulator.feed("main\r\nscreen");
+  emulator.resize(2, 4);
+  CHECK(emulator.text() == "main\nscre");
+  // The main screen saved by the alternate one is kept too
+  emulator.feed("\u001b[?1049h\u001b[Halt");
+  emulator.resize(3, 8);
+  CHECK(emulator.text() == "alt\n\n");
+  emulator.feed("\u001b[?1049l");
+  CHECK(emulator.text() == "main\nscre\n");
+  CHECK_THROWS_AS(emulator.resize(0, 8), Term::Exception);
+}
+
+TEST_CASE("Long parameters")
+{
+  // Parameters past the limit are ignored, the sequence still ends at its final byte
+  Term::Emulator emulator(2, 10);
+  std::string    sequence{"\u001b["};
+  for(std::size_t i = 0; i != 100000; ++i) { sequence += "1;"; }
+  emulator.feed(sequence + "31mx\u001b[2;3Hy");
+  CHECK(emulator.cell(1, 1).character == U'x');
+  CHECK(emulator.cell(2, 3).character == U'y');
+}
+
+TEST_CASE("Wide characters")
+{
+  Term::Emulator emulator(2, 5);
+  emulator.feed("a\xe4\xbd\xa0" "b");
+  CHECK(emulator.cell(1, 2).character == U'你');
+  CHECK(emulator.cell(1, 3).character == U'\0');
+  CHECK(emulator.cell(1, 4).character == U'b');
+  CHECK(emulator.cursor().column() == 5);
+  // No room on the last column: wrap
+  emulator.feed("c\xe5\xa5\xbd");
+  CHECK(emulator.row(1) == "a\xe4\xbd\xa0" "bc");
+  CHECK(emulator.row(2) == "\xe5\xa5\xbd   ");
+  CHECK(emulator.cursor().column() == 3);
+}
+
+TEST_CASE("Grapheme clusters")
+{
+  Term::Emulator emulator(2, 6);
+  emulator.feed("e\xcc\x81\xcc\xa3" "a");  // e with two accents
+  CHECK(emulator.cell(1, 1).character == U'e');
+  CHECK(emulator.cell(1, 1).combining == U"\u0301\u0323");
+  CHECK(emulator.cell(1, 2).character == U'a');
+  CHECK(emulator.cursor().column() == 3);
+  // VS16 makes the heart wide, the flag is two regional indicators
+  emulator.feed("\xe2\x9d\xa4\xef\xb8\x8f\xf0\x9f\x87\xab\xf0\x9f\x87\xb7");
+  CHECK(emulator.cell(1, 3).combining == U"\uFE0F");
+  CHECK(emulator.cell(1, 4).character == U'\0');
+  CHECK(emulator.cell(1, 5).character == U'\U0001F1EB');
+  CHECK(emulator.cell(1, 5).combining == U"\U0001F1F7");
+  CHECK(emulator.row(1) == "e\xcc\x81\xcc\xa3" "a\xe2\x9d\xa4\xef\xb8\x8f\xf0\x9f\x87\xab\xf0\x9f\x87\xb7");
+  // A control character ends the cluster
+  emulator.feed("\r\n\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x92\xbb\b\xcc\x81");
+  CHECK(emulator.cell(2, 1).combining == U"\u200D\U0001F4BB");
+  CHECK(emulator.cell(2, 2).character == U'\0');
+  CHECK(emulator.cursor().column() == 2);
+}
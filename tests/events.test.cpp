@@ -9,8 +9,11 @@
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "cpp-terminal/event.hpp"
+#include "cpp-terminal/latency.hpp"
 #include "doctest/doctest.h"
 
+#include <thread>
+
 TEST_CASE("default Event")
 {
   Term::Event event;
@@ -191,3 +194,37 @@ TEST_CASE("Event with CopyPaste")
   CHECK(*event2.get_if_copy_paste() == "toto");
   CHECK(event2.type() == Term::Event::Type::CopyPaste);
 }
+
+TEST_CASE("Event timestamp")
+{
+  const std::chrono::steady_clock::time_point before{std::chrono::steady_clock::now()};
+  Term::Event                                 event(Term::Key(Term::Key::Value::a));
+  CHECK(event.timestamp() >= before);
+  CHECK(event.timestamp() <= std::chrono::steady_clock::now());
+  std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  const Term::Event copy{event};
+  CHECK(copy.timestamp() == event.timestamp());
+  Term::Event assigned;
+  assigned = event;
+  CHECK(assigned.timestamp() == event.timestamp());
+  const Term::Event moved{std::move(event)};
+  CHECK(moved.timestamp() == copy.timestamp());
+}
+
+TEST_CASE("FrameLatency")
+{
+  Term::FrameLatency latency;
+  latency.input(Term::Event());  // empty events are ignored
+  latency.input(Term::Event(Term::Key(Term::Key::Value::a)));
+  latency.input(Term::Event(Term::Key(Term::Key::Value::b)));
+  std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  latency.flushed();
+  latency.flushed();  // nothing pending
+  CHECK(latency.frames() == 2);
+  CHECK(latency.histogram().count() == 2);
+  CHECK(latency.histogram().min() >= 2000000);
+  CHECK(latency.report().find("frames: 2, inputs: 2") == 0);
+  latency.reset();
+  CHECK(latency.frames() == 0);
+  CHECK(latency.histogram().count() == 0);
+}
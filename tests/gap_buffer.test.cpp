@@ -0,0 +1,142 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/gap_buffer.hpp"
+
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/model.hpp"
+#include "doctest/doctest.h"
+
+#include <cstddef>
+#include <string>
+
+namespace
+{
+
+// The line index of buffer against the one of its text
+void check_lines(const Term::GapBuffer& buffer)
+{
+  const std::string text{buffer.str()};
+  std::size_t       line{0};
+  std::size_t       begin{0};
+  for(std::size_t i = 0; i <= text.size(); ++i)
+  {
+    CAPTURE(i);
+    CHECK(buffer.line_of(i) == line);
+    if(i == text.size() || text[i] == '\n')
+    {
+      CHECK(buffer.line_begin(line) == begin);
+      CHECK(buffer.line_end(line) == i);
+      ++line;
+      begin = i + 1;
+    }
+  }
+  CHECK(buffer.lines() == line);
+}
+
+}  // namespace
+
+TEST_CASE("Gap buffer")
+{
+  Term::GapBuffer buffer;
+  CHECK(buffer.empty());
+  CHECK(buffer.lines() == 1);
+  buffer.insert(0, "hello world");
+  buffer.insert(5, ',');
+  CHECK(buffer.str() == "hello, world");
+  buffer.insert(0, "> ");
+  buffer.insert(buffer.size(), '!');
+  CHECK(buffer.str() == "> hello, world!");
+  CHECK(buffer[2] == 'h');
+  CHECK(buffer.substr(4, 6) == "llo, w");
+  buffer.erase(7, 100);
+  CHECK(buffer.str() == "> hello");
+  buffer.erase(0, 2);
+  CHECK(buffer.str() == "hello");
+  CHECK_THROWS_AS(buffer.insert(6, 'x'), Term::Exception);
+  CHECK_THROWS_AS(buffer.substr(6, 1), Term::Exception);
+  // Large inserts grow the buffer
+  const std::string large(100000, 'x');
+  buffer.insert(2, large);
+  CHECK(buffer.size() == 100005);
+  CHECK(buffer.substr(0, 3) == "hex");
+  CHECK(buffer.substr(100001, 4) == "xllo");
+}
+
+TEST_CASE("Line index")
+{
+  Term::GapBuffer buffer("first\nsecond\n\nfourth");
+  check_lines(buffer);
+  // Edits on both sides of every line, moving the gap back and forth
+  buffer.insert(0, "a\nb");
+  check_lines(buffer);
+  buffer.insert(buffer.size(), "\nlast\n");
+  check_lines(buffer);
+  buffer.insert(9, '\n');
+  check_lines(buffer);
+  buffer.erase(1, 1);
+  check_lines(buffer);
+  CHECK(buffer.str() == "abfirst\n\nsecond\n\nfourth\nlast\n");
+  buffer.erase(8, 3);
+  check_lines(buffer);
+  buffer.insert(3, "x\ny\n");
+  check_lines(buffer);
+  buffer.erase(0, buffer.size());
+  check_lines(buffer);
+  CHECK(buffer.lines() == 1);
+  CHECK_THROWS_AS(buffer.line_begin(1), Term::Exception);
+}
+
+TEST_CASE("Model")
+{
+  Term::Model model;
+  CHECK(model.str() == "\n");
+  model.insert("select *");
+  model.new_line();
+  model.insert("from t;");
+  CHECK(model.lines() == 2);
+  CHECK(model.line(1) == "select *");
+  CHECK(model.line(2) == "from t;");
+  CHECK(model.str() == "select *\nfrom t;\n");
+  CHECK(model.cursor_row() == 2);
+  CHECK(model.cursor_col() == 8);
+  // Up and down keep the column when they can
+  CHECK(model.move_up());
+  CHECK(model.cursor_col() == 8);
+  CHECK_FALSE(model.move_up());
+  model.move_left();
+  model.move_left();
+  CHECK(model.move_down());
+  CHECK(model.cursor_col() == 6);
+  CHECK_FALSE(model.move_down());
+  // Backspace at the start of a line joins it to the previous one
+  model.move_home();
+  model.erase_before();
+  CHECK(model.line(1) == "select *from t;");
+  CHECK(model.cursor_col() == 9);
+  model.erase_after();
+  CHECK(model.line(1) == "select *rom t;");
+  model.move_end();
+  CHECK(model.cursor_col() == 15);
+  model.move_right();
+  CHECK(model.cursor_col() == 15);
+  // Multibyte characters move and erase as one column
+  model.assign("aé你\n");
+  CHECK(model.lines() == 1);
+  CHECK(model.cursor_col() == 4);
+  model.move_left();
+  CHECK(model.cursor_col() == 3);
+  model.erase_before();
+  CHECK(model.line(1) == "a你");
+  model.set_cursor(7, 7);
+  CHECK(model.cursor_col() == 3);
+  model.insert("\nb");
+  CHECK(model.str() == "a你\nb\n");
+}
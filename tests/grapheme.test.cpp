@@ -0,0 +1,93 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/private/grapheme.hpp"
+
+#include "doctest/doctest.h"
+
+#include <string>
+#include <vector>
+
+TEST_CASE("grapheme_break")
+{
+  CHECK(Term::Private::grapheme_break(U'a') == Term::Private::GraphemeBreak::Other);
+  CHECK(Term::Private::grapheme_break(U'\r') == Term::Private::GraphemeBreak::CR);
+  CHECK(Term::Private::grapheme_break(U'\n') == Term::Private::GraphemeBreak::LF);
+  CHECK(Term::Private::grapheme_break(U'\u0007') == Term::Private::GraphemeBreak::Control);
+  CHECK(Term::Private::grapheme_break(U'\u200B') == Term::Private::GraphemeBreak::Control);  // ZERO WIDTH SPACE
+  CHECK(Term::Private::grapheme_break(U'\u0301') == Term::Private::GraphemeBreak::Extend);
+  CHECK(Term::Private::grapheme_break(U'\u200C') == Term::Private::GraphemeBreak::Extend);  // ZERO WIDTH NON-JOINER
+  CHECK(Term::Private::grapheme_break(U'\U0001F3FB') == Term::Private::GraphemeBreak::Extend);  // skin tone
+  CHECK(Term::Private::grapheme_break(U'\u200D') == Term::Private::GraphemeBreak::ZWJ);
+  CHECK(Term::Private::grapheme_break(U'\U0001F1E6') == Term::Private::GraphemeBreak::RegionalIndicator);
+  CHECK(Term::Private::grapheme_break(U'\u0600') == Term::Private::GraphemeBreak::Prepend);
+  CHECK(Term::Private::grapheme_break(U'\u0903') == Term::Private::GraphemeBreak::SpacingMark);
+  CHECK(Term::Private::grapheme_break(U'\u1100') == Term::Private::GraphemeBreak::L);
+  CHECK(Term::Private::grapheme_break(U'\u1161') == Term::Private::GraphemeBreak::V);
+  CHECK(Term::Private::grapheme_break(U'\u11A8') == Term::Private::GraphemeBreak::T);
+  CHECK(Term::Private::grapheme_break(U'\uAC00') == Term::Private::GraphemeBreak::LV);
+  CHECK(Term::Private::grapheme_break(U'\uAC01') == Term::Private::GraphemeBreak::LVT);
+  CHECK(Term::Private::grapheme_break(U'\u2764') == Term::Private::GraphemeBreak::ExtendedPictographic);
+  CHECK(Term::Private::grapheme_break(U'\U0001F468') == Term::Private::GraphemeBreak::ExtendedPictographic);
+  CHECK(Term::Private::grapheme_break(static_cast<char32_t>(0x110000)) == Term::Private::GraphemeBreak::Other);
+}
+
+TEST_CASE("graphemes")
+{
+  using Clusters = std::vector<std::u32string>;
+  CHECK(Term::Private::graphemes(U"") == Clusters{});
+  CHECK(Term::Private::graphemes(U"ab") == Clusters{U"a", U"b"});
+  CHECK(Term::Private::graphemes(U"a\r\n\n\r") == Clusters{U"a", U"\r\n", U"\n", U"\r"});  // GB3, GB4, GB5
+  CHECK(Term::Private::graphemes(U"\u1100\u1161\u11A8\uAC00\u11A8\u1100") == Clusters{U"\u1100\u1161\u11A8", U"\uAC00\u11A8", U"\u1100"});  // GB6, GB7, GB8
+  CHECK(Term::Private::graphemes(U"e\u0301\u0323\u200Dx") == Clusters{U"e\u0301\u0323\u200D", U"x"});  // GB9
+  CHECK(Term::Private::graphemes(U"\u0915\u093F\u0903") == Clusters{U"\u0915\u093F\u0903"});  // GB9a
+  CHECK(Term::Private::graphemes(U"\u0600\u0661") == Clusters{U"\u0600\u0661"});  // GB9b
+  CHECK(Term::Private::graphemes(U"\n\u0301") == Clusters{U"\n", U"\u0301"});
+  // GB11: emoji ZWJ sequences, with modifiers
+  CHECK(Term::Private::graphemes(U"\U0001F468\u200D\U0001F469\u200D\U0001F467") == Clusters{U"\U0001F468\u200D\U0001F469\u200D\U0001F467"});
+  CHECK(Term::Private::graphemes(U"\U0001F469\U0001F3FD\u200D\U0001F4BB") == Clusters{U"\U0001F469\U0001F3FD\u200D\U0001F4BB"});
+  CHECK(Term::Private::graphemes(U"a\u200D\U0001F469") == Clusters{U"a\u200D", U"\U0001F469"});
+  CHECK(Term::Private::graphemes(U"\U0001F468\u200D\u0301\U0001F469") == Clusters{U"\U0001F468\u200D\u0301", U"\U0001F469"});
+  // GB12, GB13: regional indicators by pairs
+  CHECK(Term::Private::graphemes(U"\U0001F1EB\U0001F1F7\U0001F1E9\U0001F1EA\U0001F1EE") == Clusters{U"\U0001F1EB\U0001F1F7", U"\U0001F1E9\U0001F1EA", U"\U0001F1EE"});
+  CHECK(Term::Private::graphemes(U"a\U0001F1EB\U0001F1F7\u0301\U0001F1E9") == Clusters{U"a", U"\U0001F1EB\U0001F1F7\u0301", U"\U0001F1E9"});
+}
+
+TEST_CASE("grapheme_size")
+{
+  const std::u32string str{U"e\u0301\U0001F1EB\U0001F1F7"};
+  CHECK(Term::Private::grapheme_size(str.data(), 0) == 0);
+  CHECK(Term::Private::grapheme_size(str.data(), 1) == 1);
+  CHECK(Term::Private::grapheme_size(str.data(), str.size()) == 2);
+  CHECK(Term::Private::grapheme_size(str.data() + 2, 2) == 2);
+}
+
+TEST_CASE("grapheme_width")
+{
+  const std::u32string ascii{U"a"};
+  const std::u32string accent{U"e\u0301"};
+  const std::u32string wide{U"\u4F60\u0301"};
+  const std::u32string heart{U"\u2764\uFE0F"};
+  const std::u32string text_heart{U"\u2764\uFE0E"};
+  const std::u32string flag{U"\U0001F1EB\U0001F1F7"};
+  const std::u32string family{U"\U0001F468\u200D\U0001F469\u200D\U0001F467"};
+  const std::u32string jamo{U"\u1100\u1161\u11A8"};
+  const std::u32string control{U"\u0007"};
+  CHECK(Term::Private::grapheme_width(ascii.data(), 0) == 0);
+  CHECK(Term::Private::grapheme_width(ascii.data(), ascii.size()) == 1);
+  CHECK(Term::Private::grapheme_width(accent.data(), accent.size()) == 1);
+  CHECK(Term::Private::grapheme_width(wide.data(), wide.size()) == 2);
+  CHECK(Term::Private::grapheme_width(heart.data(), heart.size()) == 2);
+  CHECK(Term::Private::grapheme_width(text_heart.data(), text_heart.size()) == 1);
+  CHECK(Term::Private::grapheme_width(flag.data(), flag.size()) == 2);
+  CHECK(Term::Private::grapheme_width(family.data(), family.size()) == 2);
+  CHECK(Term::Private::grapheme_width(jamo.data(), jamo.size()) == 2);
+  CHECK(Term::Private::grapheme_width(control.data(), control.size()) == -1);
+}
@@ -0,0 +1,142 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/graphics.hpp"
+
+#include "cpp-terminal/emulator.hpp"
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/image.hpp"
+#include "doctest/doctest.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+std::size_t count(const std::string& str, const std::string& pattern)
+{
+  std::size_t ret{0};
+  for(std::size_t found = str.find(pattern); found != std::string::npos; found = str.find(pattern, found + 1)) { ++ret; }
+  return ret;
+}
+
+}  // namespace
+
+TEST_CASE("Capability probe")
+{
+  CHECK(Term::graphics_support("\u001b_Gi=31;OK\u001b\\\u001b[?62;4;22c") == Term::Graphics::Kitty);
+  CHECK(Term::graphics_support("\u001b_Gi=31;ENOENT:bad\u001b\\\u001b[?62;4;22c") == Term::Graphics::Sixel);
+  CHECK(Term::graphics_support("\u001b[?64;1;2;4;6c") == Term::Graphics::Sixel);
+  CHECK(Term::graphics_support("\u001b[?62;22c") == Term::Graphics::None);
+  // 4 as conformance level is not Sixel
+  CHECK(Term::graphics_support("\u001b[?4;6c") == Term::Graphics::None);
+  CHECK(Term::graphics_support("") == Term::Graphics::None);
+  // A terminal without inline images skips the kitty query and answers DA1
+  Term::Emulator emulator(2, 10);
+  emulator.feed(Term::graphics_query());
+  CHECK(emulator.text() == "\n");
+  CHECK(Term::graphics_support(emulator.responses()) == Term::Graphics::None);
+}
+
+TEST_CASE("Sixel")
+{
+  Term::SixelEncoder              encoder;
+  const std::vector<std::uint8_t> pixels{255, 0, 0, 0, 0, 255};
+  std::string                     out;
+  encoder.encode(out, Term::Image(pixels.data(), 2, 1));
+  CHECK(out == "\u001bP0;1;0q\"1;1;2;1#0;2;0;0;100#1;2;100;0;0#0?@$#1@\u001b\\");
+  // Runs of 4 sixels or more are compressed, bands of 6 rows are separated by '-'
+  const std::vector<std::uint8_t> black(10 * 7 * 3, 0);
+  out.clear();
+  encoder.encode(out, Term::Image(black.data(), 10, 7));
+  CHECK(out == "\u001bP0;1;0q\"1;1;10;7#0;2;0;0;0#0!10~-#0!10@\u001b\\");
+  // Transparent pixels are not drawn
+  const std::vector<std::uint8_t> rgba{9, 9, 9, 0, 255, 255, 255, 255, 1, 1, 1, 127};
+  out.clear();
+  encoder.encode(out, Term::Image(rgba.data(), 3, 1, 4));
+  CHECK(out == "\u001bP0;1;0q\"1;1;3;1#0;2;100;100;100#0?@\u001b\\");
+  CHECK_THROWS_AS(Term::SixelEncoder(0), Term::Exception);
+  CHECK_THROWS_AS(Term::SixelEncoder(257), Term::Exception);
+}
+
+TEST_CASE("Sixel palette")
+{
+  // A gradient of 4096 colors reduced to 16
+  std::vector<std::uint8_t> pixels;
+  for(std::size_t i = 0; i != 4096; ++i)
+  {
+    pixels.push_back(static_cast<std::uint8_t>((i & 0xF) << 4));
+    pixels.push_back(static_cast<std::uint8_t>(((i >> 4) & 0xF) << 4));
+    pixels.push_back(static_cast<std::uint8_t>((i >> 8) << 4));
+  }
+  Term::SixelEncoder encoder(16);
+  std::string        out;
+  encoder.encode(out, Term::Image(pixels.data(), 64, 64));
+  CHECK(count(out, ";2;") == 16);
+  CHECK(count(out, "#15;2;") == 1);
+  CHECK(count(out, "#16") == 0);
+  // The same encoder again gives the same output, with another image in between
+  std::string again;
+  std::string other;
+  encoder.encode(other, Term::Image(pixels.data(), 32, 32));
+  encoder.encode(again, Term::Image(pixels.data(), 64, 64));
+  CHECK(again == out);
+}
+
+TEST_CASE("Kitty")
+{
+  Term::KittyEncoder        encoder;
+  std::vector<std::uint8_t> pixels{1, 2, 3};
+  std::string               out;
+  encoder.encode(out, Term::Image(pixels.data(), 1, 1), 7);
+  CHECK(out == "\u001b_Ga=T,f=24,s=1,v=1,i=7,q=2,m=0;AQID\u001b\\");
+  // Unchanged: only placed
+  out.clear();
+  encoder.encode(out, Term::Image(pixels.data(), 1, 1), 7, 10, 5);
+  CHECK(out == "\u001b_Ga=p,i=7,c=10,r=5,q=2\u001b\\");
+  // Changed or erased: sent again
+  pixels[0] = 4;
+  out.clear();
+  encoder.encode(out, Term::Image(pixels.data(), 1, 1), 7);
+  CHECK(out == "\u001b_Ga=T,f=24,s=1,v=1,i=7,q=2,m=0;BAID\u001b\\");
+  out.clear();
+  encoder.erase(out, 7);
+  CHECK(out == "\u001b_Ga=d,d=I,i=7,q=2\u001b\\");
+  out.clear();
+  encoder.encode(out, Term::Image(pixels.data(), 1, 1), 7);
+  CHECK(count(out, "a=T") == 1);
+  encoder.clear();
+  out.clear();
+  encoder.encode(out, Term::Image(pixels.data(), 1, 1), 7);
+  CHECK(count(out, "a=T") == 1);
+  // RGBA with padding, rows with a stride
+  const std::vector<std::uint8_t> rgba{1, 2, 3, 4, 0, 0, 0, 0, 5, 6, 7, 8};
+  out.clear();
+  encoder.encode(out, Term::Image(rgba.data(), 1, 2, 4, 8), 8);
+  CHECK(out == "\u001b_Ga=T,f=32,s=1,v=2,i=8,q=2,m=0;AQIDBAUGBwg=\u001b\\");
+}
+
+TEST_CASE("Kitty chunks")
+{
+  const std::vector<std::uint8_t> pixels(2048 * 3, 0);
+  Term::KittyEncoder              encoder;
+  std::string                     out;
+  encoder.encode(out, Term::Image(pixels.data(), 2048, 1), 1);
+  CHECK(count(out, "\u001b_G") == 2);
+  CHECK(count(out, "m=1;") == 1);
+  CHECK(out.find("\u001b_Gm=0;") != std::string::npos);
+  CHECK(out.find("\u001b_Gm=0;") - out.find("m=1;") == 4 + 4096 + 2);
+  // The emulator skips the APC strings
+  Term::Emulator emulator(1, 4);
+  emulator.feed(out + "ok");
+  CHECK(emulator.row(1) == "ok  ");
+}
@@ -0,0 +1,151 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/highlight.hpp"
+
+#include "cpp-terminal/emulator.hpp"
+#include "cpp-terminal/event.hpp"
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/history.hpp"
+#include "cpp-terminal/prompt.hpp"
+#include "cpp-terminal/window.hpp"
+#include "doctest/doctest.h"
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+// One letter per byte: n(ormal) c(omment) m(ultiline comment) k(eyword) t(ype) s(tring) d(igit)
+std::string classes(const std::vector<Term::Highlight>& highlights)
+{
+  const std::string letters{"ncmktsd"};
+  std::string       ret;
+  for(const Term::Highlight& highlight: highlights) { ret += letters[static_cast<std::size_t>(highlight)]; }
+  return ret;
+}
+
+std::string classes(const Term::Syntax& syntax, const std::string& line, const Term::Syntax::State& start = Term::Syntax::State::Normal)
+{
+  std::vector<Term::Highlight> highlights;
+  syntax.highlight(line, start, highlights);
+  return classes(highlights);
+}
+
+}  // namespace
+
+TEST_CASE("Syntax")
+{
+  const Term::Syntax c{Term::Syntax::c()};
+  CHECK(c.matches("kilo.cpp"));
+  CHECK_FALSE(c.matches("cpp"));
+  CHECK(classes(c, "int x = 42; // answer") == "tttnnnnnddnnccccccccc");
+  CHECK(classes(c, "if(ifdef) return \"a\\\"b\";") == "kknnnnnnnnkkkkkknssssssn");
+  CHECK(classes(c, "x1 = 3.14;") == "nnnnnddddn");
+  CHECK(classes(c, "a /* b */ c") == "nnmmmmmmmnn");
+  CHECK(classes(c, "returned") == "nnnnnnnn");
+  std::vector<Term::Highlight> highlights;
+  CHECK(c.highlight("x /* open", Term::Syntax::State::Normal, highlights) == Term::Syntax::State::Comment);
+  CHECK(c.highlight("still */ int", Term::Syntax::State::Comment, highlights) == Term::Syntax::State::Normal);
+  CHECK(classes(highlights) == "mmmmmmmmnttt");
+  // No rules, nothing highlighted
+  CHECK(classes(Term::Syntax(), "int x = 42;") == "nnnnnnnnnnn");
+}
+
+TEST_CASE("Highlighter")
+{
+  Term::Highlighter highlighter(Term::Syntax::c());
+  highlighter.assign({"int a;", "/* open", "still", "*/ int b;", "int c;"});
+  CHECK(highlighter.pending() == 5);
+  CHECK(highlighter.update() == 5);
+  CHECK(highlighter.pending() == 0);
+  CHECK(classes(highlighter.highlights(2)) == "mmmmm");
+  CHECK(classes(highlighter.highlights(3)) == "mmntttnnn");
+  // Only the changed lines are highlighted again
+  highlighter.assign({"int a;", "/* open", "still", "*/ int b;", "int d;"});
+  CHECK(highlighter.pending() == 1);
+  CHECK(highlighter.update() == 1);
+  // Closing the comment earlier cascades until the lines end as before
+  highlighter.set(1, "/* open */");
+  CHECK(highlighter.update() == 3);
+  CHECK(classes(highlighter.highlights(2)) == "nnnnn");
+  CHECK(classes(highlighter.highlights(3)) == "nnntttnnn");
+  CHECK(classes(highlighter.highlights(4)) == "tttnnn");
+  // An inserted line may change how the next one starts
+  highlighter.insert(1, "/*");
+  CHECK(highlighter.update() == 2);
+  CHECK(classes(highlighter.highlights(2)) == "mmmmmmmmmm");
+  CHECK(classes(highlighter.highlights(3)) == "nnnnn");
+  highlighter.erase(2);
+  CHECK(highlighter.update() == 2);
+  CHECK(classes(highlighter.highlights(2)) == "mmmmm");
+  CHECK(classes(highlighter.highlights(4)) == "tttnnn");
+  // Highlighted up to a limit, the stale highlighting is padded to the text
+  highlighter.set(0, "int a, b;");
+  highlighter.set(4, "int");
+  CHECK(highlighter.update(1) == 1);
+  CHECK(highlighter.pending() == 1);
+  CHECK(classes(highlighter.highlights(4)) == "ttt");
+  CHECK(highlighter.lines() == 5);
+  CHECK_THROWS_AS(highlighter.highlights(5), Term::Exception);
+  CHECK_THROWS_AS(highlighter.insert(7, ""), Term::Exception);
+  highlighter.set_syntax(Term::Syntax());
+  CHECK(highlighter.update() == 5);
+  CHECK(classes(highlighter.highlights(0)) == "nnnnnnnnn");
+}
+
+TEST_CASE("Highlighter on a worker thread")
+{
+  Term::Highlighter highlighter(Term::Syntax::c());
+  std::atomic<bool> stop{false};
+  std::thread       worker(
+    [&highlighter, &stop]()
+    {
+      while(!stop) { highlighter.update(16); }
+    });
+  // The lines are edited while they are highlighted
+  for(std::size_t i = 0; i != 2000; ++i) { highlighter.insert(i, i % 100 == 0 ? "/* " + std::to_string(i) : "int x" + std::to_string(i) + "; */"); }
+  for(std::size_t i = 0; i < 2000; i += 7) { highlighter.set(i, "char y;"); }
+  stop = true;
+  worker.join();
+  highlighter.update();
+  // The same as highlighting everything at once
+  Term::Highlighter        reference(Term::Syntax::c());
+  std::vector<std::string> lines;
+  for(std::size_t i = 0; i != 2000; ++i) { lines.push_back(i % 7 == 0 ? "char y;" : (i % 100 == 0 ? "/* " + std::to_string(i) : "int x" + std::to_string(i) + "; */")); }
+  reference.assign(lines);
+  reference.update();
+  for(std::size_t i = 0; i != 2000; ++i)
+  {
+    CAPTURE(i);
+    CHECK(highlighter.highlights(i) == reference.highlights(i));
+  }
+}
+
+TEST_CASE("Highlighted prompt")
+{
+  Term::History                    history;
+  std::function<bool(std::string)> iscomplete = [](const std::string&) { return true; };
+  Term::MultilinePrompt            prompt("> ", history, iscomplete);
+  prompt.set_syntax(Term::Syntax::c());
+  prompt.feed(Term::Event("int \xc3\xa9 = 1;"));
+  Term::Window window(30, 2);
+  prompt.render(window, 1, 1, 30);
+  Term::Emulator emulator(2, 30);
+  emulator.feed(window.render(1, 1, true));
+  CHECK(emulator.cell(1, 3).fg == Term::Color(Term::Color::Name::Green));
+  CHECK(emulator.cell(1, 5).fg == Term::Color(Term::Color::Name::Green));
+  CHECK(emulator.cell(1, 7).fg == Term::Color(Term::Color::Name::Default));
+  CHECK(emulator.cell(1, 11).fg == Term::Color(Term::Color::Name::Red));
+}
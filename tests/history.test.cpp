@@ -0,0 +1,171 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/history.hpp"
+
+#include "cpp-terminal/exception.hpp"
+#include "doctest/doctest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+TEST_CASE("History")
+{
+  Term::History history;
+  CHECK(history.empty());
+  history.add("ls -l\n");
+  history.add("");
+  history.add("make test\n");
+  history.add("git status\n");
+  CHECK(history.size() == 3);
+  CHECK(history[0] == "ls -l\n");
+  // A duplicate moves to the end
+  history.add("ls -l\n");
+  CHECK(history.size() == 3);
+  CHECK(history[0] == "make test\n");
+  CHECK(history[2] == "ls -l\n");
+  CHECK_THROWS_AS(history[3], Term::Exception);
+  CHECK_THROWS_AS(history.add(std::string("a\0b", 3)), Term::Exception);
+}
+
+TEST_CASE("Reverse search")
+{
+  Term::History history;
+  history.add("make test");
+  history.add("git status");
+  history.add("make install");
+  history.add("echo done");
+  CHECK(history.search("make", history.size()) == 2);
+  CHECK(history.search("make", 2) == 0);
+  CHECK(history.search("make", 0) == std::string::npos);
+  CHECK(history.search("ke t", history.size()) == 0);
+  CHECK(history.search("nothing", history.size()) == std::string::npos);
+  CHECK(history.search("", history.size()) == 3);
+  // Older copies of an entry are not found again
+  history.add("make test");
+  CHECK(history.search("make t", history.size()) == 3);
+  CHECK(history.search("make t", 3) == std::string::npos);
+  // Far back, through several chunks of the search
+  Term::History large;
+  large.add("needle in the oldest entry");
+  for(std::size_t i = 0; i != 20000; ++i) { large.add("entry number " + std::to_string(i)); }
+  CHECK(large.search("needle", large.size()) == 0);
+  for(std::size_t i = 0; i < 20000; i += 997)
+  {
+    CAPTURE(i);
+    CHECK(large.search("number " + std::to_string(i), i + 2) == i + 1);
+  }
+}
+
+TEST_CASE("History file shared by two processes")
+{
+  const std::string file{"history.test.history"};
+  std::remove(file.c_str());
+  Term::History first(file);
+  Term::History second(file);
+  CHECK(first.empty());
+  first.add("one");
+  second.add("two");  // sees one on the way
+  CHECK(second.size() == 2);
+  CHECK(second[0] == "one");
+  CHECK(first.size() == 1);
+  first.sync();
+  CHECK(first.size() == 2);
+  CHECK(first[1] == "two");
+  first.add("one");
+  // A record still being written is not loaded
+  {
+    std::ofstream append(file, std::ios::binary | std::ios::app);
+    append << "thr";
+  }
+  Term::History reloaded(file);
+  CHECK(reloaded.size() == 2);
+  CHECK(reloaded[0] == "two");
+  CHECK(reloaded[1] == "one");
+  {
+    std::ofstream append(file, std::ios::binary | std::ios::app);
+    append << "ee" << '\0';
+  }
+  reloaded.sync();
+  CHECK(reloaded.size() == 3);
+  CHECK(reloaded[2] == "three");
+  std::remove(file.c_str());
+}
+
+TEST_CASE("Torn record left by a writer that died")
+{
+  const std::string file{"history.test.history"};
+  {
+    std::ofstream torn(file, std::ios::binary | std::ios::trunc);
+    torn << "one" << '\0' << "tor";
+  }
+  Term::History history(file);
+  CHECK(history.size() == 1);
+  // The torn bytes become an entry of their own, for this process and the others
+  history.add("ls");
+  REQUIRE(history.size() == 3);
+  CHECK(history[1] == "tor");
+  CHECK(history[2] == "ls");
+  Term::History reopened(file);
+  REQUIRE(reopened.size() == 3);
+  CHECK(reopened[0] == "one");
+  CHECK(reopened[1] == "tor");
+  CHECK(reopened[2] == "ls");
+  history.add("pwd");
+  reopened.sync();
+  CHECK(reopened.size() == 4);
+  CHECK(reopened[3] == "pwd");
+  std::remove(file.c_str());
+}
+
+TEST_CASE("Compaction")
+{
+  const std::string file{"history.test.compaction"};
+  std::remove(file.c_str());
+  Term::History     first(file);
+  Term::History     second(file);
+  const std::string padding(100, 'x');
+  first.add("unique");
+  for(std::size_t i = 0; i != 2000; ++i) { first.add(padding + std::to_string(i % 10)); }
+  CHECK(first.size() == 11);
+  // 200 KB were appended, the file was replaced by one holding each entry once whenever the copies took over
+  {
+    std::ifstream size(file, std::ios::binary | std::ios::ate);
+    CHECK(size.tellg() < 70000);
+  }
+  // The other process loads the new file from its start
+  second.sync();
+  REQUIRE(second.size() == 11);
+  for(std::size_t i = 0; i != 11; ++i) { CHECK(second[i] == first[i]); }
+  second.add("from second");
+  first.sync();
+  CHECK(first.size() == 12);
+  CHECK(first[11] == "from second");
+  // Compacted again while the other process appends without syncing
+  for(std::size_t i = 0; i != 1000; ++i) { first.add(padding + std::to_string(i % 10)); }
+  second.add("late");
+  REQUIRE(second.size() == 13);
+  CHECK(second[0] == "unique");
+  CHECK(second[1] == "from second");
+  CHECK(second[12] == "late");
+  first.sync();
+  CHECK(first.size() == 13);
+  CHECK(first[12] == "late");
+  CHECK(first.search("unique", first.size()) == 0);
+  std::remove(file.c_str());
+  // Without a file too
+  Term::History memory;
+  memory.add("unique");
+  for(std::size_t i = 0; i != 2000; ++i) { memory.add(padding + std::to_string(i % 10)); }
+  CHECK(memory.size() == 11);
+  CHECK(memory.search("unique", memory.size()) == 0);
+  CHECK(memory[10] == padding + "9");
+}
@@ -0,0 +1,144 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/image.hpp"
+
+#include "cpp-terminal/color.hpp"
+#include "cpp-terminal/emulator.hpp"
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/terminfo.hpp"
+#include "cpp-terminal/window.hpp"
+#include "doctest/doctest.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+Term::Emulator show(Term::Window& window)
+{
+  Term::Emulator ret(window.get_h(), window.get_w());
+  ret.feed(window.render(1, 1, false));
+  return ret;
+}
+
+bool truecolor()
+{
+  const Term::Terminfo terminfo;
+  return Term::Terminfo::getColorMode() == Term::Terminfo::ColorMode::Bit24;
+}
+
+}  // namespace
+
+TEST_CASE("Half blocks")
+{
+  // 2x4 pixels: one pixel per half cell
+  const std::vector<std::uint8_t> pixels{255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 255, 0, 1, 2, 3, 9, 9, 9, 1, 2, 3, 9, 9, 9};
+  Term::Window                    window(3, 2);
+  Term::draw_image(window, 1, 1, 2, 2, Term::Image(pixels.data(), 2, 4));
+  const Term::Emulator emulator{show(window)};
+  CHECK(emulator.row(1) == "▀  ");
+  CHECK(emulator.row(2) == "   ");
+  if(truecolor())
+  {
+    CHECK(emulator.cell(1, 1).fg == Term::Color(255, 0, 0));
+    CHECK(emulator.cell(1, 1).bg == Term::Color(0, 0, 255));
+    CHECK(emulator.cell(1, 2).bg == Term::Color(0, 255, 0));  // same color on top and bottom
+    CHECK(emulator.cell(2, 1).bg == Term::Color(1, 2, 3));
+    CHECK(emulator.cell(2, 2).bg == Term::Color(9, 9, 9));
+  }
+}
+
+TEST_CASE("Quadrants")
+{
+  const std::uint8_t red[3]{255, 0, 0};
+  const std::uint8_t blue[3]{0, 0, 255};
+  // Two cells of 2x2 pixels: red over blue, then a diagonal
+  std::vector<std::uint8_t>              pixels;
+  const std::vector<const std::uint8_t*> layout{red, red, red, blue, blue, blue, blue, red};
+  for(std::size_t i = 0; i != layout.size(); ++i) { pixels.insert(pixels.end(), layout[i], layout[i] + 3); }
+  Term::Window window(3, 1);
+  Term::draw_image(window, 1, 1, 2, 1, Term::Image(pixels.data(), 4, 2), Term::Blitter::Quadrant);
+  const Term::Emulator emulator{show(window)};
+  CHECK(emulator.row(1) == "▀▞ ");
+  if(truecolor())
+  {
+    CHECK(emulator.cell(1, 1).fg == Term::Color(255, 0, 0));
+    CHECK(emulator.cell(1, 1).bg == Term::Color(0, 0, 255));
+    CHECK(emulator.cell(1, 2).fg == Term::Color(0, 0, 255));
+    CHECK(emulator.cell(1, 2).bg == Term::Color(255, 0, 0));
+  }
+}
+
+TEST_CASE("Scaling")
+{
+  // 4x4 RGBA image to one cell: the average of each half, transparent pixels are black
+  std::vector<std::uint8_t> pixels(4 * 4 * 4, 0);
+  for(std::size_t i = 0; i != 8; ++i)
+  {
+    pixels[4 * i]     = 200;
+    pixels[4 * i + 3] = (i % 2 == 0) ? 255 : 0;
+  }
+  Term::Window window(2, 1);
+  Term::draw_image(window, 1, 1, 1, 1, Term::Image(pixels.data(), 4, 4, 4));
+  const Term::Emulator emulator{show(window)};
+  CHECK(emulator.row(1) == "▀ ");
+  if(truecolor())
+  {
+    CHECK(emulator.cell(1, 1).fg == Term::Color(100, 0, 0));
+    CHECK(emulator.cell(1, 1).bg == Term::Color(0, 0, 0));
+  }
+  // Enlarging repeats the pixels, with a stride
+  const std::vector<std::uint8_t> pixel{10, 20, 30, 0, 0, 0};
+  Term::Window                    large(4, 2);
+  Term::draw_image(large, 1, 1, 3, 2, Term::Image(pixel.data(), 1, 1, 3, 6), Term::Blitter::Quadrant);
+  const Term::Emulator enlarged{show(large)};
+  CHECK(enlarged.row(1) == "    ");
+  if(truecolor()) { CHECK(enlarged.cell(2, 3).bg == Term::Color(10, 20, 30)); }
+}
+
+TEST_CASE("Tall images")
+{
+  // 70000 opaque RGBA rows per half: their sums do not fit in 32 bits
+  std::vector<std::uint8_t> pixels(4 * 140000, 255);
+  for(std::size_t i = 70000; i != 140000; ++i) { pixels[4 * i] = pixels[4 * i + 1] = pixels[4 * i + 2] = 0; }
+  Term::Window window(2, 1);
+  Term::draw_image(window, 1, 1, 1, 1, Term::Image(pixels.data(), 1, 140000, 4));
+  const Term::Emulator emulator{show(window)};
+  CHECK(emulator.row(1) == "▀ ");
+  if(truecolor())
+  {
+    CHECK(emulator.cell(1, 1).fg == Term::Color(255, 255, 255));
+    CHECK(emulator.cell(1, 1).bg == Term::Color(0, 0, 0));
+  }
+}
+
+TEST_CASE("Threads")
+{
+  std::vector<std::uint8_t> pixels(97 * 61 * 3);
+  for(std::size_t i = 0; i != pixels.size(); ++i) { pixels[i] = static_cast<std::uint8_t>(i * 31 + i / 291); }
+  const Term::Image image(pixels.data(), 97, 61);
+  Term::Window      one(20, 9);
+  Term::Window      four(20, 9);
+  Term::draw_image(one, 2, 2, 18, 7, image, Term::Blitter::Quadrant);
+  Term::draw_image(four, 2, 2, 18, 7, image, Term::Blitter::Quadrant, 4);
+  CHECK(one.render(1, 1, false) == four.render(1, 1, false));
+}
+
+TEST_CASE("Invalid images")
+{
+  const std::uint8_t pixels[8]{};
+  CHECK_THROWS_AS(Term::Image(pixels, 2, 2, 2), Term::Exception);
+  CHECK_THROWS_AS(Term::Image(pixels, 2, 1, 3, 4), Term::Exception);
+  CHECK_THROWS_AS(Term::Image(nullptr, 1, 1), Term::Exception);
+  Term::Window window(2, 2);
+  CHECK_THROWS_AS(Term::draw_image(window, 2, 1, 2, 1, Term::Image(pixels, 1, 1)), Term::Exception);
+}
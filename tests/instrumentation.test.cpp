@@ -0,0 +1,83 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/instrumentation.hpp"
+
+#include "cpp-terminal/private/blocking_queue.hpp"
+#include "cpp-terminal/private/file.hpp"
+#include "doctest/doctest.h"
+
+TEST_CASE("LatencyHistogram buckets")
+{
+  for(std::uint64_t value = 0; value != 8; ++value) { CHECK(Term::LatencyHistogram::bucket(value) == value); }
+  CHECK(Term::LatencyHistogram::bucket(8) == 8);
+  CHECK(Term::LatencyHistogram::bucket(15) == 15);
+  CHECK(Term::LatencyHistogram::bucket(16) == 16);
+  CHECK(Term::LatencyHistogram::bucket(17) == 16);
+  CHECK(Term::LatencyHistogram::bucket(18) == 17);
+  CHECK(Term::LatencyHistogram::bucket(~std::uint64_t(0)) == Term::LatencyHistogram::buckets - 1);
+  for(std::size_t bucket = 0; bucket + 1 < Term::LatencyHistogram::buckets; ++bucket)
+  {
+    CHECK(Term::LatencyHistogram::bucket(Term::LatencyHistogram::lower_bound(bucket)) == bucket);
+    CHECK(Term::LatencyHistogram::bucket(Term::LatencyHistogram::lower_bound(bucket + 1) - 1) == bucket);
+  }
+}
+
+TEST_CASE("LatencyHistogram statistics")
+{
+  Term::LatencyHistogram histogram;
+  CHECK(histogram.count() == 0);
+  CHECK(histogram.percentile(50) == 0);
+  for(std::uint64_t value = 1; value <= 1000; ++value) { histogram.record(value * 1000); }
+  CHECK(histogram.count() == 1000);
+  CHECK(histogram.min() == 1000);
+  CHECK(histogram.max() == 1000000);
+  CHECK(histogram.mean() == doctest::Approx(500500.0));
+  // 1/8 relative precision
+  CHECK(histogram.percentile(50) >= 500000);
+  CHECK(histogram.percentile(50) <= 500000 + 500000 / 8);
+  CHECK(histogram.percentile(99) >= 990000);
+  CHECK(histogram.percentile(100) == 1000000);
+  CHECK(histogram.percentile(0) >= 1000);
+  Term::LatencyHistogram other;
+  other.record(10, 5);
+  histogram.merge(other);
+  CHECK(histogram.count() == 1005);
+  CHECK(histogram.min() == 10);
+}
+
+TEST_CASE("Instrumentation snapshot")
+{
+  Term::Instrumentation::reset();
+  Term::Private::out.write("Hello");
+  Term::Private::BlockingQueue queue;
+  queue.push(Term::Event(Term::Key(Term::Key::Value::a)), 3);
+  queue.push(Term::Event(Term::Screen(10, 20)));
+  const Term::Instrumentation::Snapshot snapshot{Term::Instrumentation::snapshot()};
+  CHECK(snapshot.enabled == Term::Instrumentation::enabled());
+  if(snapshot.enabled)
+  {
+    CHECK(snapshot.bytes_written == 5);
+    CHECK(snapshot.write_calls == 1);
+    CHECK(snapshot.write_latency.count() == 1);
+    CHECK(snapshot.events_of(Term::Event::Type::Key) == 3);
+    CHECK(snapshot.events_of(Term::Event::Type::Screen) == 1);
+    CHECK(snapshot.queue_high_water == 4);
+  }
+  else
+  {
+    CHECK(snapshot.bytes_written == 0);
+    CHECK(snapshot.write_calls == 0);
+    CHECK(snapshot.write_latency.count() == 0);
+    CHECK(snapshot.events_of(Term::Event::Type::Key) == 0);
+  }
+  Term::Instrumentation::reset();
+  CHECK(Term::Instrumentation::snapshot().write_calls == 0);
+}
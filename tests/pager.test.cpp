@@ -0,0 +1,209 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/pager.hpp"
+
+#include "cpp-terminal/emulator.hpp"
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/private/line_index.hpp"
+#include "cpp-terminal/window.hpp"
+#include "doctest/doctest.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+  #include <fcntl.h>
+  #include <io.h>
+#else
+  #include <unistd.h>
+#endif
+
+namespace
+{
+
+const std::string path{"pager.test.txt"};
+
+void write(const std::string& text, const bool& append = false)
+{
+  std::ofstream file(path, std::ios::binary | (append ? std::ios::app : std::ios::trunc));
+  file << text;
+}
+
+std::string numbered(const std::size_t& begin, const std::size_t& end)
+{
+  std::string ret;
+  for(std::size_t line = begin; line != end; ++line) { ret += "line " + std::to_string(line) + '\n'; }
+  return ret;
+}
+
+void wait(Term::Pager& pager)
+{
+  do {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    pager.update();
+  } while(pager.indexing());
+}
+
+// The rows of the pager drawn in a width x height window
+std::vector<std::string> rows(Term::Pager& pager, const std::size_t& width = 20, const std::size_t& height = 5)
+{
+  Term::Window window(width, height);
+  pager.render(window, 1, 1, width, height);
+  Term::Emulator emulator(height, width);
+  emulator.feed(window.render(1, 1, true));
+  std::vector<std::string> ret;
+  for(std::size_t row = 1; row <= height; ++row)
+  {
+    std::string text{emulator.row(row)};
+    text.erase(text.find_last_not_of(' ') + 1);
+    ret.push_back(text);
+  }
+  return ret;
+}
+
+}  // namespace
+
+TEST_CASE("Line index")
+{
+  // Lines of every length, some empty, indexed in chunks of 100 bytes on as many threads
+  std::string text;
+  for(std::size_t line = 0; line != 3000; ++line) { text += std::string(line % 37, 'x') + '\n'; }
+  text += "no newline";
+  write(text);
+  Term::Private::LineIndex index(path, 7, 100);
+  while(index.busy()) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+  CHECK(index.indexed() == text.size());
+  CHECK(index.newlines() == 3000);
+  std::vector<std::size_t> starts{0};
+  for(std::size_t i = 0; i != text.size(); ++i)
+  {
+    if(text[i] == '\n') { starts.push_back(i + 1); }
+  }
+  for(std::size_t line = 0; line < starts.size(); line += 13)
+  {
+    CAPTURE(line);
+    const Term::Private::LineIndex::Checkpoint checkpoint{index.before_line(line)};
+    CHECK(checkpoint.line <= line);
+    CHECK(line - checkpoint.line < 2 * 7);
+    CHECK(starts[checkpoint.line] == checkpoint.offset);
+    const Term::Private::LineIndex::Checkpoint before{index.before_offset(starts[line] + 1)};
+    CHECK(before.offset <= starts[line] + 1);
+    CHECK(starts[before.line] == before.offset);
+  }
+  // What is appended is indexed by update
+  write("\nmore\n", true);
+  index.update();
+  while(index.busy()) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+  CHECK(index.newlines() == 3002);
+  std::remove(path.c_str());
+}
+
+TEST_CASE("Pager")
+{
+  write(numbered(0, 5000));
+  Term::Pager pager(path);
+  wait(pager);
+  CHECK(pager.lines() == 5000);
+  CHECK(rows(pager) == std::vector<std::string>{"line 0", "line 1", "line 2", "line 3", "line 4"});
+  pager.scroll(3);
+  CHECK(pager.top_line() == 3);
+  CHECK(rows(pager)[0] == "line 3");
+  pager.scroll(-10);
+  CHECK(pager.top_line() == 0);
+  pager.jump_to_line(4000);
+  CHECK(pager.top_line() == 4000);
+  CHECK(rows(pager)[0] == "line 4000");
+  // Not past the last page
+  pager.jump_to_line(4998);
+  CHECK(pager.top_line() == 4995);
+  CHECK(rows(pager)[4] == "line 4999");
+  CHECK(pager.percent() == doctest::Approx(100.0));
+  pager.scroll(1);
+  CHECK(pager.top_line() == 4995);
+  // Half of the bytes, at the start of a line
+  pager.jump_to_percent(50);
+  const std::string top{rows(pager)[0]};
+  CHECK(top.substr(0, 5) == "line ");
+  CHECK(pager.top_line() == std::stoul(top.substr(5)));
+  CHECK(pager.top_offset() == numbered(0, pager.top_line()).size());
+  CHECK(pager.top_line() > 2400);
+  CHECK(pager.top_line() < 2600);
+  pager.jump_to_end();
+  CHECK(rows(pager)[4] == "line 4999");
+  // Long lines are cut, tabs expanded, control characters shown
+  write("a\tb\x01" + std::string(100, 'c') + "d\nshort");
+  Term::Pager cut(path);
+  wait(cut);
+  CHECK(cut.lines() == 2);
+  CHECK(rows(cut) == std::vector<std::string>{"a       b^Accccccccc", "short", "~", "~", "~"});
+  cut.scroll_columns(100);
+  CHECK(rows(cut)[0] == "cccccccccccd");
+  std::remove(path.c_str());
+  CHECK_THROWS_AS(Term::Pager{path}, Term::Exception);
+}
+
+TEST_CASE("Follow")
+{
+  write(numbered(0, 10));
+  Term::Pager pager(path);
+  pager.set_follow(true);
+  CHECK(rows(pager, 20, 3) == std::vector<std::string>{"line 7", "line 8", "line 9"});
+  write(numbered(10, 12), true);
+  pager.update();
+  CHECK(rows(pager, 20, 3) == std::vector<std::string>{"line 9", "line 10", "line 11"});
+  wait(pager);
+  CHECK(pager.top_line() == 9);
+  // Scrolling up leaves follow mode
+  pager.scroll(-1);
+  CHECK_FALSE(pager.follow());
+  write(numbered(12, 13), true);
+  pager.update();
+  CHECK(rows(pager, 20, 3)[0] == "line 8");
+  std::remove(path.c_str());
+}
+
+TEST_CASE("Descriptor")
+{
+  int ends[2];
+#if defined(_WIN32)
+  REQUIRE(::_pipe(ends, 65536, _O_BINARY) == 0);
+#else
+  REQUIRE(::pipe(ends) == 0);
+#endif
+  const std::string text{numbered(0, 100)};
+#if defined(_WIN32)
+  REQUIRE(::_write(ends[1], text.data(), static_cast<unsigned int>(text.size())) == static_cast<int>(text.size()));
+#else
+  REQUIRE(::write(ends[1], text.data(), text.size()) == static_cast<::ssize_t>(text.size()));
+#endif
+  {
+    Term::Pager pager(ends[0], path);
+    while(pager.size() != text.size()) { pager.update(); }
+    wait(pager);
+    CHECK(pager.lines() == 100);
+    CHECK(rows(pager, 20, 2) == std::vector<std::string>{"line 98", "line 99"});
+    // The writer keeps the pipe open: the pager is destroyed all the same
+  }
+  // The spool is removed
+  CHECK_FALSE(std::ifstream(path));
+#if defined(_WIN32)
+  ::_close(ends[0]);
+  ::_close(ends[1]);
+#else
+  ::close(ends[0]);
+  ::close(ends[1]);
+#endif
+}
@@ -0,0 +1,175 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/prompt.hpp"
+
+#include "cpp-terminal/emulator.hpp"
+#include "cpp-terminal/event.hpp"
+#include "cpp-terminal/key.hpp"
+#include "cpp-terminal/window.hpp"
+#include "doctest/doctest.h"
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+
+namespace
+{
+
+Term::Event key(const Term::Key& key) { return Term::Event(key); }
+
+Term::Status type(Term::MultilinePrompt& prompt, const std::string& text)
+{
+  Term::Status status{Term::Status::Unchanged};
+  for(const char& character: text) { status = prompt.feed(key(Term::Key(character))); }
+  return status;
+}
+
+// Feed empty events, as read_event() woken by the completion worker would, until the completion changes the prompt
+Term::Status wait_completion(Term::MultilinePrompt& prompt)
+{
+  for(std::size_t i = 0; i != 1000; ++i)
+  {
+    const Term::Status status{prompt.feed(Term::Event())};
+    if(status != Term::Status::Unchanged) { return status; }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return Term::Status::Unchanged;
+}
+
+}  // namespace
+
+TEST_CASE("ChoicePrompt")
+{
+  Term::ChoicePrompt immediate("Continue?", "y", "N", ":", true);
+  CHECK(immediate.feed(Term::Event()) == Term::Status::Unchanged);
+  CHECK(immediate.feed(key(Term::Key::Y)) == Term::Status::Done);
+  CHECK(immediate.result() == Term::Result::Yes);
+  Term::ChoicePrompt other("Continue?", "y", "N", ":", true);
+  CHECK(other.feed(key(Term::Key::x)) == Term::Status::Done);
+  CHECK(other.result() == Term::Result::Invalid);
+
+  Term::ChoicePrompt typed("Continue?", "y", "N", ":", false);
+  CHECK(typed.feed(key(Term::Key::Backspace)) == Term::Status::Unchanged);
+  CHECK(typed.feed(key(Term::Key::N)) == Term::Status::Changed);
+  CHECK(typed.feed(key(Term::Key::x)) == Term::Status::Changed);
+  CHECK(typed.feed(key(Term::Key::Backspace)) == Term::Status::Changed);
+  CHECK(typed.feed(key(Term::Key::o)) == Term::Status::Changed);
+  CHECK(typed.input() == "no");
+  CHECK(typed.line() == "Continue? [y/N]: no");
+  CHECK(typed.feed(key(Term::Key::Enter)) == Term::Status::Done);
+  CHECK(typed.result() == Term::Result::No);
+
+  // Rendered in a region, cut to its width
+  Term::Window window(20, 3);
+  typed.render(window, 3, 2, 12);
+  Term::Emulator emulator(3, 20);
+  emulator.feed(window.render(1, 1, true));
+  CHECK(emulator.row(2) == "  Continue? [y      ");
+}
+
+TEST_CASE("MultilinePrompt")
+{
+  Term::History                    history;
+  std::function<bool(std::string)> iscomplete = [](const std::string& text) { return text.size() < 2 || text[text.size() - 2] != '\\'; };
+  history.add("git status\n");
+  Term::MultilinePrompt prompt("> ", history, iscomplete);
+  CHECK(prompt.feed(Term::Event()) == Term::Status::Unchanged);
+  CHECK(type(prompt, "ls \\") == Term::Status::Changed);
+  CHECK(prompt.feed(key(Term::Key::Enter)) == Term::Status::Changed);  // not complete, a new line
+  CHECK(prompt.rows() == 2);
+  type(prompt, "-l");
+  CHECK(prompt.feed(Term::Event("\r\n")) == Term::Status::Changed);  // pasted
+  CHECK(prompt.model().lines() == 3);
+  CHECK(prompt.feed(key(Term::Key::Backspace)) == Term::Status::Changed);
+  CHECK(prompt.feed(key(Term::Key::Enter)) == Term::Status::Done);
+  CHECK(prompt.result() == "ls \\\n-l\n");
+  CHECK(history.size() == 2);
+  CHECK(history[1] == "ls \\\n-l\n");
+  CHECK(prompt.feed(key(Term::Key::a)) == Term::Status::Done);
+
+  // History and reverse search
+  Term::MultilinePrompt next("> ", history, iscomplete);
+  next.feed(key(Term::Key::ArrowUp));
+  CHECK(next.model().str() == "ls \\\n-l\n");
+  next.feed(key(Term::Key::ArrowUp));  // up a line of the entry
+  next.feed(key(Term::Key::ArrowUp));
+  CHECK(next.model().str() == "git status\n");
+  next.feed(key(Term::Key::ArrowDown));
+  next.feed(key(Term::Key::ArrowDown));
+  next.feed(key(Term::Key::ArrowDown));
+  CHECK(next.model().str() == "\n");
+  next.feed(key(Term::Key::Ctrl_R));
+  type(next, "stat");
+  CHECK(next.model().str() == "git status\n");
+  CHECK(next.rows() == 2);
+  next.feed(key(Term::Key::Esc));
+  CHECK(next.model().str() == "\n");
+  CHECK(next.feed(key(Term::Key::Ctrl_D)) == Term::Status::Done);
+  CHECK(next.result() == std::string(1, static_cast<char>(Term::Key::Ctrl_D)));
+  CHECK(history.size() == 2);
+}
+
+TEST_CASE("MultilinePrompt rendered in a region")
+{
+  Term::History                    history;
+  std::function<bool(std::string)> iscomplete = [](const std::string&) { return true; };
+  Term::MultilinePrompt            prompt("> ", history, iscomplete);
+  type(prompt, "select");
+  prompt.feed(key(Term::Key::Ctrl_N));
+  type(prompt, "1");
+  // The same drawing as the whole window prompt, moved by the region origin
+  Term::Window whole(30, 2);
+  render(whole, prompt.model(), 30);
+  Term::Window region(40, 6);
+  prompt.render(region, 6, 3, 30);
+  Term::Emulator expected(2, 30);
+  expected.feed(whole.render(1, 1, true));
+  Term::Emulator emulator(6, 40);
+  emulator.feed(region.render(1, 1, true));
+  for(std::size_t row = 1; row <= 2; ++row)
+  {
+    for(std::size_t column = 1; column <= 30; ++column)
+    {
+      CAPTURE(row);
+      CAPTURE(column);
+      CHECK(emulator.cell(row + 2, column + 5) == expected.cell(row, column));
+    }
+  }
+  CHECK(emulator.cursor().row() == 4);
+  CHECK(emulator.cursor().column() == 9);
+}
+
+TEST_CASE("MultilinePrompt completion")
+{
+  Term::History                    history;
+  std::function<bool(std::string)> iscomplete = [](const std::string&) { return true; };
+  const Term::Trie                 trie({"users", "user_id", "updated_at"});
+  Term::MultilinePrompt            prompt("> ", history, iscomplete, trie);
+  // A single candidate is inserted
+  type(prompt, "select upd");
+  CHECK(prompt.feed(key(Term::Key::Tab)) == Term::Status::Changed);
+  REQUIRE(wait_completion(prompt) == Term::Status::Changed);
+  CHECK(prompt.model().str() == "select updated_at\n");
+  // Several open the popup, typing narrows them
+  type(prompt, ", u");
+  prompt.feed(key(Term::Key::Tab));
+  REQUIRE(wait_completion(prompt) == Term::Status::Changed);
+  CHECK(prompt.rows() == 4);
+  type(prompt, "s");
+  REQUIRE(wait_completion(prompt) == Term::Status::Changed);
+  CHECK(prompt.rows() == 3);
+  prompt.feed(key(Term::Key::ArrowDown));
+  CHECK(prompt.feed(key(Term::Key::Enter)) == Term::Status::Changed);
+  CHECK(prompt.model().str() == "select updated_at, users\n");
+  CHECK(prompt.rows() == 1);
+  CHECK(prompt.feed(key(Term::Key::Enter)) == Term::Status::Done);
+}
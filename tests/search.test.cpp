@@ -0,0 +1,194 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/search.hpp"
+
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/textbuffer.hpp"
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+
+namespace
+{
+
+const std::size_t npos{std::string::npos};
+
+std::string lower(std::string text)
+{
+  std::transform(text.begin(), text.end(), text.begin(), [](const char& character) { return (character >= 'A' && character <= 'Z') ? static_cast<char>(character | 0x20) : character; });
+  return text;
+}
+
+// Text of a few letters, so that the patterns have many partial matches
+std::string random_text(std::mt19937& random, const std::size_t& size, const std::string& alphabet = "abAB\n")
+{
+  std::string ret;
+  for(std::size_t i = 0; i != size; ++i) { ret += alphabet[random() % alphabet.size()]; }
+  return ret;
+}
+
+}  // namespace
+
+TEST_CASE("Literal")
+{
+  std::mt19937 random(42);
+  for(std::size_t round = 0; round != 2000; ++round)
+  {
+    const std::string text{random_text(random, random() % 200)};
+    const std::string pattern{random_text(random, 1 + random() % 4, "abAB")};
+    const std::size_t from{random() % (text.size() + 1)};
+    CAPTURE(text);
+    CAPTURE(pattern);
+    CAPTURE(from);
+    const Term::Search::Match match{Term::Search(pattern).find(text, from)};
+    CHECK(match.position == text.find(pattern, from));
+    if(match.found()) { CHECK(match.length == pattern.size()); }
+    CHECK(Term::Search(pattern, Term::Search::Syntax::Literal, true).find(text, from).position == lower(text).find(lower(pattern), from));
+    // The matches starting before limit
+    const std::size_t limit{from + random() % 50};
+    const std::size_t expected{text.find(pattern, from)};
+    CHECK(Term::Search(pattern).find(text.data(), text.size(), from, limit).position == (expected < limit ? expected : npos));
+  }
+  // Longer than a chunk: the first match of all is returned, whichever thread finds it
+  std::string large(9 * 1024 * 1024, 'x');
+  large.replace(large.size() - 10, 6, "needle");
+  large.replace(5 * 1024 * 1024, 6, "needle");
+  CHECK(Term::Search("needle").find(large).position == 5 * 1024 * 1024);
+  CHECK(Term::Search("NEEDLE", Term::Search::Syntax::Literal, true).find(large, 5 * 1024 * 1024 + 1).position == large.size() - 10);
+  CHECK_FALSE(Term::Search("needles").find(large).found());
+  // Nothing to find
+  CHECK(Term::Search().empty());
+  CHECK_FALSE(Term::Search().find("abc").found());
+  CHECK_FALSE(Term::Search("a\nb").find("a\nb").found());
+}
+
+TEST_CASE("Regex")
+{
+  const Term::Search search("b+", Term::Search::Syntax::Regex);
+  CHECK(search.find("aabbba").position == 2);
+  CHECK(search.find("aabbba").length == 3);
+  // Searching from inside the match
+  CHECK(search.find("aabbba", 3).position == 3);
+  CHECK(search.find("aabbba", 3).length == 2);
+  // Lines are matched one by one
+  const Term::Search line("^b.*$", Term::Search::Syntax::Regex);
+  CHECK(line.find("ab\nbcd\nb").position == 3);
+  CHECK(line.find("ab\nbcd\nb").length == 3);
+  CHECK(line.find("ab\nbcd\nb", 4).position == 7);
+  CHECK_FALSE(line.find("abab").found());
+  CHECK(Term::Search("\\bB", Term::Search::Syntax::Regex, true).find("ab b", 1).position == 3);
+  CHECK_THROWS_AS(Term::Search("(", Term::Search::Syntax::Regex), Term::Exception);
+  // The lines without the literal the expression requires are skipped, those with it are all searched
+  const std::string text{"a timeout\ntimed out\nxx time out\ntimed  out"};
+  CHECK(Term::Search("timed? out$", Term::Search::Syntax::Regex).find(text).position == 10);
+  CHECK(Term::Search("timed? out$", Term::Search::Syntax::Regex).find(text, 11).position == 23);
+  CHECK(Term::Search("ti(med)? +out", Term::Search::Syntax::Regex).find(text, 11).position == 32);
+  CHECK(Term::Search("d{0,1} +out", Term::Search::Syntax::Regex).find(text, 24).position == 27);
+  CHECK(Term::Search("TIMED\\s+OUT", Term::Search::Syntax::Regex, true).find(text, 11).position == 32);
+  // A match starting before limit, the literal after it
+  CHECK(Term::Search("d  OUT", Term::Search::Syntax::Regex, true).find(text.data(), text.size(), 11, 37).position == 36);
+  CHECK(Term::Search("d  OUT", Term::Search::Syntax::Regex, true).find(text.data(), text.size(), 11, 36).position == npos);
+  CHECK(Term::Search("e o", Term::Search::Syntax::Regex).find(text.data(), text.size(), 11, 27).position == 26);
+}
+
+TEST_CASE("Refines")
+{
+  CHECK(Term::Search("abc").refines(Term::Search("ab")));
+  CHECK(Term::Search("ABC", Term::Search::Syntax::Literal, true).refines(Term::Search("ab", Term::Search::Syntax::Literal, true)));
+  CHECK_FALSE(Term::Search("abc").refines(Term::Search("b")));
+  CHECK_FALSE(Term::Search("abc").refines(Term::Search("ab", Term::Search::Syntax::Literal, true)));
+  CHECK_FALSE(Term::Search("abc", Term::Search::Syntax::Regex).refines(Term::Search("ab", Term::Search::Syntax::Regex)));
+}
+
+TEST_CASE("Text buffer")
+{
+  // Edited at random, the text is in many pieces, lines cut by them
+  std::mt19937     random(7);
+  std::string      text{random_text(random, 3000)};
+  Term::TextBuffer buffer(text);
+  for(std::size_t edit = 0; edit != 300; ++edit)
+  {
+    const std::size_t position{random() % (text.size() + 1)};
+    if(random() % 2 == 0)
+    {
+      const std::string inserted{random_text(random, random() % 8)};
+      buffer.insert(position, inserted);
+      text.insert(position, inserted);
+    }
+    else
+    {
+      const std::size_t count{random() % 8};
+      buffer.erase(position, count);
+      text.erase(position, count);
+    }
+  }
+  REQUIRE(buffer.str() == text);
+  for(std::size_t round = 0; round != 300; ++round)
+  {
+    const std::string pattern{random_text(random, 1 + random() % 4, "abAB")};
+    const std::size_t from{random() % text.size()};
+    const std::size_t limit{from + random() % 400};
+    CAPTURE(pattern);
+    CAPTURE(from);
+    const std::size_t expected{text.find(pattern, from)};
+    CHECK(buffer.find(Term::Search(pattern), from, limit).position == (expected < limit ? expected : npos));
+    const std::size_t last{limit == 0 ? npos : text.rfind(pattern, limit - 1)};
+    CHECK(buffer.rfind(Term::Search(pattern), from, limit).position == (last != npos && last >= from ? last : npos));
+    // A regular expression does not see the edits
+    const Term::Search regex("^" + pattern, Term::Search::Syntax::Regex);
+    std::size_t        line{from == 0 || text[from - 1] == '\n' ? from : text.find('\n', from)};
+    if(line != npos && line != from) { ++line; }
+    while(line != npos && line < text.size() && text.compare(line, pattern.size(), pattern) != 0)
+    {
+      line = text.find('\n', line);
+      if(line != npos) { ++line; }
+    }
+    CHECK(buffer.find(regex, from).position == (line < text.size() ? line : npos));
+  }
+}
+
+TEST_CASE("Incremental search")
+{
+  Term::TextBuffer        buffer("one two three\ntwo\nthree two");
+  Term::IncrementalSearch search(4);
+  // Forward, wrapping around
+  search.start(buffer, Term::Search("two"), 20);
+  CHECK_FALSE(search.step());
+  CHECK(search.run().position == 24);
+  search.start(buffer, Term::Search("one"), 20);
+  CHECK(search.run().position == 0);
+  // Backward: the matches before the position first
+  search.start(buffer, Term::Search("two"), 20, false);
+  CHECK(search.run().position == 14);
+  search.start(buffer, Term::Search("three"), 8, false);
+  CHECK(search.run().position == 18);
+  // Typing on: the search resumes from the previous match, which is that of a fresh search
+  search.start(buffer, Term::Search("t"), 1);
+  CHECK(search.run().position == 4);
+  search.start(buffer, Term::Search("th"), 1);
+  CHECK(search.run().position == 8);
+  search.start(buffer, Term::Search("thx"), 1);
+  CHECK(search.run().position == npos);
+  search.start(buffer, Term::Search("thxy"), 1);
+  CHECK(search.done());
+  CHECK_FALSE(search.match().found());
+  // A new pattern starts over
+  search.start(buffer, Term::Search("o"), 1);
+  CHECK(search.run().position == 6);
+  search.cancel();
+  CHECK(search.done());
+  const Term::TextBuffer empty;
+  search.start(empty, Term::Search("o"), 0);
+  CHECK(search.done());
+}
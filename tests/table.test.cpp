@@ -0,0 +1,145 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/table.hpp"
+
+#include "cpp-terminal/emulator.hpp"
+#include "cpp-terminal/exception.hpp"
+#include "cpp-terminal/style.hpp"
+#include "cpp-terminal/window.hpp"
+#include "doctest/doctest.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// The rows of the table drawn in a width x height window, and the emulator showing them
+std::vector<std::string> rows(Term::Table& table, const std::size_t& width, const std::size_t& height, Term::Emulator* shown = nullptr)
+{
+  Term::Window window(width, height);
+  table.render(window, 1, 1, width, height);
+  Term::Emulator emulator(height, width);
+  emulator.feed(window.render(1, 1, true));
+  std::vector<std::string> ret;
+  for(std::size_t row = 1; row <= height; ++row)
+  {
+    std::string text{emulator.row(row)};
+    text.erase(text.find_last_not_of(' ') + 1);
+    ret.push_back(text);
+  }
+  if(shown != nullptr) { *shown = emulator; }
+  return ret;
+}
+
+}  // namespace
+
+TEST_CASE("Only the rows shown are asked for")
+{
+  std::vector<std::size_t> asked;
+  Term::Table              table({Term::Table::Column("Row", Term::Table::Align::Right)}, 1000000, [&asked](const std::size_t& row) -> std::vector<std::string>
+                    {
+                      asked.push_back(row);
+                      return {std::to_string(row)};
+                    },
+                    16);
+  CHECK(asked.empty());
+  // The first and last rows and 14 in between are measured
+  CHECK(table.column_width(0) == 6);
+  REQUIRE(asked.size() == 16);
+  CHECK(asked.front() == 0);
+  CHECK(asked.back() == 999999);
+  asked.clear();
+  CHECK(rows(table, 10, 11)[10] == "     9");
+  CHECK(asked.size() == 10);
+  CHECK(table.page() == 10);
+  // Scrolling asks for the new rows only
+  asked.clear();
+  table.scroll(1);
+  CHECK(rows(table, 10, 11)[10] == "    10");
+  CHECK(asked == std::vector<std::size_t>{10});
+  asked.clear();
+  table.scroll(-2);
+  CHECK(rows(table, 10, 11)[1] == "     0");
+  CHECK(asked == std::vector<std::size_t>{0});
+  // No further than the last page
+  asked.clear();
+  table.scroll_to(2000000);
+  CHECK(table.top() == 999990);
+  CHECK(rows(table, 10, 11)[10] == "999999");
+  CHECK(asked.size() == 10);
+  table.scroll(-1000);
+  CHECK(table.top() == 998990);
+  table.scroll(-1000000);
+  CHECK(table.top() == 0);
+  // Forgotten rows are asked for again
+  rows(table, 10, 11);
+  asked.clear();
+  table.refresh();
+  rows(table, 10, 11);
+  CHECK(asked.size() == 10);
+  // Fewer rows than the page
+  table.set_rows(3);
+  CHECK(rows(table, 10, 11) == std::vector<std::string>{"   Row", "     0", "     1", "     2", "", "", "", "", "", "", ""});
+  CHECK_THROWS_AS(Term::Table({}, 1, [](const std::size_t&) { return std::vector<std::string>(); }), Term::Exception);
+  CHECK_THROWS_AS(Term::Table({Term::Table::Column("Row")}, 1, Term::Table::Rows()), Term::Exception);
+}
+
+TEST_CASE("Layout")
+{
+  const std::vector<Term::Table::Column> columns{Term::Table::Column("Name"), Term::Table::Column("Size", Term::Table::Align::Right), Term::Table::Column("Kind", Term::Table::Align::Center, 6)};
+  Term::Table                            table(columns, 3, [](const std::size_t& row) -> std::vector<std::string> { return {"file" + std::to_string(row), std::to_string(row * 100), "x"}; });
+  CHECK(table.column_width(0) == 5);
+  CHECK(table.column_width(1) == 4);
+  CHECK(table.column_width(2) == 6);
+  CHECK(table.width() == 21);
+  Term::Emulator shown(1, 1);
+  CHECK(rows(table, 30, 4, &shown) == std::vector<std::string>{"Name  │ Size │  Kind", "file0 │    0 │   x", "file1 │  100 │   x", "file2 │  200 │   x"});
+  // The header is bold, the rows are not
+  CHECK(shown.cell(1, 1).has(Term::Style::Bold));
+  CHECK_FALSE(shown.cell(2, 1).has(Term::Style::Bold));
+  // Scrolled right, no further than the right edge of the view: the cells cut by the edges
+  table.scroll_columns(7);
+  CHECK(table.left() == 0);
+  rows(table, 10, 4);
+  table.scroll_columns(7);
+  CHECK(table.left() == 7);
+  CHECK(rows(table, 10, 4) == std::vector<std::string>{" Size │  K", "    0 │", "  100 │", "  200 │"});
+  table.scroll_columns(100);
+  CHECK(table.left() == 11);
+  CHECK(rows(table, 10, 4)[0] == "e │  Kind");
+  table.scroll_columns(-100);
+  CHECK(table.left() == 0);
+  CHECK(rows(table, 10, 4)[1] == "file0 │");
+  // The header stays when scrolled down
+  rows(table, 30, 3);
+  table.scroll(1);
+  CHECK(rows(table, 30, 3) == std::vector<std::string>{"Name  │ Size │  Kind", "file1 │  100 │   x", "file2 │  200 │   x"});
+}
+
+TEST_CASE("Widths")
+{
+  // A single row sampled: the columns widen with the wider cells shown, no wider than their maximum
+  std::vector<std::vector<std::string>> data(100, {"a", "b"});
+  data[50] = {"abcd", "abcdefghij"};
+  data[51] = {"日本語", ""};
+  data[52] = {"日本語x", "tab\there"};
+  data[53] = {"é"};
+  Term::Table table({Term::Table::Column("T", Term::Table::Align::Left, 0, 6), Term::Table::Column("U", Term::Table::Align::Left, 0, 6)}, data.size(), [&data](const std::size_t& row) { return data[row]; }, 1);
+  CHECK(table.column_width(0) == 1);
+  CHECK(table.column_width(1) == 1);
+  table.scroll_to(50);
+  CHECK(rows(table, 20, 5) == std::vector<std::string>{"T      │ U", "abcd   │ abcde…", "日本語 │", "日本 … │ tab  …", "é      │"});
+  CHECK(table.column_width(0) == 6);
+  CHECK(table.column_width(1) == 6);
+  CHECK(table.width() == 15);
+}
@@ -0,0 +1,212 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/textbuffer.hpp"
+
+#include "cpp-terminal/exception.hpp"
+#include "doctest/doctest.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+
+// The line index of buffer against the one of its text
+void check_lines(const Term::TextBuffer& buffer)
+{
+  const std::string text{buffer.str()};
+  std::size_t       line{0};
+  std::size_t       begin{0};
+  for(std::size_t i = 0; i <= text.size(); ++i)
+  {
+    CAPTURE(i);
+    CHECK(buffer.line_of(i) == line);
+    if(i == text.size() || text[i] == '\n')
+    {
+      CHECK(buffer.line_begin(line) == begin);
+      CHECK(buffer.line_end(line) == i);
+      CHECK(buffer.line(line) == text.substr(begin, i - begin));
+      ++line;
+      begin = i + 1;
+    }
+  }
+  CHECK(buffer.lines() == line);
+}
+
+std::string read(const std::string& path)
+{
+  std::ifstream      file(path, std::ios::binary);
+  std::ostringstream ret;
+  ret << file.rdbuf();
+  return ret.str();
+}
+
+}  // namespace
+
+TEST_CASE("Text buffer")
+{
+  Term::TextBuffer buffer;
+  CHECK(buffer.empty());
+  CHECK(buffer.lines() == 1);
+  buffer.insert(0, "hello world");
+  buffer.insert(5, ",");
+  CHECK(buffer.str() == "hello, world");
+  buffer.insert(0, "> ");
+  buffer.insert(buffer.size(), "!");
+  CHECK(buffer.str() == "> hello, world!");
+  CHECK(buffer[2] == 'h');
+  CHECK(buffer.substr(4, 6) == "llo, w");
+  buffer.erase(7, 100);
+  CHECK(buffer.str() == "> hello");
+  buffer.erase(0, 2);
+  CHECK(buffer.str() == "hello");
+  CHECK_THROWS_AS(buffer.insert(6, "x"), Term::Exception);
+  CHECK_THROWS_AS(buffer.substr(6, 1), Term::Exception);
+  CHECK_THROWS_AS(buffer.erase(6, 1), Term::Exception);
+}
+
+TEST_CASE("Line index")
+{
+  Term::TextBuffer buffer("first\nsecond\n\nfourth");
+  check_lines(buffer);
+  buffer.insert(0, "a\nb");
+  check_lines(buffer);
+  buffer.insert(buffer.size(), "\nlast\n");
+  check_lines(buffer);
+  buffer.insert(9, "\n");
+  check_lines(buffer);
+  buffer.erase(1, 1);
+  check_lines(buffer);
+  CHECK(buffer.str() == "abfirst\n\nsecond\n\nfourth\nlast\n");
+  buffer.erase(8, 3);
+  check_lines(buffer);
+  buffer.insert(3, "x\ny\n");
+  check_lines(buffer);
+  buffer.erase(0, buffer.size());
+  check_lines(buffer);
+  CHECK(buffer.lines() == 1);
+  CHECK_THROWS_AS(buffer.line_begin(1), Term::Exception);
+  CHECK_THROWS_AS(buffer.line_end(1), Term::Exception);
+}
+
+TEST_CASE("Edits against a string")
+{
+  std::string      text{"int main()\n{\n  return 0;\n}\n"};
+  Term::TextBuffer buffer(text);
+  unsigned         seed{12345};
+  const auto       random = [&seed](const std::size_t& bound) -> std::size_t
+  {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) % bound;
+  };
+  for(std::size_t i = 0; i != 500; ++i)
+  {
+    CAPTURE(i);
+    const std::size_t position{random(text.size() + 1)};
+    if(random(3) != 0)
+    {
+      const std::string inserted{random(4) == 0 ? "\n" : std::string(random(5) + 1, static_cast<char>('a' + random(26)))};
+      text.insert(position, inserted);
+      buffer.insert(position, inserted);
+    }
+    else
+    {
+      const std::size_t count{random(8)};
+      text.erase(position, count);
+      buffer.erase(position, count);
+    }
+    REQUIRE(buffer.str() == text);
+    if(i % 50 == 0) { check_lines(buffer); }
+  }
+  check_lines(buffer);
+  // Everything can be undone, then redone
+  while(buffer.undo()) {}
+  CHECK(buffer.str() == "int main()\n{\n  return 0;\n}\n");
+  check_lines(buffer);
+  while(buffer.redo()) {}
+  CHECK(buffer.str() == text);
+  check_lines(buffer);
+}
+
+TEST_CASE("Undo and snapshots")
+{
+  Term::TextBuffer buffer("ab");
+  CHECK_FALSE(buffer.undo());
+  // A run of typing is one step, a new line starts another one
+  buffer.insert(1, "x");
+  buffer.insert(2, "y");
+  buffer.insert(3, "z");
+  buffer.insert(4, "\n");
+  buffer.insert(5, "w");
+  CHECK(buffer.str() == "axyz\nwb");
+  const Term::TextBuffer::Snapshot snapshot{buffer.snapshot()};
+  CHECK(snapshot.size() == 7);
+  CHECK(buffer.undo());
+  CHECK(buffer.str() == "axyz\nb");
+  CHECK(buffer.undo());
+  CHECK(buffer.str() == "ab");
+  CHECK_FALSE(buffer.undo());
+  CHECK(buffer.redo());
+  CHECK(buffer.str() == "axyz\nb");
+  // An edit forgets what could be redone
+  buffer.erase(0, 1);
+  CHECK_FALSE(buffer.redo());
+  CHECK(buffer.str() == "xyz\nb");
+  buffer.restore(snapshot);
+  CHECK(buffer.str() == "axyz\nwb");
+  check_lines(buffer);
+  CHECK(buffer.undo());
+  CHECK(buffer.str() == "xyz\nb");
+  // Typing elsewhere is another step
+  buffer.insert(4, "c");
+  buffer.insert(0, "d");
+  CHECK(buffer.undo());
+  CHECK(buffer.str() == "xyz\ncb");
+}
+
+TEST_CASE("Open and save")
+{
+  const std::string path{"textbuffer.test.txt"};
+  {
+    std::ofstream file(path, std::ios::binary);
+    for(std::size_t i = 0; i != 10000; ++i) { file << "line " << i << '\n'; }
+  }
+  Term::TextBuffer buffer{Term::TextBuffer::open(path)};
+  CHECK(buffer.line(0) == "line 0");
+  CHECK(buffer.line(42) == "line 42");
+  CHECK(buffer.line_of(buffer.line_begin(9999)) == 9999);
+  CHECK(buffer.lines() == 10001);
+  buffer.insert(buffer.line_begin(1), "inserted\n");
+  buffer.erase(buffer.line_begin(3), buffer.line_end(3) - buffer.line_begin(3) + 1);
+  CHECK(buffer.line(1) == "inserted");
+  CHECK(buffer.line(3) == "line 3");
+  // Saving replaces the file the buffer maps, which it still reads
+  buffer.save(path);
+  CHECK(read(path) == buffer.str());
+  buffer.insert(0, "more ");
+  CHECK(buffer.line(9999) == "line 9999");
+  CHECK(buffer.line(0) == "more line 0");
+#if !defined(_WIN32)
+  // Truncated under the mapping: saving throws instead of crashing
+  Term::TextBuffer truncated{Term::TextBuffer::open(path)};
+  std::ofstream(path, std::ios::binary | std::ios::trunc).close();
+  CHECK_THROWS_AS(truncated.save(path), Term::Exception);
+#endif
+  std::ofstream(path, std::ios::binary | std::ios::trunc).close();
+  CHECK(Term::TextBuffer::open(path).empty());
+  std::remove(path.c_str());
+  CHECK_THROWS_AS(Term::TextBuffer::open(path), Term::Exception);
+  // Not readable
+  CHECK_THROWS_AS(Term::TextBuffer::open("."), Term::Exception);
+}
@@ -13,6 +13,26 @@
 #include "doctest/doctest.h"
 
 #include <string>
+#include <vector>
+
+namespace
+{
+
+// Run the checks with every ASCII kernel this CPU supports
+std::vector<Term::Private::Utf8Kernel> kernels()
+{
+  std::vector<Term::Private::Utf8Kernel> ret;
+  const Term::Private::Utf8Kernel        detected{Term::Private::utf8_kernel()};
+  const Term::Private::Utf8Kernel        all[]{Term::Private::Utf8Kernel::Scalar, Term::Private::Utf8Kernel::Sse2, Term::Private::Utf8Kernel::Avx2, Term::Private::Utf8Kernel::Neon};
+  for(const Term::Private::Utf8Kernel kernel: all)
+  {
+    if(Term::Private::set_utf8_kernel(kernel)) { ret.push_back(kernel); }
+  }
+  Term::Private::set_utf8_kernel(detected);
+  return ret;
+}
+
+}  // namespace
 
 #if defined(_WIN32)
 TEST_CASE("to_narrow")
@@ -86,6 +106,9 @@ TEST_CASE("utf32 to utf8")
 TEST_CASE("utf8 to utf32")
 {
   // Some charabia UTF8
+  std::string    str;
+  std::u32string s;
+  std::u32string ref;
   str = (const char*)(u8"∮ E⋅da = Q,  n → ∞, ∑ f(i) = ∏ g(i)γνωρίζω ἀπὸ τὴν ὄψηდარგებში⠝⠁⠊⠇ ⠁⠎ ⠹⠑ ⠙როგორიცააᚻ∂∈ℝ∧∪≡∞ ↑↗↨↻⇣ ┐┼╔╘░►☺♀ ﬁ�⑀₂ἠḂᛖᛒᚢᛞᛖразличных\tопеฮั่นเสื่อมโทรมแማደሪያ የለው፥ ግንድ ይዞ ይዞራል።\n");
   s   = {Term::Private::utf8_to_utf32(str)};
   ref = U"∮ E⋅da = Q,  n → ∞, ∑ f(i) = ∏ g(i)γνωρίζω ἀπὸ τὴν ὄψηდარგებში⠝⠁⠊⠇ ⠁⠎ ⠹⠑ ⠙როგორიცააᚻ∂∈ℝ∧∪≡∞ ↑↗↨↻⇣ ┐┼╔╘░►☺♀ ﬁ�⑀₂ἠḂᛖᛒᚢᛞᛖразличных\tопеฮั่นเสื่อมโทรมแማደሪያ የለው፥ ግንድ ይዞ ይዞራል።\n";
@@ -133,3 +156,141 @@ TEST_CASE("utf8_codepoint_size")
   std::string four = "\xf0\x90\x8c\xbc";
   CHECK(Term::Private::utf8_codepoint_size(four[0]) == 4);
 }
+
+TEST_CASE("utf8 to utf32 ill-formed sequences")
+{
+  const std::vector<Term::Private::Utf8Kernel> available{kernels()};
+  const Term::Private::Utf8Kernel              detected{Term::Private::utf8_kernel()};
+  CHECK(!available.empty());
+  for(const Term::Private::Utf8Kernel kernel: available)
+  {
+    CAPTURE(static_cast<int>(kernel));
+    REQUIRE(Term::Private::set_utf8_kernel(kernel));
+    // Overlong forms
+    CHECK(Term::Private::utf8_to_utf32("\xc0\xaf") == U"\uFFFD\uFFFD");
+    CHECK(Term::Private::utf8_to_utf32("\xe0\x80\xaf") == U"\uFFFD\uFFFD\uFFFD");
+    CHECK(Term::Private::utf8_to_utf32("\xf0\x80\x80\xaf") == U"\uFFFD\uFFFD\uFFFD\uFFFD");
+    // Surrogates and above 0x10FFFF
+    CHECK(Term::Private::utf8_to_utf32("\xed\xa0\x80") == U"\uFFFD\uFFFD\uFFFD");
+    CHECK(Term::Private::utf8_to_utf32("\xf4\x90\x80\x80") == U"\uFFFD\uFFFD\uFFFD\uFFFD");
+    CHECK(Term::Private::utf8_to_utf32("\xf5\x80") == U"\uFFFD\uFFFD");
+    // Maximal subparts: a truncated sequence gives one replacement character
+    CHECK(Term::Private::utf8_to_utf32("a\xe2\x82") == U"a\uFFFD");
+    CHECK(Term::Private::utf8_to_utf32("\xf0\x90\x8c" "b") == U"\uFFFDb");
+    CHECK(Term::Private::utf8_to_utf32("\xe2\x28\xa1") == U"\uFFFD(\uFFFD");
+    CHECK(Term::Private::utf8_to_utf32("\xa0\xa1") == U"\uFFFD\uFFFD");
+    // The replacement character itself is valid
+    CHECK(Term::Private::utf8_to_utf32("\xef\xbf\xbd") == U"\uFFFD");
+    CHECK_THROWS_AS(Term::Private::utf8_to_utf32("ab\xc0\xaf", true), Term::Exception);
+    CHECK_NOTHROW(Term::Private::utf8_to_utf32("ab\xf0\x90\x8c\xbc", true));
+    const std::string overlong{"\xe0\x80\xaf"};
+    CHECK(Term::Private::is_valid_utf8(overlong.begin(), overlong.end()) == false);
+    const std::string truncated{"abc\xf0\x90"};
+    CHECK(Term::Private::is_valid_utf8(truncated.begin(), truncated.end()) == false);
+  }
+  Term::Private::set_utf8_kernel(detected);
+}
+
+TEST_CASE("utf8 to utf32 across blocks")
+{
+  const std::vector<Term::Private::Utf8Kernel> available{kernels()};
+  const Term::Private::Utf8Kernel              detected{Term::Private::utf8_kernel()};
+  const std::string                            ascii{"The quick brown fox jumps over the lazy dog 0123456789"};
+  const std::u32string                         ascii32{U"The quick brown fox jumps over the lazy dog 0123456789"};
+  for(const Term::Private::Utf8Kernel kernel: available)
+  {
+    CAPTURE(static_cast<int>(kernel));
+    REQUIRE(Term::Private::set_utf8_kernel(kernel));
+    // Put a multi-byte code point (and a broken one) at every offset of the first blocks
+    for(std::size_t offset = 0; offset <= 40; ++offset)
+    {
+      CAPTURE(offset);
+      const std::string    str{ascii.substr(0, offset) + "\xe2\x88\x9e" + ascii + "\xf0\x9f\x98\x80" + ascii.substr(0, offset)};
+      const std::u32string ref{ascii32.substr(0, offset) + U"\u221E" + ascii32 + U"\U0001F600" + ascii32.substr(0, offset)};
+      CHECK(Term::Private::utf8_to_utf32(str) == ref);
+      CHECK(Term::Private::is_valid_utf8(str.begin(), str.end()) == true);
+      const std::string bad{ascii.substr(0, offset) + "\xe2\x88" + ascii};
+      CHECK(Term::Private::utf8_to_utf32(bad) == ascii32.substr(0, offset) + U"\uFFFD" + ascii32);
+      CHECK(Term::Private::is_valid_utf8(bad.begin(), bad.end()) == false);
+    }
+    std::string long_ascii;
+    for(std::size_t i = 0; i != 1000; ++i) { long_ascii.push_back(static_cast<char>(' ' + i % 95)); }
+    const std::u32string long_ascii32{Term::Private::utf8_to_utf32(long_ascii)};
+    REQUIRE(long_ascii32.size() == long_ascii.size());
+    for(std::size_t i = 0; i != long_ascii.size(); ++i) { CHECK(long_ascii32[i] == static_cast<char32_t>(long_ascii[i])); }
+  }
+  Term::Private::set_utf8_kernel(detected);
+}
+
+TEST_CASE("Utf8Decoder")
+{
+  const std::string    text{"a\xc3\xa9\xe4\xbd\xa0\xf0\x9f\x98\x80z"};  // aé你😀z
+  const std::u32string text32{U"aé你\U0001F600z"};
+  // Every way to split the text in two reads
+  for(std::size_t split = 0; split <= text.size(); ++split)
+  {
+    CAPTURE(split);
+    Term::Private::Utf8Decoder decoder;
+    std::u32string             decoded;
+    decoder.decode(text.data(), split, decoded);
+    decoder.decode(text.data() + split, text.size() - split, decoded);
+    CHECK(decoded == text32);
+    CHECK(decoder.pending() == false);
+    Term::Private::Utf8Decoder bytes;
+    const std::string          first{bytes.complete(text.substr(0, split))};
+    CHECK(Term::Private::is_valid_utf8(first.begin(), first.end()));
+    CHECK(first + bytes.complete(text.substr(split)) == text);
+  }
+  // One byte at a time
+  Term::Private::Utf8Decoder decoder;
+  std::u32string             decoded;
+  for(std::size_t i = 0; i != text.size(); ++i) { decoder.decode(text.data() + i, 1, decoded); }
+  CHECK(decoded == text32);
+
+  // An unfinished sequence followed by something else is one replacement character
+  decoded.clear();
+  decoder.decode("x\xe4\xbd", 3, decoded);
+  CHECK(decoded == U"x");
+  CHECK(decoder.pending());
+  decoder.decode("y", 1, decoded);
+  CHECK(decoded == U"x�y");
+  // Ill-formed bytes are not kept back
+  decoded.clear();
+  decoder.decode("\xe0\x80", 2, decoded);
+  CHECK(decoded == U"��");
+  CHECK(decoder.pending() == false);
+  CHECK(decoder.complete("ab\xff") == "ab\xff");
+  CHECK(decoder.complete("\xf0\x9f") == "");
+  decoder.reset();
+  CHECK(decoder.pending() == false);
+  CHECK(decoder.complete("\x98\x80") == "\x98\x80");
+}
+
+TEST_CASE("append_utf8")
+{
+  const std::u32string codepoints{U"aé你\U0001F600"};
+  CHECK(Term::Private::utf8_size(U'a') == 1);
+  CHECK(Term::Private::utf8_size(U'é') == 2);
+  CHECK(Term::Private::utf8_size(U'你') == 3);
+  CHECK(Term::Private::utf8_size(U'\U0001F600') == 4);
+  CHECK(Term::Private::utf8_size(static_cast<char32_t>(0x110000)) == 3);
+  CHECK(Term::Private::utf8_size(codepoints.data(), codepoints.size()) == 10);
+
+  char              buffer[4]{};
+  const std::size_t size{Term::Private::encode_utf8(U'€', buffer)};
+  CHECK(std::string(buffer, size) == "\xe2\x82\xac");
+
+  std::string out{"prefix "};
+  Term::Private::append_utf8(out, codepoints.data(), codepoints.size());
+  CHECK(out == "prefix a\xc3\xa9\xe4\xbd\xa0\xf0\x9f\x98\x80");
+  Term::Private::append_utf8(out, U'!');
+  CHECK(out == "prefix a\xc3\xa9\xe4\xbd\xa0\xf0\x9f\x98\x80!");
+  CHECK(Term::Private::utf32_to_utf8(codepoints) == "a\xc3\xa9\xe4\xbd\xa0\xf0\x9f\x98\x80");
+
+  const std::u32string bad{U'a', static_cast<char32_t>(0x110000), U'b'};
+  CHECK(Term::Private::utf32_to_utf8(bad) == "a\xef\xbf\xbd"
+                                             "b");
+  out = "kept";
+  CHECK_THROWS_AS(Term::Private::append_utf8(out, bad.data(), bad.size(), true), Term::Exception);
+  CHECK(out == "kept");
+}
@@ -0,0 +1,49 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/private/wcwidth.hpp"
+
+#include "doctest/doctest.h"
+
+TEST_CASE("wcwidth")
+{
+  CHECK(Term::Private::wcwidth(U'\0') == 0);
+  CHECK(Term::Private::wcwidth(U'\u0007') == -1);
+  CHECK(Term::Private::wcwidth(U'\u007F') == -1);
+  CHECK(Term::Private::wcwidth(U'\u0085') == -1);
+  CHECK(Term::Private::wcwidth(U' ') == 1);
+  CHECK(Term::Private::wcwidth(U'~') == 1);
+  CHECK(Term::Private::wcwidth(U'é') == 1);
+  CHECK(Term::Private::wcwidth(U'\u00AD') == 1);  // SOFT HYPHEN
+  CHECK(Term::Private::wcwidth(U'\u0301') == 0);  // COMBINING ACUTE ACCENT
+  CHECK(Term::Private::wcwidth(U'\u200B') == 0);  // ZERO WIDTH SPACE
+  CHECK(Term::Private::wcwidth(U'\u200D') == 0);  // ZERO WIDTH JOINER
+  CHECK(Term::Private::wcwidth(U'\uFE0F') == 0);  // VARIATION SELECTOR-16
+  CHECK(Term::Private::wcwidth(U'\u1160') == 0);  // HANGUL JUNGSEONG FILLER
+  CHECK(Term::Private::wcwidth(U'─') == 1);
+  CHECK(Term::Private::wcwidth(U'你') == 2);
+  CHECK(Term::Private::wcwidth(U'가') == 2);
+  CHECK(Term::Private::wcwidth(U'ア') == 2);
+  CHECK(Term::Private::wcwidth(U'Ａ') == 2);  // FULLWIDTH LATIN CAPITAL LETTER A
+  CHECK(Term::Private::wcwidth(U'\U0001F600') == 2);
+  CHECK(Term::Private::wcwidth(U'\U0002A6D6') == 2);
+  CHECK(Term::Private::wcwidth(U'\U0003FFFD') == 2);  // Unassigned, reserved for ideographs
+  CHECK(Term::Private::wcwidth(U'\U0010FFFF') == 1);
+  CHECK(Term::Private::wcwidth(static_cast<char32_t>(0x110000)) == 1);
+}
+
+TEST_CASE("wcswidth")
+{
+  CHECK(Term::Private::wcswidth(std::u32string(U"")) == 0);
+  CHECK(Term::Private::wcswidth(std::u32string(U"abc")) == 3);
+  CHECK(Term::Private::wcswidth(std::u32string(U"é")) == 1);
+  CHECK(Term::Private::wcswidth(std::u32string(U"你好, world\u0007")) == 11);
+  CHECK(Term::Private::wcswidth(std::string("\xe4\xbd\xa0\xe5\xa5\xbd\xf0\x9f\x98\x80")) == 6);
+}
@@ -0,0 +1,176 @@
+/*
+* cpp-terminal
+* C++ library for writing multi-platform terminal applications.
+*
+* SPDX-FileCopyrightText: 2019-2023 cpp-terminal
+*
+* SPDX-License-Identifier: MIT
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "cpp-terminal/window.hpp"
+
+#include "cpp-terminal/cursor.hpp"
+#include "cpp-terminal/emulator.hpp"
+#include "cpp-terminal/prompt.hpp"
+#include "doctest/doctest.h"
+
+#include <cstddef>
+#include <string>
+
+namespace
+{
+
+// Both screens show the same cells and cursor
+void check_same(const Term::Emulator& emulator, const Term::Emulator& expected, const std::size_t& rows, const std::size_t& columns)
+{
+  for(std::size_t row = 1; row <= rows; ++row)
+  {
+    for(std::size_t column = 1; column <= columns; ++column)
+    {
+      CAPTURE(row);
+      CAPTURE(column);
+      CHECK(emulator.cell(row, column) == expected.cell(row, column));
+    }
+  }
+  CHECK(emulator.cursor() == expected.cursor());
+}
+
+}  // namespace
+
+TEST_CASE("Window::render round trip")
+{
+  Term::Window window(6, 2);
+  window.print_str(1, 1, "Hello");
+  window.print_str(2, 2, "World");
+  window.set_style(2, 2, Term::Style::Bold);
+  window.set_cursor_pos(3, 2);
+  Term::Emulator emulator(4, 10);
+  emulator.feed(window.render(2, 2, true));
+  CHECK(emulator.text() == "\n Hello\n  World\n");
+  CHECK(emulator.cell(3, 3).has(Term::Style::Bold));
+  CHECK(!emulator.cell(3, 4).has(Term::Style::Bold));
+  CHECK(emulator.cursor().row() == 3);
+  CHECK(emulator.cursor().column() == 4);
+  CHECK(emulator.cursor_visible());
+}
+
+TEST_CASE("Window with grapheme clusters")
+{
+  // e + 2 accents, family (ZWJ sequence), flag, keycap, thumbs up with skin tone, e + accent
+  const std::string text{"e\xcc\x81\xcc\xa3\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x91\xa7\xf0\x9f\x87\xab\xf0\x9f\x87\xb7" "1\xef\xb8\x8f\xe2\x83\xa3\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd" "e\xcc\x81"};
+  Term::Window window(10, 2);
+  window.print_str(1, 1, text);
+  window.print_str(1, 2, text);  // the same clusters are interned once
+  Term::Emulator emulator(2, 10);
+  emulator.feed(window.render(1, 1, false));
+  CHECK(emulator.row(1) == text);
+  CHECK(emulator.row(2) == text);
+  CHECK(emulator.cell(1, 2).character == U'\U0001F468');
+  CHECK(emulator.cell(1, 4).character == U'\U0001F1EB');
+  CHECK(emulator.cell(1, 6).character == U'1');
+  CHECK(emulator.cell(1, 8).character == U'\U0001F44D');
+  CHECK(emulator.cell(1, 10).combining == U"\u0301");
+  // CR LF is one cluster but still a new line
+  Term::Window lines(3, 2);
+  lines.print_str(1, 1, "ab\r\ncd");
+  CHECK(lines.render(1, 1, false) == "ab \ncd ");
+}
+
+TEST_CASE("Window with wide characters")
+{
+  Term::Window window(6, 2);
+  window.print_str(1, 1, "a\xe4\xbd\xa0" "bcd");  // a你bcd does not fit
+  window.print_str(1, 2, "e\xcc\x81\xf0\x9f\x98\x80!");
+  Term::Emulator emulator(2, 6);
+  emulator.feed(window.render(1, 1, true));
+  CHECK(emulator.text() == "a\xe4\xbd\xa0" "bcd\ne\xcc\x81\xf0\x9f\x98\x80!");
+  // Overwriting half of a wide character blanks the other half
+  window.set_char(3, 1, U'x');
+  window.set_char(6, 1, U'\U0001F600');  // no room for it
+  window.set_char(3, 2, U'y');
+  Term::Emulator overwritten(2, 6);
+  overwritten.feed(window.render(1, 1, true));
+  CHECK(overwritten.text() == "a xbc\ne\xcc\x81 y!");
+  // A character spanning both halves of two wide characters
+  Term::Window pairs(4, 1);
+  pairs.print_str(1, 1, "\xe4\xbd\xa0\xe5\xa5\xbd");
+  pairs.set_char(2, 1, U'あ');
+  Term::Emulator shifted(1, 4);
+  shifted.feed(pairs.render(1, 1, false));
+  CHECK(shifted.text() == " \xe3\x81\x82");
+}
+
+TEST_CASE("Window::render against the previous frame")
+{
+  Term::Window window(8, 3);
+  window.print_str(1, 1, "Hello");
+  window.print_str(1, 2, "a\xe4\xbd\xa0" "bcd");
+  window.print_str(1, 3, "e\xcc\x81\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9");
+  window.fill_fg(1, 1, 8, 1, Term::Color::Name::Green);
+  Term::Emulator emulator(4, 10);
+  emulator.feed(window.render(2, 2, true));
+  Term::Window previous{window};
+  // Nothing changed: at most the cursor moves
+  CHECK(window.render(2, 2, previous).empty());
+  window.set_cursor_pos(3, 1);
+  CHECK(window.render(2, 2, previous) == Term::cursor_move(2, 4));
+  // Changes at both ends of a row, over half a wide character, a style and a cluster interned again
+  window.clear();
+  window.print_str(1, 1, "Jello  !");
+  window.fill_fg(1, 1, 8, 1, Term::Color::Name::Green);
+  window.print_str(1, 2, "a xbcd");
+  window.set_style(6, 2, Term::Style::Bold);
+  window.print_str(2, 3, "e\xcc\x81\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9");
+  window.set_cursor_pos(3, 1);
+  emulator.feed(window.render(2, 2, previous));
+  Term::Emulator expected(4, 10);
+  expected.feed(window.render(2, 2, true));
+  check_same(emulator, expected, 4, 10);
+  // A taller window writes its new rows in full
+  window.set_h(4);
+  window.print_str(1, 4, "more");
+  Term::Emulator taller(5, 10);
+  taller.feed(previous.render(1, 1, true));
+  taller.feed(window.render(1, 1, previous));
+  Term::Emulator full(5, 10);
+  full.feed(window.render(1, 1, true));
+  check_same(taller, full, 5, 10);
+}
+
+TEST_CASE("Prompt redraw")
+{
+  const std::size_t columns{80};
+  const std::size_t rows{201};
+  Term::Model       model;
+  model.prompt_string = "> ";
+  for(std::size_t line = 1; line < rows; ++line)
+  {
+    model.insert("SELECT column_" + std::to_string(line) + " FROM table WHERE id = " + std::to_string(line) + ";");
+    if(line + 1 < rows) { model.new_line(); }
+  }
+  model.set_cursor(100, 8);
+  Term::Window previous(columns, model.lines());
+  render(previous, model, columns);
+  Term::Emulator emulator(rows, columns);
+  emulator.feed(previous.render(1, 1, true));
+  // One keystroke redraws its line, the position indicator and the cursor
+  Term::Window window(columns, model.lines());
+  model.insert('x');
+  render(window, model, columns);
+  emulator.reset_bytes();
+  emulator.feed(window.render(1, 1, previous));
+  CHECK(emulator.bytes() < 100);
+  Term::Emulator expected(rows, columns);
+  expected.feed(window.render(1, 1, true));
+  check_same(emulator, expected, rows, columns);
+  // A new line shifts every line below
+  model.new_line();
+  previous = window;
+  window.set_h(model.lines());
+  render(window, model, columns);
+  emulator.feed(window.render(1, 1, previous));
+  Term::Emulator shifted(rows, columns);
+  shifted.feed(window.render(1, 1, true));
+  check_same(emulator, shifted, rows, columns);
+}